@@ -0,0 +1,113 @@
+/*! \file Peridigm_Compute_Rigid_Contactor_Data.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <vector>
+
+#include "Peridigm_Compute_Rigid_Contactor_Data.hpp"
+#include "Peridigm_ContactManager.hpp"
+#include "Peridigm_Field.hpp"
+
+using namespace std;
+
+//! Standard constructor.
+PeridigmNS::Compute_Rigid_Contactor_Data::Compute_Rigid_Contactor_Data(Teuchos::RCP<const Teuchos::ParameterList> params,
+                                                                       Teuchos::RCP<const Epetra_Comm> epetraComm_,
+                                                                       Teuchos::RCP<const Teuchos::ParameterList> computeClassGlobalData_)
+  : Compute(params, epetraComm_, computeClassGlobalData_), m_contactManager(0), m_variableType(UNDEFINED_VARIABLE),
+    m_outputFieldId(-1)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(params.is_null(),
+                              "**** Error:  Rigid_Contactor_Data compute class requires a ParameterList in \"Compute Class Parameters\".\n");
+  m_contactorName = params->get<string>("Contactor");
+  m_outputLabel = params->get<string>("Output Label");
+
+  string variable = params->get<string>("Variable");
+  if(variable == "Force"){
+    m_variableType = FORCE;
+  }
+  else if(variable == "Displacement"){
+    m_variableType = DISPLACEMENT;
+  }
+  else if(variable == "Velocity"){
+    m_variableType = VELOCITY;
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true,
+     "**** Error:  invalid \"Variable\" in Rigid_Contactor_Data compute class, must be \"Force\", \"Displacement\", or \"Velocity\".\n");
+  }
+
+  // The contact manager is created before the compute classes
+  m_contactManager = computeClassGlobalData_->get< Teuchos::RCP<PeridigmNS::ContactManager>* >("contactManager");
+  std::string msg = "**** Error:  Invalid \"Contactor\" in Rigid_Contactor_Data compute class, rigid contactor not found.\n";
+  msg += "             Requested rigid contactor: " + m_contactorName + "\n";
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_contactManager->is_null() || (*m_contactManager)->getRigidContactor(m_contactorName).is_null(), msg);
+
+  FieldManager& fieldManager = FieldManager::self();
+  m_outputFieldId = fieldManager.getFieldId(PeridigmField::GLOBAL, PeridigmField::VECTOR, PeridigmField::CONSTANT, m_outputLabel);
+  m_fieldIds.push_back(m_outputFieldId);
+}
+
+int PeridigmNS::Compute_Rigid_Contactor_Data::compute( Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks ) const {
+
+  Teuchos::RCP<const PeridigmNS::RigidContactor> contactor = (*m_contactManager)->getRigidContactor(m_contactorName);
+
+  // Contactor data is already summed over all processors
+  const double* data = 0;
+  if(m_variableType == FORCE)
+    data = contactor->getForce();
+  else if(m_variableType == DISPLACEMENT)
+    data = contactor->getDisplacement();
+  else if(m_variableType == VELOCITY)
+    data = contactor->getVelocity();
+
+  Teuchos::RCP<Epetra_Vector> outputData = blocks->begin()->getData(m_outputFieldId, PeridigmField::STEP_NONE);
+  (*outputData)[0] = data[0];
+  (*outputData)[1] = data[1];
+  (*outputData)[2] = data[2];
+
+  return 0;
+}
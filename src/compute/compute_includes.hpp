@@ -17,6 +17,7 @@
 #include "Peridigm_Compute_Nearest_Point_Data.hpp"
 #include "Peridigm_Compute_Block_Data.hpp"
 #include "Peridigm_Compute_Node_Set_Data.hpp"
+#include "Peridigm_Compute_Rigid_Contactor_Data.hpp"
 #include "Peridigm_Compute_Deformation_Gradient.hpp"
 #include "Peridigm_Compute_Stored_Elastic_Energy_Density.hpp"
 #include "Peridigm_Compute_Stored_Elastic_Energy.hpp"
@@ -0,0 +1,211 @@
+/*! \file utPeridigm_Compute_Rigid_Contactor_Data.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Peridigm_Discretization.hpp>
+#include "../Peridigm_Compute_Rigid_Contactor_Data.hpp"
+#include <Peridigm_ContactManager.hpp>
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_GlobalMPISession.hpp"
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include <vector>
+#include "Peridigm.hpp"
+#include "Peridigm_Field.hpp"
+
+using namespace PeridigmNS;
+
+//! Four points along the x axis, the last of which is within the contact distance of a rigid plane.
+Teuchos::RCP<Peridigm> createFourPointModelWithRigidPlane() {
+
+  // set up parameter lists
+  // these data would normally be read from an input xml file
+  Teuchos::RCP<Teuchos::ParameterList> peridigmParams = rcp(new Teuchos::ParameterList());
+
+  // material parameters
+  Teuchos::ParameterList& materialParams = peridigmParams->sublist("Materials");
+  Teuchos::ParameterList& linearElasticMaterialParams = materialParams.sublist("My Elastic Material");
+  linearElasticMaterialParams.set("Material Model", "Elastic");
+  linearElasticMaterialParams.set("Density", 7800.0);
+  linearElasticMaterialParams.set("Bulk Modulus", 130.0e9);
+  linearElasticMaterialParams.set("Shear Modulus", 78.0e9);
+
+  // blocks
+  Teuchos::ParameterList& blockParams = peridigmParams->sublist("Blocks");
+  Teuchos::ParameterList& blockOneParams = blockParams.sublist("My Group of Blocks");
+  blockOneParams.set("Block Names", "block_1");
+  blockOneParams.set("Material", "My Elastic Material");
+  blockOneParams.set("Horizon", 5.0);
+
+  // Set up discretization parameterlist
+  Teuchos::ParameterList& discretizationParams = peridigmParams->sublist("Discretization");
+  discretizationParams.set("Type", "PdQuickGrid");
+
+  // pdQuickGrid tensor product mesh generator parameters, the points are at x = 0.75, 2.25, 3.75, and 5.25
+  Teuchos::ParameterList& pdQuickGridParams = discretizationParams.sublist("TensorProduct3DMeshGenerator");
+  pdQuickGridParams.set("Type", "PdQuickGrid");
+  pdQuickGridParams.set("X Origin",  0.0);
+  pdQuickGridParams.set("Y Origin",  0.0);
+  pdQuickGridParams.set("Z Origin",  0.0);
+  pdQuickGridParams.set("X Length",  6.0);
+  pdQuickGridParams.set("Y Length",  1.0);
+  pdQuickGridParams.set("Z Length",  1.0);
+  pdQuickGridParams.set("Number Points X", 4);
+  pdQuickGridParams.set("Number Points Y", 1);
+  pdQuickGridParams.set("Number Points Z", 1);
+
+  // contact parameters, a rigid plane at x = 5.5 facing the points with integrated motion
+  Teuchos::ParameterList& contactParams = peridigmParams->sublist("Contact");
+  contactParams.set("Search Radius", 2.0);
+  contactParams.set("Search Frequency", 1);
+  Teuchos::ParameterList& contactModelParams = contactParams.sublist("Models").sublist("My Contact Model");
+  contactModelParams.set("Contact Model", "Short Range Force");
+  contactModelParams.set("Contact Radius", 0.1);
+  contactModelParams.set("Spring Constant", 1.0);
+  Teuchos::ParameterList& plateParams = contactParams.sublist("Rigid Contactors").sublist("Plate");
+  plateParams.set("Type", "Plane");
+  plateParams.set("Point X", 5.5);
+  plateParams.set("Point Y", 0.0);
+  plateParams.set("Point Z", 0.0);
+  plateParams.set("Normal X", -1.0);
+  plateParams.set("Normal Y", 0.0);
+  plateParams.set("Normal Z", 0.0);
+  plateParams.set("Contact Distance", 0.5);
+  plateParams.set("Penalty Stiffness", 100.0);
+  plateParams.set("Motion", "Integrated");
+  plateParams.set("Mass", 3.0);
+  plateParams.set("Velocity X", -1.0);
+  plateParams.set("Acceleration Z", -2.0);
+
+  // compute class parameters
+  Teuchos::ParameterList& computeParams = peridigmParams->sublist("Compute Class Parameters");
+  const std::string variables[3] = {"Force", "Displacement", "Velocity"};
+  for(int i=0 ; i<3 ; ++i){
+    Teuchos::ParameterList& params = computeParams.sublist("Plate " + variables[i]);
+    params.set("Compute Class", "Rigid_Contactor_Data");
+    params.set("Contactor", "Plate");
+    params.set("Variable", variables[i]);
+    params.set("Output Label", "Plate_" + variables[i]);
+  }
+
+  // output parameters (to force instantiation of data storage for compute classes in DataManager)
+  Teuchos::ParameterList& outputParams = peridigmParams->sublist("Output");
+  Teuchos::ParameterList& outputFields = outputParams.sublist("Output Variables");
+  outputFields.set("Plate_Force", true);
+  outputFields.set("Plate_Displacement", true);
+  outputFields.set("Plate_Velocity", true);
+
+  // create the Peridigm object
+  Teuchos::RCP<Discretization> nullDiscretization;
+  Teuchos::RCP<Peridigm> peridigm = Teuchos::rcp(new Peridigm(MPI_COMM_WORLD, peridigmParams, nullDiscretization));
+
+  return peridigm;
+}
+
+TEUCHOS_UNIT_TEST(Compute_Rigid_Contactor_Data, FourPointTest) {
+
+  Teuchos::RCP<Epetra_Comm> comm;
+
+  #ifdef HAVE_MPI
+     comm = Teuchos::rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+     comm = Teuchos::rcp(new Epetra_SerialComm);
+  #endif
+
+  int numProcs = comm->NumProc();
+
+  TEST_COMPARE(numProcs, <=, 4);
+
+  if(numProcs > 4){
+    std::cerr << "Unit test runtime ERROR: utPeridigm_Compute_Rigid_Contactor_Data only makes sense on 1 to 4 processors." << std::endl;
+    return;
+  }
+
+  Teuchos::RCP<Peridigm> peridigm = createFourPointModelWithRigidPlane();
+
+  FieldManager& fieldManager = FieldManager::self();
+  Teuchos::RCP< std::vector<Block> > blocks = peridigm->getBlocks();
+  Teuchos::RCP<Epetra_Vector> force = blocks->begin()->getData(fieldManager.getFieldId("Plate_Force"), PeridigmField::STEP_NONE);
+  Teuchos::RCP<Epetra_Vector> displacement = blocks->begin()->getData(fieldManager.getFieldId("Plate_Displacement"), PeridigmField::STEP_NONE);
+  Teuchos::RCP<Epetra_Vector> velocity = blocks->begin()->getData(fieldManager.getFieldId("Plate_Velocity"), PeridigmField::STEP_NONE);
+
+  // Evaluate the contact force in the initial configuration; the point at x = 5.25 penetrates 0.25 into the
+  // contact layer, and the reaction on the plate is the penalty force times the volume of the point, 1.5
+  Teuchos::RCP<ContactManager> contactManager = peridigm->getContactManager();
+  contactManager->evaluateContactForce(0.1);
+  peridigm->getComputeManager()->compute(blocks);
+
+  double expectedForce[3] = {100.0*0.25*1.5, 0.0, 0.0};
+  double expectedDisplacement[3] = {0.0, 0.0, 0.0};
+  double expectedVelocity[3] = {-1.0, 0.0, 0.0};
+  for(int dof=0 ; dof<3 ; ++dof){
+    TEST_FLOATING_EQUALITY((*force)[dof] + 1.0, expectedForce[dof] + 1.0, 1.0e-12);
+    TEST_FLOATING_EQUALITY((*displacement)[dof] + 1.0, expectedDisplacement[dof] + 1.0, 1.0e-12);
+    TEST_FLOATING_EQUALITY((*velocity)[dof] + 1.0, expectedVelocity[dof] + 1.0, 1.0e-12);
+  }
+
+  // Advance the plate, the velocity is updated with the reaction and the acceleration before the position
+  contactManager->updateRigidContactors(0.1);
+  peridigm->getComputeManager()->compute(blocks);
+
+  expectedVelocity[0] = -1.0 + 0.1*expectedForce[0]/3.0;
+  expectedVelocity[2] = 0.1*(-2.0);
+  for(int dof=0 ; dof<3 ; ++dof)
+    expectedDisplacement[dof] = 0.1*expectedVelocity[dof];
+  for(int dof=0 ; dof<3 ; ++dof){
+    TEST_FLOATING_EQUALITY((*force)[dof] + 1.0, expectedForce[dof] + 1.0, 1.0e-12);
+    TEST_FLOATING_EQUALITY((*displacement)[dof] + 1.0, expectedDisplacement[dof] + 1.0, 1.0e-12);
+    TEST_FLOATING_EQUALITY((*velocity)[dof] + 1.0, expectedVelocity[dof] + 1.0, 1.0e-12);
+  }
+}
+
+int main (int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,167 @@
+//! \file Peridigm_AnalyticRigidContactors.cpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_AnalyticRigidContactors.hpp"
+#include <Teuchos_Assert.hpp>
+#include <cmath>
+#include <cfloat>
+
+using namespace std;
+
+PeridigmNS::RigidPlaneContactor::RigidPlaneContactor(const Teuchos::ParameterList& params,
+                                                     const std::string& name,
+                                                     Teuchos::RCP<PeridigmNS::Discretization> disc)
+  : RigidContactor(params, name, disc)
+{
+  getVectorParameter(params, "Point", point, true);
+  getVectorParameter(params, "Normal", unitNormal, true);
+  double magnitude = sqrt(unitNormal[0]*unitNormal[0] + unitNormal[1]*unitNormal[1] + unitNormal[2]*unitNormal[2]);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(magnitude == 0.0, "\n**** Error, rigid plane contactor \"Normal\" must be nonzero.\n");
+  for(int dof=0 ; dof<3 ; ++dof)
+    unitNormal[dof] /= magnitude;
+}
+
+bool PeridigmNS::RigidPlaneContactor::signedDistance(const double* x, double maxDistance, double& distance, double* normal) const
+{
+  distance = (x[0]-point[0])*unitNormal[0] + (x[1]-point[1])*unitNormal[1] + (x[2]-point[2])*unitNormal[2];
+  if(distance > maxDistance)
+    return false;
+  for(int dof=0 ; dof<3 ; ++dof)
+    normal[dof] = unitNormal[dof];
+  return true;
+}
+
+PeridigmNS::RigidSphereContactor::RigidSphereContactor(const Teuchos::ParameterList& params,
+                                                       const std::string& name,
+                                                       Teuchos::RCP<PeridigmNS::Discretization> disc)
+  : RigidContactor(params, name, disc), radius(0.0)
+{
+  getVectorParameter(params, "Center", center, true);
+  if(!params.isParameter("Radius"))
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Rigid sphere contactor parameter \"Radius\" not specified.");
+  radius = params.get<double>("Radius");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(radius <= 0.0, "\n**** Error, rigid sphere contactor \"Radius\" must be greater than zero.\n");
+}
+
+bool PeridigmNS::RigidSphereContactor::signedDistance(const double* x, double maxDistance, double& distance, double* normal) const
+{
+  double r[3] = {x[0]-center[0], x[1]-center[1], x[2]-center[2]};
+  double rSquared = r[0]*r[0] + r[1]*r[1] + r[2]*r[2];
+  double reach = radius + maxDistance;
+  if(rSquared > reach*reach)
+    return false;
+  double rMagnitude = sqrt(rSquared);
+  distance = rMagnitude - radius;
+  if(rMagnitude > 0.0){
+    for(int dof=0 ; dof<3 ; ++dof)
+      normal[dof] = r[dof]/rMagnitude;
+  }
+  else{
+    normal[0] = normal[1] = 0.0;
+    normal[2] = 1.0;
+  }
+  return true;
+}
+
+PeridigmNS::RigidCylinderContactor::RigidCylinderContactor(const Teuchos::ParameterList& params,
+                                                           const std::string& name,
+                                                           Teuchos::RCP<PeridigmNS::Discretization> disc)
+  : RigidContactor(params, name, disc), radius(0.0), halfLength(DBL_MAX)
+{
+  getVectorParameter(params, "Center", center, true);
+  getVectorParameter(params, "Axis", axis, true);
+  double magnitude = sqrt(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(magnitude == 0.0, "\n**** Error, rigid cylinder contactor \"Axis\" must be nonzero.\n");
+  for(int dof=0 ; dof<3 ; ++dof)
+    axis[dof] /= magnitude;
+  if(!params.isParameter("Radius"))
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Rigid cylinder contactor parameter \"Radius\" not specified.");
+  radius = params.get<double>("Radius");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(radius <= 0.0, "\n**** Error, rigid cylinder contactor \"Radius\" must be greater than zero.\n");
+  if(params.isParameter("Length")){
+    halfLength = 0.5*params.get<double>("Length");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(halfLength <= 0.0, "\n**** Error, rigid cylinder contactor \"Length\" must be greater than zero.\n");
+  }
+}
+
+bool PeridigmNS::RigidCylinderContactor::signedDistance(const double* x, double maxDistance, double& distance, double* normal) const
+{
+  // Split the position relative to the center into axial and radial parts
+  double r[3] = {x[0]-center[0], x[1]-center[1], x[2]-center[2]};
+  double h = r[0]*axis[0] + r[1]*axis[1] + r[2]*axis[2];
+  double radial[3] = {r[0]-h*axis[0], r[1]-h*axis[1], r[2]-h*axis[2]};
+  double radialMagnitude = sqrt(radial[0]*radial[0] + radial[1]*radial[1] + radial[2]*radial[2]);
+  double radialDistance = radialMagnitude - radius;
+  double axialDistance = fabs(h) - halfLength;
+  if(radialDistance > maxDistance || axialDistance > maxDistance)
+    return false;
+
+  double radialDirection[3] = {0.0, 0.0, 0.0};
+  if(radialMagnitude > 0.0){
+    for(int dof=0 ; dof<3 ; ++dof)
+      radialDirection[dof] = radial[dof]/radialMagnitude;
+  }
+  double axialSign = h < 0.0 ? -1.0 : 1.0;
+
+  if(radialDistance > 0.0 && axialDistance > 0.0){
+    // Closest point is on the rim of an end cap
+    distance = sqrt(radialDistance*radialDistance + axialDistance*axialDistance);
+    for(int dof=0 ; dof<3 ; ++dof)
+      normal[dof] = (radialDistance*radialDirection[dof] + axialDistance*axialSign*axis[dof])/distance;
+  }
+  else if(radialDistance > axialDistance){
+    distance = radialDistance;
+    for(int dof=0 ; dof<3 ; ++dof)
+      normal[dof] = radialDirection[dof];
+  }
+  else{
+    distance = axialDistance;
+    for(int dof=0 ; dof<3 ; ++dof)
+      normal[dof] = axialSign*axis[dof];
+  }
+  return distance <= maxDistance;
+}
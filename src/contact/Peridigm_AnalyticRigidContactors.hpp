@@ -0,0 +1,118 @@
+//! \file Peridigm_AnalyticRigidContactors.hpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_ANALYTICRIGIDCONTACTORS_HPP
+#define PERIDIGM_ANALYTICRIGIDCONTACTORS_HPP
+
+#include "Peridigm_RigidContactor.hpp"
+
+namespace PeridigmNS {
+
+  //! Rigid half-space bounded by a plane; the material lies on the side the normal points to.
+  class RigidPlaneContactor : public RigidContactor {
+  public:
+
+    //! Constructor.
+    RigidPlaneContactor(const Teuchos::ParameterList& params,
+                        const std::string& name,
+                        Teuchos::RCP<PeridigmNS::Discretization> disc);
+
+    //! Return the type of the contactor surface.
+    virtual std::string Type() const { return("Plane"); }
+
+    //! Signed distance to the plane.
+    virtual bool signedDistance(const double* x, double maxDistance, double& distance, double* normal) const;
+
+  protected:
+    double point[3];
+    double unitNormal[3];
+  };
+
+  //! Rigid sphere.
+  class RigidSphereContactor : public RigidContactor {
+  public:
+
+    //! Constructor.
+    RigidSphereContactor(const Teuchos::ParameterList& params,
+                         const std::string& name,
+                         Teuchos::RCP<PeridigmNS::Discretization> disc);
+
+    //! Return the type of the contactor surface.
+    virtual std::string Type() const { return("Sphere"); }
+
+    //! Signed distance to the sphere.
+    virtual bool signedDistance(const double* x, double maxDistance, double& distance, double* normal) const;
+
+  protected:
+    double center[3];
+    double radius;
+  };
+
+  //! Rigid circular cylinder with flat end caps, or of infinite length if no length is given.
+  class RigidCylinderContactor : public RigidContactor {
+  public:
+
+    //! Constructor.
+    RigidCylinderContactor(const Teuchos::ParameterList& params,
+                           const std::string& name,
+                           Teuchos::RCP<PeridigmNS::Discretization> disc);
+
+    //! Return the type of the contactor surface.
+    virtual std::string Type() const { return("Cylinder"); }
+
+    //! Signed distance to the cylinder.
+    virtual bool signedDistance(const double* x, double maxDistance, double& distance, double* normal) const;
+
+  protected:
+    double center[3];
+    double axis[3];
+    double radius;
+    double halfLength;
+  };
+}
+
+#endif // PERIDIGM_ANALYTICRIGIDCONTACTORS_HPP
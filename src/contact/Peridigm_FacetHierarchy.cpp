@@ -0,0 +1,253 @@
+//! \file Peridigm_FacetHierarchy.cpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_FacetHierarchy.hpp"
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+  //! Orders facets by the centroid coordinate along a given axis
+  struct CentroidLess {
+    CentroidLess(const std::vector<double>& centroids_, int axis_) : centroids(centroids_), axis(axis_) {}
+    bool operator()(int a, int b) const { return centroids[3*a+axis] < centroids[3*b+axis]; }
+    const std::vector<double>& centroids;
+    int axis;
+  };
+}
+
+void PeridigmNS::FacetHierarchy::build(const double* vertices, int numFacets_, int stride)
+{
+  numFacets = numFacets_;
+  vector<double> centroids(3*numFacets);
+  for(int iFacet=0 ; iFacet<numFacets ; ++iFacet){
+    const double* facet = vertices + stride*iFacet;
+    for(int dof=0 ; dof<3 ; ++dof)
+      centroids[3*iFacet+dof] = (facet[dof] + facet[3+dof] + facet[6+dof])/3.0;
+  }
+  facetOrder.resize(numFacets);
+  for(int iFacet=0 ; iFacet<numFacets ; ++iFacet)
+    facetOrder[iFacet] = iFacet;
+  nodes.clear();
+  if(numFacets == 0)
+    return;
+  nodes.reserve(2*numFacets);
+  buildNode(0, numFacets, centroids);
+  refit(vertices, stride);
+}
+
+int PeridigmNS::FacetHierarchy::buildNode(int first, int count, const vector<double>& centroids)
+{
+  const int maxFacetsPerLeaf = 4;
+  int nodeIndex = static_cast<int>(nodes.size());
+  Node node;
+  node.left = node.right = -1;
+  node.first = first;
+  node.count = count;
+  nodes.push_back(node);
+  if(count <= maxFacetsPerLeaf)
+    return nodeIndex;
+
+  // Split at the median centroid along the longest extent of the centroid bounds
+  double lower[3] = {1.0e100, 1.0e100, 1.0e100};
+  double upper[3] = {-1.0e100, -1.0e100, -1.0e100};
+  for(int i=first ; i<first+count ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof){
+      double c = centroids[3*facetOrder[i]+dof];
+      lower[dof] = min(lower[dof], c);
+      upper[dof] = max(upper[dof], c);
+    }
+  }
+  int axis = 0;
+  for(int dof=1 ; dof<3 ; ++dof){
+    if(upper[dof] - lower[dof] > upper[axis] - lower[axis])
+      axis = dof;
+  }
+  int half = count/2;
+  nth_element(facetOrder.begin() + first, facetOrder.begin() + first + half, facetOrder.begin() + first + count, CentroidLess(centroids, axis));
+
+  // Children are always created after their parent, refit() relies on this ordering
+  int left = buildNode(first, half, centroids);
+  int right = buildNode(first + half, count - half, centroids);
+  nodes[nodeIndex].left = left;
+  nodes[nodeIndex].right = right;
+  nodes[nodeIndex].count = 0;
+  return nodeIndex;
+}
+
+void PeridigmNS::FacetHierarchy::refit(const double* vertices, int stride)
+{
+  for(int iNode=static_cast<int>(nodes.size())-1 ; iNode>=0 ; --iNode){
+    Node& node = nodes[iNode];
+    double* box = node.box;
+    if(node.count > 0){
+      box[0] = box[1] = box[2] = 1.0e100;
+      box[3] = box[4] = box[5] = -1.0e100;
+      for(int i=node.first ; i<node.first+node.count ; ++i){
+        const double* facet = vertices + stride*facetOrder[i];
+        for(int iVertex=0 ; iVertex<3 ; ++iVertex){
+          for(int dof=0 ; dof<3 ; ++dof){
+            box[dof] = min(box[dof], facet[3*iVertex+dof]);
+            box[3+dof] = max(box[3+dof], facet[3*iVertex+dof]);
+          }
+        }
+      }
+    }
+    else{
+      const double* leftBox = nodes[node.left].box;
+      const double* rightBox = nodes[node.right].box;
+      for(int dof=0 ; dof<3 ; ++dof){
+        box[dof] = min(leftBox[dof], rightBox[dof]);
+        box[3+dof] = max(leftBox[3+dof], rightBox[3+dof]);
+      }
+    }
+  }
+}
+
+int PeridigmNS::FacetHierarchy::closestFacet(const double* vertices, int stride, const double* point, double maxDistance,
+                                             double* closestPoint, double& distanceSquared) const
+{
+  int closest = -1;
+  double bestDistanceSquared = maxDistance*maxDistance;
+  double candidate[3];
+  if(nodes.empty())
+    return closest;
+  vector<int> stack;
+  stack.reserve(64);
+  stack.push_back(0);
+  while(!stack.empty()){
+    const Node& node = nodes[stack.back()];
+    stack.pop_back();
+
+    // Skip nodes whose bounding box is farther than the closest facet found so far
+    double boxDistanceSquared = 0.0;
+    for(int dof=0 ; dof<3 ; ++dof){
+      double d = max(max(node.box[dof] - point[dof], point[dof] - node.box[3+dof]), 0.0);
+      boxDistanceSquared += d*d;
+    }
+    if(boxDistanceSquared > bestDistanceSquared)
+      continue;
+
+    if(node.count > 0){
+      for(int i=node.first ; i<node.first+node.count ; ++i){
+        const double* facet = vertices + stride*facetOrder[i];
+        closestPointOnTriangle(point, &facet[0], &facet[3], &facet[6], candidate);
+        double d2 = (point[0]-candidate[0])*(point[0]-candidate[0]) + (point[1]-candidate[1])*(point[1]-candidate[1]) + (point[2]-candidate[2])*(point[2]-candidate[2]);
+        if(d2 < bestDistanceSquared){
+          bestDistanceSquared = d2;
+          closest = facetOrder[i];
+          for(int dof=0 ; dof<3 ; ++dof)
+            closestPoint[dof] = candidate[dof];
+        }
+      }
+    }
+    else{
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+    }
+  }
+  distanceSquared = bestDistanceSquared;
+  return closest;
+}
+
+void PeridigmNS::FacetHierarchy::closestPointOnTriangle(const double* p, const double* a, const double* b, const double* c, double* q)
+{
+  // Voronoi region tests, see Ericson, Real-Time Collision Detection, section 5.1.5
+  double ab[3], ac[3], ap[3], bp[3], cp[3];
+  for(int dof=0 ; dof<3 ; ++dof){
+    ab[dof] = b[dof] - a[dof];
+    ac[dof] = c[dof] - a[dof];
+    ap[dof] = p[dof] - a[dof];
+    bp[dof] = p[dof] - b[dof];
+    cp[dof] = p[dof] - c[dof];
+  }
+  double d1 = ab[0]*ap[0] + ab[1]*ap[1] + ab[2]*ap[2];
+  double d2 = ac[0]*ap[0] + ac[1]*ap[1] + ac[2]*ap[2];
+  if(d1 <= 0.0 && d2 <= 0.0){
+    for(int dof=0 ; dof<3 ; ++dof) q[dof] = a[dof];
+    return;
+  }
+  double d3 = ab[0]*bp[0] + ab[1]*bp[1] + ab[2]*bp[2];
+  double d4 = ac[0]*bp[0] + ac[1]*bp[1] + ac[2]*bp[2];
+  if(d3 >= 0.0 && d4 <= d3){
+    for(int dof=0 ; dof<3 ; ++dof) q[dof] = b[dof];
+    return;
+  }
+  double vc = d1*d4 - d3*d2;
+  if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0){
+    double t = d1/(d1 - d3);
+    for(int dof=0 ; dof<3 ; ++dof) q[dof] = a[dof] + t*ab[dof];
+    return;
+  }
+  double d5 = ab[0]*cp[0] + ab[1]*cp[1] + ab[2]*cp[2];
+  double d6 = ac[0]*cp[0] + ac[1]*cp[1] + ac[2]*cp[2];
+  if(d6 >= 0.0 && d5 <= d6){
+    for(int dof=0 ; dof<3 ; ++dof) q[dof] = c[dof];
+    return;
+  }
+  double vb = d5*d2 - d1*d6;
+  if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0){
+    double t = d2/(d2 - d6);
+    for(int dof=0 ; dof<3 ; ++dof) q[dof] = a[dof] + t*ac[dof];
+    return;
+  }
+  double va = d3*d6 - d5*d4;
+  if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0){
+    double t = (d4 - d3)/((d4 - d3) + (d5 - d6));
+    for(int dof=0 ; dof<3 ; ++dof) q[dof] = b[dof] + t*(c[dof] - b[dof]);
+    return;
+  }
+  double denominator = 1.0/(va + vb + vc);
+  double s = vb*denominator;
+  double t = vc*denominator;
+  for(int dof=0 ; dof<3 ; ++dof) q[dof] = a[dof] + s*ab[dof] + t*ac[dof];
+}
+
+double PeridigmNS::FacetHierarchy::memorySizeInBytes() const
+{
+  return static_cast<double>(nodes.size())*sizeof(Node) + static_cast<double>(facetOrder.size())*sizeof(int);
+}
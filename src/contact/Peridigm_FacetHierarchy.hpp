@@ -0,0 +1,116 @@
+//! \file Peridigm_FacetHierarchy.hpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_FACETHIERARCHY_HPP
+#define PERIDIGM_FACETHIERARCHY_HPP
+
+#include <vector>
+
+namespace PeridigmNS {
+
+/*! \brief Bounding volume hierarchy over a set of triangular facets.
+ *
+ *  The facet vertices are owned by the caller and are passed to each function as a pointer to the first
+ *  facet and a stride, so that the nine vertex coordinates of facet i start at vertices[stride*i].  The
+ *  hierarchy is built with a median split along the longest axis and can be refit cheaply when the facets
+ *  move without changing the tree topology.
+ */
+class FacetHierarchy {
+
+public:
+
+  //! Constructor.
+  FacetHierarchy() : numFacets(0) {}
+
+  //! Destructor.
+  ~FacetHierarchy(){}
+
+  //! Returns true if the hierarchy has not been built.
+  bool empty() const { return nodes.empty(); }
+
+  //! Build the hierarchy over the given facets
+  void build(const double* vertices, int numFacets_, int stride);
+
+  //! Recompute the bounding boxes for the current facet positions
+  void refit(const double* vertices, int stride);
+
+  /*! \brief Find the closest facet to the given point within maxDistance.
+   *
+   *  Returns the facet index, or -1 if no facet is within maxDistance.  On success closestPoint and
+   *  distanceSquared are set to the closest point on the facet and its squared distance to the point.
+   */
+  int closestFacet(const double* vertices, int stride, const double* point, double maxDistance,
+                   double* closestPoint, double& distanceSquared) const;
+
+  //! Compute the closest point q on the triangle (a, b, c) to the point p
+  static void closestPointOnTriangle(const double* p, const double* a, const double* b, const double* c, double* q);
+
+  //! Number of bytes owned by the hierarchy
+  double memorySizeInBytes() const;
+
+protected:
+
+  //! Node of the hierarchy; leaves store a contiguous range of facetOrder
+  struct Node {
+    double box[6];
+    int left;
+    int right;
+    int first;
+    int count;
+  };
+
+  //! Recursively split the facets in facetOrder[first, first+count) and return the index of the new node
+  int buildNode(int first, int count, const std::vector<double>& centroids);
+
+  int numFacets;
+  std::vector<Node> nodes;
+  std::vector<int> facetOrder;
+};
+
+}
+
+#endif // PERIDIGM_FACETHIERARCHY_HPP
@@ -0,0 +1,406 @@
+//! \file Peridigm_NodeToFacetContact.cpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_NodeToFacetContact.hpp"
+#include <Teuchos_Assert.hpp>
+#include <Epetra_Comm.h>
+#include <algorithm>
+#include <sstream>
+#include <iterator>
+#include <cmath>
+#include <limits>
+
+using namespace std;
+
+PeridigmNS::NodeToFacetContact::NodeToFacetContact(const Teuchos::ParameterList& params,
+                                                   Teuchos::RCP<PeridigmNS::Discretization> disc)
+  : contactDistance(0.0), penaltyStiffness(0.0), frictionCoefficient(0.0), rebuildFrequency(10),
+    numGlobalFacets(0), numReceivedFacets(0), planIsStale(true), planMargin(0.0), evaluationsSinceRebuild(0)
+{
+  if(!params.isParameter("Contact Distance"))
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Node-to-facet contact parameter \"Contact Distance\" not specified.");
+  contactDistance = params.get<double>("Contact Distance");
+  if(!params.isParameter("Penalty Stiffness"))
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Node-to-facet contact parameter \"Penalty Stiffness\" not specified.");
+  penaltyStiffness = params.get<double>("Penalty Stiffness");
+  if(params.isParameter("Friction Coefficient"))
+    frictionCoefficient = params.get<double>("Friction Coefficient");
+  if(params.isParameter("Hierarchy Rebuild Frequency"))
+    rebuildFrequency = params.get<int>("Hierarchy Rebuild Frequency");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(contactDistance <= 0.0, "\n**** Error, node-to-facet \"Contact Distance\" must be greater than zero.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(rebuildFrequency < 1, "\n**** Error, node-to-facet \"Hierarchy Rebuild Frequency\" must be at least one.\n");
+  planMargin = contactDistance;
+
+  // Parse the space-delimited lists of master and slave block names
+  set<int> masterBlockIds;
+  string blockNameLists[2] = { params.get<string>("Master Blocks"), params.get<string>("Slave Blocks") };
+  for(int iList=0 ; iList<2 ; ++iList){
+    istringstream iss(blockNameLists[iList]);
+    vector<string> blockNames;
+    copy(istream_iterator<string>(iss),
+         istream_iterator<string>(),
+         back_inserter<vector<string> >(blockNames));
+    for(vector<string>::const_iterator it=blockNames.begin() ; it!=blockNames.end() ; ++it){
+      int blockId = disc->blockNameToBlockId(*it);
+      if(iList == 0)
+        masterBlockIds.insert(blockId);
+      else
+        slaveBlockIds.insert(blockId);
+    }
+  }
+  // A point near the skin of its own block is always within the contact layer, so a block cannot be both master and slave
+  for(set<int>::const_iterator it=slaveBlockIds.begin() ; it!=slaveBlockIds.end() ; ++it)
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(masterBlockIds.find(*it) != masterBlockIds.end(),
+                                "\n**** Error, a block cannot be both a node-to-facet master block and a slave block.\n");
+
+  Teuchos::RCP<const PeridigmNS::SkinFacetData> skinFacets = disc->getSkinFacets();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(skinFacets.is_null(),
+                              "\n**** Error, node-to-facet contact requires skin facets, set \"Extract Skin Facets\" in the Discretization section.\n");
+
+  // Keep the facets of the master blocks, along with the reference position of their owning point
+  Teuchos::RCP<const Epetra_Vector> initialX = disc->getInitialX();
+  const Epetra_BlockMap& initialXMap = initialX->Map();
+  for(int iFacet=0 ; iFacet<skinFacets->NumFacets() ; ++iFacet){
+    if(masterBlockIds.find(skinFacets->blockIds[iFacet]) == masterBlockIds.end())
+      continue;
+    int ownerGlobalId = skinFacets->elementGlobalIds[iFacet];
+    int ownerLocalId = initialXMap.LID(ownerGlobalId);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(ownerLocalId == -1, "\n**** Error, skin facet owner is not a locally-owned point.\n");
+    facetOwnerGlobalIds.push_back(ownerGlobalId);
+    for(int i=0 ; i<9 ; ++i)
+      facetReferenceVertices.push_back(skinFacets->vertexCoordinates[9*iFacet+i]);
+    for(int dof=0 ; dof<3 ; ++dof)
+      facetOwnerReferencePositions.push_back((*initialX)[3*ownerLocalId+dof]);
+  }
+
+  const Epetra_Comm& comm = initialXMap.Comm();
+  int numLocalFacets = static_cast<int>(facetOwnerGlobalIds.size());
+  comm.SumAll(&numLocalFacets, &numGlobalFacets, 1);
+
+  // The facet owners are gathered from the contact map, which changes when the contact search rebalances the points
+  vector<int> ownerGlobalIds(facetOwnerGlobalIds);
+  sort(ownerGlobalIds.begin(), ownerGlobalIds.end());
+  ownerGlobalIds.erase(unique(ownerGlobalIds.begin(), ownerGlobalIds.end()), ownerGlobalIds.end());
+  facetOwnerIndices.resize(numLocalFacets);
+  for(int i=0 ; i<numLocalFacets ; ++i)
+    facetOwnerIndices[i] = static_cast<int>(lower_bound(ownerGlobalIds.begin(), ownerGlobalIds.end(), facetOwnerGlobalIds[i]) - ownerGlobalIds.begin());
+  int numOwners = static_cast<int>(ownerGlobalIds.size());
+  int* ownerIds = numOwners > 0 ? &ownerGlobalIds[0] : 0;
+  ownerMap = Teuchos::rcp(new Epetra_BlockMap(-1, numOwners, ownerIds, 3, 0, comm));
+  ownerY = Teuchos::rcp(new Epetra_Vector(*ownerMap));
+  ownerV = Teuchos::rcp(new Epetra_Vector(*ownerMap));
+  ownerForce = Teuchos::rcp(new Epetra_Vector(*ownerMap));
+
+  facetState.resize(12*numLocalFacets);
+  facetForce.resize(3*numLocalFacets);
+}
+
+void PeridigmNS::NodeToFacetContact::setContactMap(const Epetra_BlockMap& threeDimensionalMap)
+{
+  ownerImporter = Teuchos::rcp(new Epetra_Import(*ownerMap, threeDimensionalMap));
+  reactionForce = Teuchos::rcp(new Epetra_Vector(threeDimensionalMap));
+  planIsStale = true;
+}
+
+void PeridigmNS::NodeToFacetContact::computeForce(const Epetra_Vector& blockIds,
+                                                  const Epetra_Vector& volume,
+                                                  const Epetra_Vector& y,
+                                                  const Epetra_Vector& v,
+                                                  Epetra_Vector& forceDensity)
+{
+  if(numGlobalFacets == 0)
+    return;
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(ownerImporter.is_null() || !ownerImporter->SourceMap().SameBlockMapDataAs(y.Map()),
+                              "\n**** Error, NodeToFacetContact::setContactMap() must be called whenever the contact map changes.\n");
+
+  // Gather the current state of the facet owners, which may be owned by other processors in the contact map
+  ownerY->Import(y, *ownerImporter, Insert);
+  ownerV->Import(v, *ownerImporter, Insert);
+
+  const int numLocalFacets = static_cast<int>(facetOwnerGlobalIds.size());
+
+  // Move the facets rigidly with their owning points
+  for(int iFacet=0 ; iFacet<numLocalFacets ; ++iFacet){
+    int ownerIndex = facetOwnerIndices[iFacet];
+    double* state = &facetState[12*iFacet];
+    for(int dof=0 ; dof<3 ; ++dof){
+      double displacement = (*ownerY)[3*ownerIndex+dof] - facetOwnerReferencePositions[3*iFacet+dof];
+      for(int iVertex=0 ; iVertex<3 ; ++iVertex)
+        state[3*iVertex+dof] = facetReferenceVertices[9*iFacet+3*iVertex+dof] + displacement;
+      state[9+dof] = (*ownerV)[3*ownerIndex+dof];
+    }
+  }
+
+  // The communication plan is rebuilt along with the hierarchy, and earlier if the points and facets have moved
+  // farther than the margin added to the slave bounding boxes since it was built
+  const Epetra_Comm& comm = y.Map().Comm();
+  const int numProcs = comm.NumProc();
+  const int myPID = comm.MyPID();
+  bool rebuildPlan = planIsStale || evaluationsSinceRebuild >= rebuildFrequency;
+  if(!rebuildPlan){
+    double localMaxDisplacement[2] = {0.0, 0.0}, maxDisplacement[2];
+    for(int iPoint=0 ; iPoint<volume.MyLength() ; ++iPoint){
+      if(slaveBlockIds.find(static_cast<int>(blockIds[iPoint])) == slaveBlockIds.end())
+        continue;
+      double squared = 0.0;
+      for(int dof=0 ; dof<3 ; ++dof)
+        squared += (y[3*iPoint+dof] - planY[3*iPoint+dof])*(y[3*iPoint+dof] - planY[3*iPoint+dof]);
+      localMaxDisplacement[0] = max(localMaxDisplacement[0], squared);
+    }
+    for(int i=0 ; i<ownerY->MyLength()/3 ; ++i){
+      double squared = 0.0;
+      for(int dof=0 ; dof<3 ; ++dof)
+        squared += ((*ownerY)[3*i+dof] - planOwnerY[3*i+dof])*((*ownerY)[3*i+dof] - planOwnerY[3*i+dof]);
+      localMaxDisplacement[1] = max(localMaxDisplacement[1], squared);
+    }
+    comm.MaxAll(localMaxDisplacement, maxDisplacement, 2);
+    rebuildPlan = sqrt(maxDisplacement[0]) + sqrt(maxDisplacement[1]) > planMargin;
+  }
+
+  if(rebuildPlan){
+
+    // Bounding box of the local slave points, padded by the contact distance and the margin, on every processor
+    double slaveBox[6];
+    for(int dof=0 ; dof<3 ; ++dof){
+      slaveBox[dof] = numeric_limits<double>::max();
+      slaveBox[3+dof] = -numeric_limits<double>::max();
+    }
+    const double padding = contactDistance + planMargin;
+    for(int iPoint=0 ; iPoint<volume.MyLength() ; ++iPoint){
+      if(slaveBlockIds.find(static_cast<int>(blockIds[iPoint])) == slaveBlockIds.end())
+        continue;
+      for(int dof=0 ; dof<3 ; ++dof){
+        slaveBox[dof] = min(slaveBox[dof], y[3*iPoint+dof] - padding);
+        slaveBox[3+dof] = max(slaveBox[3+dof], y[3*iPoint+dof] + padding);
+      }
+    }
+    vector<double> slaveBoxes(6*numProcs);
+    comm.GatherAll(slaveBox, &slaveBoxes[0], 6);
+
+    // Send each local facet to the processors whose slave points it may reach; the facets kept on this
+    // processor are copied directly and the others are grouped by destination processor
+    localFacetIndices.clear();
+    sendFacetIndices.clear();
+    sendProcs.clear();
+    for(int proc=0 ; proc<numProcs ; ++proc){
+      const double* box = &slaveBoxes[6*proc];
+      for(int iFacet=0 ; iFacet<numLocalFacets ; ++iFacet){
+        const double* state = &facetState[12*iFacet];
+        bool overlap = true;
+        for(int dof=0 ; dof<3 && overlap ; ++dof){
+          double facetMin = min(state[dof], min(state[3+dof], state[6+dof]));
+          double facetMax = max(state[dof], max(state[3+dof], state[6+dof]));
+          overlap = facetMin <= box[3+dof] && facetMax >= box[dof];
+        }
+        if(!overlap)
+          continue;
+        if(proc == myPID){
+          localFacetIndices.push_back(iFacet);
+        }
+        else{
+          sendFacetIndices.push_back(iFacet);
+          sendProcs.push_back(proc);
+        }
+      }
+    }
+    numReceivedFacets = 0;
+    if(numProcs > 1){
+      const int numSent = static_cast<int>(sendFacetIndices.size());
+      facetDistributor = Teuchos::rcp(comm.CreateDistributor());
+      int err = facetDistributor->CreateFromSends(numSent, numSent > 0 ? &sendProcs[0] : 0, true, numReceivedFacets);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n**** Error in NodeToFacetContact::computeForce(), CreateFromSends() returned nonzero error code.\n");
+    }
+
+    // Positions at which the plan was built, for the displacement check on the following evaluations
+    planY.assign(y.Values(), y.Values() + y.MyLength());
+    planOwnerY.assign(ownerY->Values(), ownerY->Values() + ownerY->MyLength());
+    planIsStale = false;
+  }
+
+  const int numKept = static_cast<int>(localFacetIndices.size());
+  const int numSent = static_cast<int>(sendFacetIndices.size());
+  const int numGatheredFacets = numKept + numReceivedFacets;
+  gatheredFacetState.resize(12*max(1, numGatheredFacets));
+  for(int i=0 ; i<numKept ; ++i){
+    int iFacet = localFacetIndices[i];
+    for(int j=0 ; j<12 ; ++j)
+      gatheredFacetState[12*i+j] = facetState[12*iFacet+j];
+  }
+  if(numProcs > 1){
+    sendBuffer.resize(12*max(1, numSent));
+    for(int i=0 ; i<numSent ; ++i){
+      int iFacet = sendFacetIndices[i];
+      for(int j=0 ; j<12 ; ++j)
+        sendBuffer[12*i+j] = facetState[12*iFacet+j];
+    }
+    // The receive buffer is sized so that the distributor does not reallocate it
+    char* importBuffer = reinterpret_cast<char*>(&gatheredFacetState[0] + 12*numKept);
+    int importBufferLength = static_cast<int>(12*numReceivedFacets*sizeof(double));
+    int err = facetDistributor->Do(reinterpret_cast<char*>(&sendBuffer[0]), 12*static_cast<int>(sizeof(double)), importBufferLength, importBuffer);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n**** Error in NodeToFacetContact::computeForce(), Do() returned nonzero error code.\n");
+  }
+
+  // The gathered facets change only with the plan, in between the hierarchy is refit to the new positions
+  const double* gatheredFacetValues = &gatheredFacetState[0];
+  if(rebuildPlan){
+    hierarchy.build(gatheredFacetValues, numGatheredFacets, 12);
+    evaluationsSinceRebuild = 0;
+  }
+  else{
+    hierarchy.refit(gatheredFacetValues, 12);
+  }
+  evaluationsSinceRebuild += 1;
+
+  // Penalty force on each slave point from the closest facet, reactions are accumulated on the gathered facets
+  gatheredFacetForce.assign(3*max(1, numGatheredFacets), 0.0);
+  const double tolerance = 1.0e-12*contactDistance;
+  double closestPoint[3], direction[3], relativeVelocity[3], force[3];
+  for(int iPoint=0 ; iPoint<volume.MyLength() ; ++iPoint){
+    if(slaveBlockIds.find(static_cast<int>(blockIds[iPoint])) == slaveBlockIds.end())
+      continue;
+
+    const double* point = &y[3*iPoint];
+    double distanceSquared;
+    int iFacet = hierarchy.closestFacet(gatheredFacetValues, 12, point, contactDistance, closestPoint, distanceSquared);
+    if(iFacet == -1)
+      continue;
+
+    // Signed distance along the outward facet normal; away from the facet interior the direction follows the
+    // vector to the closest point so that the force varies smoothly across edges and vertices
+    const double* state = &gatheredFacetState[12*iFacet];
+    double normal[3];
+    normal[0] = (state[4]-state[1])*(state[8]-state[2]) - (state[5]-state[2])*(state[7]-state[1]);
+    normal[1] = (state[5]-state[2])*(state[6]-state[0]) - (state[3]-state[0])*(state[8]-state[2]);
+    normal[2] = (state[3]-state[0])*(state[7]-state[1]) - (state[4]-state[1])*(state[6]-state[0]);
+    double normalMagnitude = sqrt(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+    if(normalMagnitude == 0.0)
+      continue;
+    double distance = sqrt(distanceSquared);
+    double side = 0.0;
+    for(int dof=0 ; dof<3 ; ++dof)
+      side += (point[dof] - closestPoint[dof])*normal[dof];
+    double sign = side < 0.0 ? -1.0 : 1.0;
+    for(int dof=0 ; dof<3 ; ++dof)
+      direction[dof] = distance > tolerance ? sign*(point[dof] - closestPoint[dof])/distance : normal[dof]/normalMagnitude;
+
+    double penetration = contactDistance - sign*distance;
+    if(penetration <= 0.0)
+      continue;
+    double normalForce = penaltyStiffness*penetration;
+    for(int dof=0 ; dof<3 ; ++dof)
+      force[dof] = normalForce*direction[dof];
+
+    if(frictionCoefficient != 0.0){
+      double normalVelocity = 0.0;
+      for(int dof=0 ; dof<3 ; ++dof){
+        relativeVelocity[dof] = v[3*iPoint+dof] - state[9+dof];
+        normalVelocity += relativeVelocity[dof]*direction[dof];
+      }
+      for(int dof=0 ; dof<3 ; ++dof)
+        relativeVelocity[dof] -= normalVelocity*direction[dof];
+      double tangentialSpeed = sqrt(relativeVelocity[0]*relativeVelocity[0] + relativeVelocity[1]*relativeVelocity[1] + relativeVelocity[2]*relativeVelocity[2]);
+      if(tangentialSpeed > 0.0){
+        for(int dof=0 ; dof<3 ; ++dof)
+          force[dof] -= frictionCoefficient*normalForce*relativeVelocity[dof]/tangentialSpeed;
+      }
+    }
+
+    for(int dof=0 ; dof<3 ; ++dof){
+      forceDensity[3*iPoint+dof] += force[dof];
+      gatheredFacetForce[3*iFacet+dof] -= force[dof]*volume[iPoint];
+    }
+  }
+
+  // Return the reactions to the processors that own the facets through the reverse of the gather
+  facetForce.assign(3*numLocalFacets, 0.0);
+  for(int i=0 ; i<numKept ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof)
+      facetForce[3*localFacetIndices[i]+dof] += gatheredFacetForce[3*i+dof];
+  }
+  if(numProcs > 1){
+    returnedFacetForce.resize(3*max(1, numSent));
+    char* importBuffer = reinterpret_cast<char*>(&returnedFacetForce[0]);
+    int importBufferLength = static_cast<int>(3*numSent*sizeof(double));
+    int err = facetDistributor->DoReverse(reinterpret_cast<char*>(&gatheredFacetForce[0] + 3*numKept), 3*static_cast<int>(sizeof(double)), importBufferLength, importBuffer);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n**** Error in NodeToFacetContact::computeForce(), DoReverse() returned nonzero error code.\n");
+    for(int i=0 ; i<numSent ; ++i){
+      for(int dof=0 ; dof<3 ; ++dof)
+        facetForce[3*sendFacetIndices[i]+dof] += returnedFacetForce[3*i+dof];
+    }
+  }
+
+  // Sum the reactions on the facet owners, then on the processors that own the points
+  ownerForce->PutScalar(0.0);
+  for(int iFacet=0 ; iFacet<numLocalFacets ; ++iFacet){
+    int ownerIndex = facetOwnerIndices[iFacet];
+    for(int dof=0 ; dof<3 ; ++dof)
+      (*ownerForce)[3*ownerIndex+dof] += facetForce[3*iFacet+dof];
+  }
+  reactionForce->PutScalar(0.0);
+  reactionForce->Export(*ownerForce, *ownerImporter, Add);
+  for(int iPoint=0 ; iPoint<volume.MyLength() ; ++iPoint){
+    for(int dof=0 ; dof<3 ; ++dof)
+      forceDensity[3*iPoint+dof] += (*reactionForce)[3*iPoint+dof]/volume[iPoint];
+  }
+}
+
+void PeridigmNS::NodeToFacetContact::accumulateMemoryUsage(std::map<std::string, double>& bytesPerCategory) const
+{
+  double bytes = 0.0;
+  bytes += static_cast<double>(facetOwnerGlobalIds.size() + facetOwnerIndices.size())*sizeof(int);
+  bytes += static_cast<double>(localFacetIndices.size() + sendFacetIndices.size() + sendProcs.size())*sizeof(int);
+  bytes += static_cast<double>(ownerY->MyLength() + ownerV->MyLength() + ownerForce->MyLength())*sizeof(double);
+  if(!reactionForce.is_null())
+    bytes += static_cast<double>(reactionForce->MyLength())*sizeof(double);
+  bytes += static_cast<double>(facetReferenceVertices.size() + facetOwnerReferencePositions.size())*sizeof(double);
+  bytes += static_cast<double>(facetState.size() + facetForce.size() + sendBuffer.size() + returnedFacetForce.size())*sizeof(double);
+  bytes += static_cast<double>(gatheredFacetState.size() + gatheredFacetForce.size())*sizeof(double);
+  bytes += static_cast<double>(planY.size() + planOwnerY.size())*sizeof(double);
+  bytes += hierarchy.memorySizeInBytes();
+  bytesPerCategory["Contact Data"] += bytes;
+}
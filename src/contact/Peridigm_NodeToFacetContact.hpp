@@ -0,0 +1,196 @@
+//! \file Peridigm_NodeToFacetContact.hpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_NODETOFACETCONTACT_HPP
+#define PERIDIGM_NODETOFACETCONTACT_HPP
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Epetra_BlockMap.h>
+#include <Epetra_Vector.h>
+#include <Epetra_Import.h>
+#include <Epetra_Distributor.h>
+#include "Peridigm_Discretization.hpp"
+#include "Peridigm_SkinFacetData.hpp"
+#include "Peridigm_FacetHierarchy.hpp"
+#include <vector>
+#include <set>
+#include <map>
+#include <string>
+
+namespace PeridigmNS {
+
+/*! \brief Node-to-facet penalty contact between peridynamic points and the skin of an Exodus mesh.
+ *
+ *  Each processor gathers the triangulated skin facets of the master blocks whose bounding box overlaps the
+ *  bounding box of its slave points padded by the contact distance, and a bounding volume hierarchy over these
+ *  facets is used to find the closest facet to each locally-owned point in the slave blocks.  The bounding boxes are
+ *  padded by a further margin so that the gathered facets, and the communication plan that gathers them, can be reused
+ *  until the hierarchy is rebuilt or the points and facets have moved farther than the margin.  Points closer than the contact distance to the skin, or inside it, are pushed out along the
+ *  facet normal with a penalty force proportional to the penetration into the contact layer, and an equal and
+ *  opposite reaction is applied to the point that owns the facet.  Facets translate rigidly with their owning
+ *  point.
+ */
+class NodeToFacetContact {
+
+public:
+
+  //! Constructor.
+  NodeToFacetContact(const Teuchos::ParameterList& params,
+                     Teuchos::RCP<PeridigmNS::Discretization> disc);
+
+  //! Destructor.
+  ~NodeToFacetContact(){}
+
+  //! Total number of master facets across all processors.
+  int NumGlobalFacets() const { return numGlobalFacets; }
+
+  /*! \brief Set the (non-overlapping) three-dimensional map of the vectors passed to computeForce().
+   *
+   *  Must be called before the first evaluation and whenever the contact maps change, e.g., after a contact rebalance.
+   */
+  void setContactMap(const Epetra_BlockMap& threeDimensionalMap);
+
+  /*! \brief Add the node-to-facet contact force density to the given vector.
+   *
+   *  All vectors are defined on the map given to setContactMap().  The owners of the facets need not be locally
+   *  owned, their positions and velocities are gathered from the processors that own them in this map.
+   */
+  void computeForce(const Epetra_Vector& blockIds,
+                    const Epetra_Vector& volume,
+                    const Epetra_Vector& y,
+                    const Epetra_Vector& v,
+                    Epetra_Vector& forceDensity);
+
+  //! Adds the number of bytes owned by the gathered facets and the bounding volume hierarchy to the given map.
+  void accumulateMemoryUsage(std::map<std::string, double>& bytesPerCategory) const;
+
+protected:
+
+  //! Contact parameters
+  double contactDistance;
+  double penaltyStiffness;
+  double frictionCoefficient;
+  int rebuildFrequency;
+
+  //! Block ids of the points that are checked for contact against the facets
+  std::set<int> slaveBlockIds;
+
+  //! Local master facets, reference vertex coordinates and owning point
+  std::vector<int> facetOwnerGlobalIds;
+  std::vector<double> facetReferenceVertices;
+  std::vector<double> facetOwnerReferencePositions;
+
+  //! Index of the owning point of each local facet in ownerMap
+  std::vector<int> facetOwnerIndices;
+
+  //! Map of the distinct owners of the local facets, and the importer that gathers them from the contact map
+  Teuchos::RCP<Epetra_BlockMap> ownerMap;
+  Teuchos::RCP<const Epetra_Import> ownerImporter;
+
+  //! Current position and velocity of the facet owners, and the reaction force summed on each owner
+  Teuchos::RCP<Epetra_Vector> ownerY;
+  Teuchos::RCP<Epetra_Vector> ownerV;
+  Teuchos::RCP<Epetra_Vector> ownerForce;
+
+  //! Reaction force on the points of the contact map
+  Teuchos::RCP<Epetra_Vector> reactionForce;
+
+  //! Number of master facets across all processors
+  int numGlobalFacets;
+
+  //! Current vertex coordinates (nine values) and owner velocity (three values) of each local facet
+  std::vector<double> facetState;
+
+  //! Reaction force on each local facet
+  std::vector<double> facetForce;
+
+  //! Local facets kept on this processor, and those sent to other processors grouped by destination processor
+  std::vector<int> localFacetIndices;
+  std::vector<int> sendFacetIndices;
+  std::vector<int> sendProcs;
+  std::vector<double> sendBuffer;
+  std::vector<double> returnedFacetForce;
+
+  //! Communication plan for the facets sent to other processors, and the number of facets it receives
+  Teuchos::RCP<Epetra_Distributor> facetDistributor;
+  int numReceivedFacets;
+
+  //! Flag indicating that the plan must be rebuilt on the next evaluation, set when the contact map changes
+  bool planIsStale;
+
+  //! Padding of the slave bounding boxes beyond the contact distance, the plan is rebuilt once the largest slave point
+  //! displacement plus the largest facet displacement since it was built exceeds this margin
+  double planMargin;
+
+  //! Positions of the points in the contact map and of the facet owners when the plan was built
+  std::vector<double> planY;
+  std::vector<double> planOwnerY;
+
+  //! Gathered facets, the local facets kept on this processor followed by those received from other processors
+  std::vector<double> gatheredFacetState;
+  std::vector<double> gatheredFacetForce;
+
+  //! Bounding volume hierarchy over the gathered facets
+  FacetHierarchy hierarchy;
+  int evaluationsSinceRebuild;
+
+private:
+
+  // Private to prohibit use.
+  NodeToFacetContact();
+
+  // Private to prohibit use.
+  NodeToFacetContact(const NodeToFacetContact&);
+
+  // Private to prohibit use.
+  NodeToFacetContact& operator=(const NodeToFacetContact&);
+};
+
+}
+
+#endif // PERIDIGM_NODETOFACETCONTACT_HPP
@@ -0,0 +1,174 @@
+//! \file Peridigm_RigidContactor.cpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_RigidContactor.hpp"
+#include <Teuchos_Assert.hpp>
+#include <Epetra_Comm.h>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <iterator>
+#include <cmath>
+
+using namespace std;
+
+PeridigmNS::RigidContactor::RigidContactor(const Teuchos::ParameterList& params,
+                                           const std::string& name_,
+                                           Teuchos::RCP<PeridigmNS::Discretization> disc)
+  : name(name_), contactDistance(0.0), penaltyStiffness(0.0), frictionCoefficient(0.0), integrateMotion(false), mass(0.0)
+{
+  for(int dof=0 ; dof<3 ; ++dof)
+    displacement[dof] = velocity[dof] = acceleration[dof] = force[dof] = 0.0;
+
+  if(params.isParameter("Contact Distance"))
+    contactDistance = params.get<double>("Contact Distance");
+  if(!params.isParameter("Penalty Stiffness"))
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Rigid contactor parameter \"Penalty Stiffness\" not specified.");
+  penaltyStiffness = params.get<double>("Penalty Stiffness");
+  if(params.isParameter("Friction Coefficient"))
+    frictionCoefficient = params.get<double>("Friction Coefficient");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(contactDistance < 0.0, "\n**** Error, rigid contactor \"Contact Distance\" must be non-negative.\n");
+
+  // Parse the optional space-delimited list of block names
+  if(params.isParameter("Blocks")){
+    istringstream iss(params.get<string>("Blocks"));
+    vector<string> blockNames;
+    copy(istream_iterator<string>(iss),
+         istream_iterator<string>(),
+         back_inserter<vector<string> >(blockNames));
+    for(vector<string>::const_iterator it=blockNames.begin() ; it!=blockNames.end() ; ++it)
+      blockIds.insert(disc->blockNameToBlockId(*it));
+  }
+
+  string motion("Prescribed");
+  if(params.isParameter("Motion"))
+    motion = params.get<string>("Motion");
+  if(motion == "Integrated"){
+    integrateMotion = true;
+    if(!params.isParameter("Mass"))
+      TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Rigid contactor parameter \"Mass\" not specified, it is required for \"Integrated\" motion.");
+    mass = params.get<double>("Mass");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(mass <= 0.0, "\n**** Error, rigid contactor \"Mass\" must be greater than zero.\n");
+    getVectorParameter(params, "Acceleration", acceleration, false);
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(motion != "Prescribed", "\n**** Error, rigid contactor \"Motion\" must be \"Prescribed\" or \"Integrated\".\n");
+  }
+  getVectorParameter(params, "Velocity", velocity, false);
+}
+
+void PeridigmNS::RigidContactor::getVectorParameter(const Teuchos::ParameterList& params, const std::string& parameterName, double* value, bool required)
+{
+  const string suffix[3] = {" X", " Y", " Z"};
+  for(int dof=0 ; dof<3 ; ++dof){
+    string fullName = parameterName + suffix[dof];
+    if(params.isParameter(fullName))
+      value[dof] = params.get<double>(fullName);
+    else
+      TEUCHOS_TEST_FOR_EXCEPTION(required, Teuchos::Exceptions::InvalidParameter, "Rigid contactor parameter \"" + fullName + "\" not specified.");
+  }
+}
+
+void PeridigmNS::RigidContactor::computeForce(const Epetra_Vector& pointBlockIds,
+                                              const Epetra_Vector& volume,
+                                              const Epetra_Vector& y,
+                                              const Epetra_Vector& v,
+                                              Epetra_Vector& forceDensity)
+{
+  double localForce[3] = {0.0, 0.0, 0.0};
+  double x[3], normal[3], relativeVelocity[3], pointForce[3];
+  for(int iPoint=0 ; iPoint<volume.MyLength() ; ++iPoint){
+    if(!blockIds.empty() && blockIds.find(static_cast<int>(pointBlockIds[iPoint])) == blockIds.end())
+      continue;
+
+    // Evaluate the distance in the initial placement of the contactor
+    for(int dof=0 ; dof<3 ; ++dof)
+      x[dof] = y[3*iPoint+dof] - displacement[dof];
+    double distance;
+    if(!signedDistance(x, contactDistance, distance, normal))
+      continue;
+    double penetration = contactDistance - distance;
+    if(penetration <= 0.0)
+      continue;
+
+    double normalForce = penaltyStiffness*penetration;
+    for(int dof=0 ; dof<3 ; ++dof)
+      pointForce[dof] = normalForce*normal[dof];
+
+    if(frictionCoefficient != 0.0){
+      double normalVelocity = 0.0;
+      for(int dof=0 ; dof<3 ; ++dof){
+        relativeVelocity[dof] = v[3*iPoint+dof] - velocity[dof];
+        normalVelocity += relativeVelocity[dof]*normal[dof];
+      }
+      for(int dof=0 ; dof<3 ; ++dof)
+        relativeVelocity[dof] -= normalVelocity*normal[dof];
+      double tangentialSpeed = sqrt(relativeVelocity[0]*relativeVelocity[0] + relativeVelocity[1]*relativeVelocity[1] + relativeVelocity[2]*relativeVelocity[2]);
+      if(tangentialSpeed > 0.0){
+        for(int dof=0 ; dof<3 ; ++dof)
+          pointForce[dof] -= frictionCoefficient*normalForce*relativeVelocity[dof]/tangentialSpeed;
+      }
+    }
+
+    for(int dof=0 ; dof<3 ; ++dof){
+      forceDensity[3*iPoint+dof] += pointForce[dof];
+      localForce[dof] -= pointForce[dof]*volume[iPoint];
+    }
+  }
+  volume.Map().Comm().SumAll(localForce, force, 3);
+}
+
+void PeridigmNS::RigidContactor::updateMotion(double dt)
+{
+  // Semi-implicit Euler, the velocity is updated with the current reaction before the position
+  if(integrateMotion){
+    for(int dof=0 ; dof<3 ; ++dof)
+      velocity[dof] += dt*(force[dof]/mass + acceleration[dof]);
+  }
+  for(int dof=0 ; dof<3 ; ++dof)
+    displacement[dof] += dt*velocity[dof];
+}
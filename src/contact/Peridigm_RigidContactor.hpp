@@ -0,0 +1,152 @@
+//! \file Peridigm_RigidContactor.hpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_RIGIDCONTACTOR_HPP
+#define PERIDIGM_RIGIDCONTACTOR_HPP
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Epetra_Vector.h>
+#include "Peridigm_Discretization.hpp"
+#include <string>
+#include <set>
+
+namespace PeridigmNS {
+
+/*! \brief Base class for rigid contactors described by an analytic or triangulated surface.
+ *
+ *  A rigid contactor translates with a prescribed constant velocity, or with a velocity obtained by integrating
+ *  the reaction to the contact forces it applies.  Material points closer to the surface than the contact distance,
+ *  or inside the contactor, are pushed out along the surface normal with a penalty force proportional to the
+ *  penetration into the contact layer.  Derived classes provide the signed distance to the surface.
+ */
+class RigidContactor {
+
+public:
+
+  //! Constructor.
+  RigidContactor(const Teuchos::ParameterList& params,
+                 const std::string& name,
+                 Teuchos::RCP<PeridigmNS::Discretization> disc);
+
+  //! Destructor.
+  virtual ~RigidContactor(){}
+
+  //! Return the type of the contactor surface.
+  virtual std::string Type() const = 0;
+
+  //! Return the user-defined name of the contactor.
+  const std::string& Name() const { return name; }
+
+  /*! \brief Signed distance from the point x, given in the initial placement of the contactor, to the contactor surface.
+   *
+   *  The distance is positive outside the contactor.  Returns false if the distance to the surface is known to be
+   *  larger than maxDistance, otherwise sets distance and the outward unit normal at the closest surface point.
+   */
+  virtual bool signedDistance(const double* x, double maxDistance, double& distance, double* normal) const = 0;
+
+  /*! \brief Add the contact force density on the material points to the given vector and record the reaction on the contactor.
+   *
+   *  All vectors are defined on the same (non-overlapping) map.
+   */
+  void computeForce(const Epetra_Vector& pointBlockIds,
+                    const Epetra_Vector& volume,
+                    const Epetra_Vector& y,
+                    const Epetra_Vector& v,
+                    Epetra_Vector& forceDensity);
+
+  //! Advance the position (and, for integrated motion, the velocity) of the contactor over one time step.
+  void updateMotion(double dt);
+
+  //! Total contact force on the contactor from the last call to computeForce(), summed over all processors.
+  const double* getForce() const { return force; }
+
+  //! Displacement of the contactor from its initial placement.
+  const double* getDisplacement() const { return displacement; }
+
+  //! Velocity of the contactor.
+  const double* getVelocity() const { return velocity; }
+
+protected:
+
+  //! Read the three components of a vector parameter given as "<name> X", "<name> Y", and "<name> Z".
+  static void getVectorParameter(const Teuchos::ParameterList& params, const std::string& parameterName, double* value, bool required);
+
+  //! User-defined name
+  std::string name;
+
+  //! Contact parameters
+  double contactDistance;
+  double penaltyStiffness;
+  double frictionCoefficient;
+
+  //! Blocks whose points interact with the contactor; all blocks if empty
+  std::set<int> blockIds;
+
+  //! Rigid-body motion
+  bool integrateMotion;
+  double mass;
+  double displacement[3];
+  double velocity[3];
+  double acceleration[3];
+  double force[3];
+
+private:
+
+  // Private to prohibit use.
+  RigidContactor();
+
+  // Private to prohibit use.
+  RigidContactor(const RigidContactor&);
+
+  // Private to prohibit use.
+  RigidContactor& operator=(const RigidContactor&);
+};
+
+}
+
+#endif // PERIDIGM_RIGIDCONTACTOR_HPP
@@ -0,0 +1,79 @@
+/*! \file Peridigm_RigidContactorFactory.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_Assert.hpp>
+#include "Peridigm_RigidContactorFactory.hpp"
+#include "Peridigm_AnalyticRigidContactors.hpp"
+#include "Peridigm_STLRigidContactor.hpp"
+
+using namespace std;
+
+Teuchos::RCP<PeridigmNS::RigidContactor>
+PeridigmNS::RigidContactorFactory::create(const Teuchos::ParameterList& rigidContactorParams,
+                                          const std::string& name,
+                                          Teuchos::RCP<PeridigmNS::Discretization> disc)
+{
+  string type = rigidContactorParams.get<string>("Type");
+
+  Teuchos::RCP<PeridigmNS::RigidContactor> rigidContactor;
+  if (type == "Plane")
+    rigidContactor = Teuchos::rcp( new RigidPlaneContactor(rigidContactorParams, name, disc) );
+  else if (type == "Sphere")
+    rigidContactor = Teuchos::rcp( new RigidSphereContactor(rigidContactorParams, name, disc) );
+  else if (type == "Cylinder")
+    rigidContactor = Teuchos::rcp( new RigidCylinderContactor(rigidContactorParams, name, disc) );
+  else if (type == "STL")
+    rigidContactor = Teuchos::rcp( new STLRigidContactor(rigidContactorParams, name, disc) );
+  else {
+    string invalidType("\n**** Unrecognized rigid contactor type: ");
+    invalidType += type;
+    invalidType += ", must be \"Plane\", \"Sphere\", \"Cylinder\", or \"STL\".\n";
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, invalidType);
+  }
+
+  return rigidContactor;
+}
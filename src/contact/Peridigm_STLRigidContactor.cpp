@@ -0,0 +1,182 @@
+//! \file Peridigm_STLRigidContactor.cpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_STLRigidContactor.hpp"
+#include <Teuchos_Assert.hpp>
+#include <Epetra_Comm.h>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cmath>
+#include <stdexcept>
+
+using namespace std;
+
+PeridigmNS::STLRigidContactor::STLRigidContactor(const Teuchos::ParameterList& params,
+                                                 const std::string& name,
+                                                 Teuchos::RCP<PeridigmNS::Discretization> disc)
+  : RigidContactor(params, name, disc)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(contactDistance <= 0.0, "\n**** Error, \"Contact Distance\" must be greater than zero for STL rigid contactors.\n");
+  if(!params.isParameter("File Name"))
+    TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "STL rigid contactor parameter \"File Name\" not specified.");
+  double scale = 1.0;
+  if(params.isParameter("Scale"))
+    scale = params.get<double>("Scale");
+
+  // Read the surface on processor zero and broadcast it, the read status is broadcast along with the
+  // number of values so that every processor throws if the file is missing or cannot be parsed
+  const Epetra_Comm& comm = disc->getGlobalOwnedMap(1)->Comm();
+  const string fileName = params.get<string>("File Name");
+  string readErrorMessage;
+  if(comm.MyPID() == 0){
+    try{
+      readSTLFile(fileName, scale);
+    }
+    catch(const std::exception& e){
+      readErrorMessage = e.what();
+      vertices.clear();
+    }
+  }
+  int readStatus[2] = {readErrorMessage.empty() ? 0 : 1, static_cast<int>(vertices.size())};
+  comm.Broadcast(readStatus, 2, 0);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(readStatus[0] != 0 && comm.MyPID() == 0, readErrorMessage);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(readStatus[0] != 0, "\n**** Error, unable to read STL file " + fileName + " on processor 0.\n");
+  int numValues = readStatus[1];
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numValues == 0, "\n**** Error, no facets found in STL file " + fileName + ".\n");
+  vertices.resize(numValues);
+  comm.Broadcast(&vertices[0], numValues, 0);
+
+  // Facet normals follow from the vertex ordering
+  const int numFacets = numValues/9;
+  facetNormals.resize(3*numFacets);
+  for(int iFacet=0 ; iFacet<numFacets ; ++iFacet){
+    const double* v = &vertices[9*iFacet];
+    double* n = &facetNormals[3*iFacet];
+    n[0] = (v[4]-v[1])*(v[8]-v[2]) - (v[5]-v[2])*(v[7]-v[1]);
+    n[1] = (v[5]-v[2])*(v[6]-v[0]) - (v[3]-v[0])*(v[8]-v[2]);
+    n[2] = (v[3]-v[0])*(v[7]-v[1]) - (v[4]-v[1])*(v[6]-v[0]);
+    double magnitude = sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+    for(int dof=0 ; dof<3 ; ++dof)
+      n[dof] = magnitude > 0.0 ? n[dof]/magnitude : 0.0;
+  }
+
+  hierarchy.build(&vertices[0], numFacets, 9);
+}
+
+void PeridigmNS::STLRigidContactor::readSTLFile(const std::string& fileName, double scale)
+{
+  ifstream inFile(fileName.c_str(), ios::in | ios::binary);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!inFile.is_open(), "\n**** Error, unable to open STL file " + fileName + ".\n");
+
+  // A binary file has an 80-byte header and a facet count, followed by 50 bytes per facet
+  // ASCII files begin with "solid", but so do some binary files, so the file size is checked first
+  inFile.seekg(0, ios::end);
+  streamoff fileSize = inFile.tellg();
+  inFile.seekg(0, ios::beg);
+  char header[80];
+  unsigned int binaryNumFacets = 0;
+  bool isBinary = false;
+  if(fileSize >= 84){
+    inFile.read(header, 80);
+    inFile.read(reinterpret_cast<char*>(&binaryNumFacets), 4);
+    isBinary = (fileSize == 84 + 50*static_cast<streamoff>(binaryNumFacets));
+  }
+
+  if(isBinary){
+    vertices.reserve(9*binaryNumFacets);
+    char record[50];
+    float values[12];
+    for(unsigned int iFacet=0 ; iFacet<binaryNumFacets ; ++iFacet){
+      inFile.read(record, 50);
+      memcpy(values, record, 12*sizeof(float));
+      // values[0-2] hold the stored normal, which is recomputed from the vertices
+      for(int i=3 ; i<12 ; ++i)
+        vertices.push_back(scale*values[i]);
+    }
+  }
+  else{
+    inFile.close();
+    ifstream asciiFile(fileName.c_str());
+    string token;
+    while(asciiFile >> token){
+      if(token == "vertex"){
+        double x, y, z;
+        asciiFile >> x >> y >> z;
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(asciiFile.fail(), "\n**** Error, failed to parse vertex in STL file " + fileName + ".\n");
+        vertices.push_back(scale*x);
+        vertices.push_back(scale*y);
+        vertices.push_back(scale*z);
+      }
+    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(vertices.size()%9 != 0, "\n**** Error, STL file " + fileName + " contains a facet without three vertices.\n");
+  }
+}
+
+bool PeridigmNS::STLRigidContactor::signedDistance(const double* x, double maxDistance, double& distance, double* normal) const
+{
+  double closestPoint[3], distanceSquared;
+  int iFacet = hierarchy.closestFacet(&vertices[0], 9, x, maxDistance, closestPoint, distanceSquared);
+  if(iFacet == -1)
+    return false;
+
+  // Away from the facet interior the direction follows the vector to the closest point so that the force varies smoothly across edges
+  const double* facetNormal = &facetNormals[3*iFacet];
+  distance = sqrt(distanceSquared);
+  double side = (x[0]-closestPoint[0])*facetNormal[0] + (x[1]-closestPoint[1])*facetNormal[1] + (x[2]-closestPoint[2])*facetNormal[2];
+  double sign = side < 0.0 ? -1.0 : 1.0;
+  if(distance > 1.0e-12*maxDistance){
+    for(int dof=0 ; dof<3 ; ++dof)
+      normal[dof] = sign*(x[dof]-closestPoint[dof])/distance;
+  }
+  else{
+    for(int dof=0 ; dof<3 ; ++dof)
+      normal[dof] = facetNormal[dof];
+  }
+  distance *= sign;
+  return true;
+}
@@ -0,0 +1,96 @@
+//! \file Peridigm_STLRigidContactor.hpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_STLRIGIDCONTACTOR_HPP
+#define PERIDIGM_STLRIGIDCONTACTOR_HPP
+
+#include "Peridigm_RigidContactor.hpp"
+#include "Peridigm_FacetHierarchy.hpp"
+#include <vector>
+
+namespace PeridigmNS {
+
+  /*! \brief Rigid contactor bounded by a triangulated surface read from an ASCII or binary STL file.
+   *
+   *  The surface is expected to be closed and wound counterclockwise when viewed from outside, as required
+   *  by the STL format, so that the facet normals point out of the contactor.  The file is read on processor
+   *  zero and broadcast, and every processor keeps the full surface along with a bounding volume hierarchy.
+   */
+  class STLRigidContactor : public RigidContactor {
+  public:
+
+    //! Constructor.
+    STLRigidContactor(const Teuchos::ParameterList& params,
+                      const std::string& name,
+                      Teuchos::RCP<PeridigmNS::Discretization> disc);
+
+    //! Return the type of the contactor surface.
+    virtual std::string Type() const { return("STL"); }
+
+    //! Signed distance to the closest facet, with the sign taken from the facet normal.
+    virtual bool signedDistance(const double* x, double maxDistance, double& distance, double* normal) const;
+
+    //! Number of facets in the surface.
+    int NumFacets() const { return static_cast<int>(vertices.size()/9); }
+
+  protected:
+
+    //! Read the facet vertices from an STL file
+    void readSTLFile(const std::string& fileName, double scale);
+
+    //! Vertex coordinates, nine values per facet
+    std::vector<double> vertices;
+
+    //! Unit outward normal of each facet
+    std::vector<double> facetNormals;
+
+    //! Bounding volume hierarchy over the facets
+    FacetHierarchy hierarchy;
+  };
+}
+
+#endif // PERIDIGM_STLRIGIDCONTACTOR_HPP
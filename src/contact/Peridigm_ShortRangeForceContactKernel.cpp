@@ -0,0 +1,200 @@
+/*! \file Peridigm_ShortRangeForceContactKernel.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_ShortRangeForceContactKernel.hpp"
+#include <Teuchos_Assert.hpp>
+#include <cmath>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+void PeridigmNS::computeShortRangeContactForce(const int numOwnedPoints,
+                                               const int* ownedIDs,
+                                               const int* contactNeighborhoodList,
+                                               const double* cellVolume,
+                                               const double* blockId,
+                                               const double* y,
+                                               const double* velocity,
+                                               double* contactForce,
+                                               const int forceLength,
+                                               const double contactRadius,
+                                               const double normalForceConstant,
+                                               const double frictionCoefficient,
+                                               std::vector<int>& neighborhoodOffsets,
+                                               std::vector<double>& threadContactForce)
+{
+  const double contactRadiusSquared = contactRadius*contactRadius;
+  const bool hasFriction = (frictionCoefficient != 0.0);
+
+  // Offsets of each point's neighborhood in the contact neighbor list, so that points can be processed independently
+  neighborhoodOffsets.resize(numOwnedPoints);
+  int neighborhoodListIndex(0);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    neighborhoodOffsets[iID] = neighborhoodListIndex;
+    int numNeighbors = contactNeighborhoodList[neighborhoodListIndex++];
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID)
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(contactNeighborhoodList[neighborhoodListIndex++] < 0, "Invalid neighbor list\n");
+  }
+
+  // Each thread accumulates into its own force vector, the first thread writes directly to the contact force;
+  // assign() keeps the capacity of the work array, so it is only reallocated when the force vector grows
+#ifdef _OPENMP
+  const int numThreads = omp_get_max_threads();
+#else
+  const int numThreads = 1;
+#endif
+  threadContactForce.assign((numThreads-1)*forceLength, 0.0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+#ifdef _OPENMP
+    const int threadID = omp_get_thread_num();
+#else
+    const int threadID = 0;
+#endif
+    double* force = (threadID == 0) ? contactForce : &threadContactForce[(threadID-1)*forceLength];
+
+    int numNeighbors, nodeID, neighborID, iID, iNID, index;
+    double nodeCurrentX[3], nodeCurrentV[3], nodeVolume, nodeBlockId, neighborVolume;
+    double dx, dy, dz, currentDistanceSquared, currentDistance, temp;
+    double normal[3], relativeV[3], relativeDotNormal, relativeVperp[3], normRelativeVperp, frictionScale;
+    const double *neighborX, *neighborV;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64)
+#endif
+    for(iID=0 ; iID<numOwnedPoints ; ++iID){
+      index = neighborhoodOffsets[iID];
+      numNeighbors = contactNeighborhoodList[index++];
+      if(numNeighbors > 0){
+        nodeID = ownedIDs[iID];
+        nodeCurrentX[0] = y[nodeID*3];
+        nodeCurrentX[1] = y[nodeID*3+1];
+        nodeCurrentX[2] = y[nodeID*3+2];
+        nodeCurrentV[0] = velocity[nodeID*3];
+        nodeCurrentV[1] = velocity[nodeID*3+1];
+        nodeCurrentV[2] = velocity[nodeID*3+2];
+        nodeVolume = cellVolume[nodeID];
+        nodeBlockId = blockId[nodeID];
+        for(iNID=0 ; iNID<numNeighbors ; ++iNID){
+          neighborID = contactNeighborhoodList[index++];
+
+          // Most candidate pairs lie outside the contact radius, reject them
+          // before the square root and any of the normal or friction algebra
+          neighborX = y + 3*neighborID;
+          dx = neighborX[0] - nodeCurrentX[0];
+          dy = neighborX[1] - nodeCurrentX[1];
+          dz = neighborX[2] - nodeCurrentX[2];
+          currentDistanceSquared = dx*dx + dy*dy + dz*dz;
+          if(currentDistanceSquared >= contactRadiusSquared)
+            continue;
+
+          currentDistance = sqrt(currentDistanceSquared);
+          normal[0] = dx/currentDistance;
+          normal[1] = dy/currentDistance;
+          normal[2] = dz/currentDistance;
+
+          // temp is the magnitude of the normal force density per unit volume of the opposing node
+          // pairs within a block are listed once and carry the full force, pairs across blocks are
+          // listed from both sides and each side applies half of it
+          temp = normalForceConstant*(contactRadius - currentDistance);
+          if(blockId[neighborID] == nodeBlockId)
+            temp *= 2.0;
+          neighborVolume = cellVolume[neighborID];
+
+          // normal force, equal and opposite on the two nodes
+          force[nodeID*3]       -= temp*neighborVolume*normal[0];
+          force[nodeID*3+1]     -= temp*neighborVolume*normal[1];
+          force[nodeID*3+2]     -= temp*neighborVolume*normal[2];
+          force[neighborID*3]   += temp*nodeVolume*normal[0];
+          force[neighborID*3+1] += temp*nodeVolume*normal[1];
+          force[neighborID*3+2] += temp*nodeVolume*normal[2];
+
+          if(hasFriction){
+
+            // In the frame of the mean tangential velocity the two nodes slide with equal and
+            // opposite velocities, half the tangential component of the relative velocity
+            neighborV = velocity + 3*neighborID;
+            relativeV[0] = nodeCurrentV[0] - neighborV[0];
+            relativeV[1] = nodeCurrentV[1] - neighborV[1];
+            relativeV[2] = nodeCurrentV[2] - neighborV[2];
+            relativeDotNormal = relativeV[0]*normal[0] + relativeV[1]*normal[1] + relativeV[2]*normal[2];
+            relativeVperp[0] = 0.5*(relativeV[0] - relativeDotNormal*normal[0]);
+            relativeVperp[1] = 0.5*(relativeV[1] - relativeDotNormal*normal[1]);
+            relativeVperp[2] = 0.5*(relativeV[2] - relativeDotNormal*normal[2]);
+            normRelativeVperp = sqrt(relativeVperp[0]*relativeVperp[0] +
+                                     relativeVperp[1]*relativeVperp[1] +
+                                     relativeVperp[2]*relativeVperp[2]);
+
+            // friction force opposes sliding and scales with the normal force magnitude
+            if(normRelativeVperp != 0.0){
+              frictionScale = frictionCoefficient*temp/normRelativeVperp;
+              force[nodeID*3]       -= frictionScale*neighborVolume*relativeVperp[0];
+              force[nodeID*3+1]     -= frictionScale*neighborVolume*relativeVperp[1];
+              force[nodeID*3+2]     -= frictionScale*neighborVolume*relativeVperp[2];
+              force[neighborID*3]   += frictionScale*nodeVolume*relativeVperp[0];
+              force[neighborID*3+1] += frictionScale*nodeVolume*relativeVperp[1];
+              force[neighborID*3+2] += frictionScale*nodeVolume*relativeVperp[2];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Sum the thread-local contributions
+  for(int thread=1 ; thread<numThreads ; ++thread){
+    const double* threadForce = &threadContactForce[(thread-1)*forceLength];
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int i=0 ; i<forceLength ; ++i)
+      contactForce[i] += threadForce[i];
+  }
+}
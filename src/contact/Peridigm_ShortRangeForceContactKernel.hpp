@@ -0,0 +1,78 @@
+//! \file Peridigm_ShortRangeForceContactKernel.hpp
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_SHORTRANGEFORCECONTACTKERNEL_HPP
+#define PERIDIGM_SHORTRANGEFORCECONTACTKERNEL_HPP
+
+#include <vector>
+
+namespace PeridigmNS {
+
+  /*! \brief Short-range contact force kernel shared by the short-range force contact models.
+
+    Accumulates the normal and friction forces of each contact pair into contactForce, which must be zeroed by the caller.
+    Pairs within a block are listed once and carry the full force, pairs across blocks are listed from both sides and each
+    side applies half of it.  When compiled with OpenMP the owned points are split across threads; neighborhoodOffsets and
+    threadContactForce are work arrays owned by the caller, so their storage is reused from one call to the next.
+  */
+  void computeShortRangeContactForce(const int numOwnedPoints,
+                                     const int* ownedIDs,
+                                     const int* contactNeighborhoodList,
+                                     const double* cellVolume,
+                                     const double* blockId,
+                                     const double* y,
+                                     const double* velocity,
+                                     double* contactForce,
+                                     const int forceLength,
+                                     const double contactRadius,
+                                     const double normalForceConstant,
+                                     const double frictionCoefficient,
+                                     std::vector<int>& neighborhoodOffsets,
+                                     std::vector<double>& threadContactForce);
+}
+
+#endif // PERIDIGM_SHORTRANGEFORCECONTACTKERNEL_HPP
@@ -100,12 +100,20 @@ namespace PeridigmNS {
 	double m_frictionCoefficient;
     double m_horizon;
 
+    //! Normal force per unit overlap and per unit volume, derived from the spring constant and horizon
+    double m_normalForceConstant;
+
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
+    int m_blockIdFieldId;
     int m_volumeFieldId;
     int m_coordinatesFieldId;
     int m_velocityFieldId;
     int m_contactForceDensityFieldId;
+
+    //! Work arrays of the contact kernel, kept between calls so that they are not reallocated every time step
+    mutable std::vector<int> m_neighborhoodOffsets;
+    mutable std::vector<double> m_threadContactForce;
   };
 }
 
@@ -109,7 +109,19 @@ namespace PeridigmNS {
 	double m_springConstant;
 	double m_frictionCoefficient;
     double m_horizon;
-    
+
+    //! Normal force per unit overlap and per unit volume, derived from the spring constant and horizon
+    double m_normalForceConstant;
+
+    //! Friction coefficient at the previous time of the last tabulation
+    double m_previousFrictionCoefficient;
+
+    //! Time at which the friction coefficient was last tabulated
+    double m_tabulatedTime;
+
+    //! Flag indicating that the friction coefficient has been tabulated at least once
+    bool m_isTabulated;
+
     //! string defined funciton
     std::string functionfriction, checkfriction;
     
@@ -118,10 +130,15 @@ namespace PeridigmNS {
 
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
+    int m_blockIdFieldId;
     int m_volumeFieldId;
     int m_coordinatesFieldId;
     int m_velocityFieldId;
     int m_contactForceDensityFieldId;
+
+    //! Work arrays of the contact kernel, kept between calls so that they are not reallocated every time step
+    mutable std::vector<int> m_neighborhoodOffsets;
+    mutable std::vector<double> m_threadContactForce;
   };
 }
 
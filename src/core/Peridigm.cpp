@@ -68,6 +68,7 @@
 #include "Peridigm_ContactModelFactory.hpp"
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
 #include "Peridigm_CriticalTimeStep.hpp"
+#include "Peridigm_FiniteDifferenceJacobianOperator.hpp"
 #include "Peridigm_CriticalThermalTimeStep.hpp"
 #include "Peridigm_Timer.hpp"
 #include "Peridigm_MaterialFactory.hpp"
@@ -114,6 +115,9 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     analysisHasSpecular(false),		// MODIFIED NOTE
     computeIntersections(false),
     constructInterfaces(false),
+    implicitThermalTheta(1.0),
+    implicitThermalMaxIterations(10),
+    implicitThermalTolerance(1.0e-5),
     deltaTemperatureFieldId(-1),
     blockIdFieldId(-1),
     horizonFieldId(-1),
@@ -131,7 +135,8 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     fluidPressureUFieldId(-1),
     fluidPressureVFieldId(-1),
     fluidFlowDensityFieldId(-1),
-    numMultiphysDoFs(0)
+    numMultiphysDoFs(0),
+    lineSearchResidualEvaluations(0)
 {
 #ifdef HAVE_MPI
   peridigmComm = Teuchos::rcp(new Epetra_MpiComm(comm));
@@ -269,9 +274,14 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   // Note that Peridigm can be run with multiple solvers, applied in sequence
   bool implicitTimeIntegration(false), userSpecifiedFullTangent(false), userSpecifiedBlockDiagonalTangent(false);
   for(unsigned int i=0 ; i<solverParameters.size() ; ++i){
-    if(solverParameters[i]->isSublist("QuasiStatic") || solverParameters[i]->isSublist("NOXQuasiStatic") || solverParameters[i]->isSublist("Implicit")){
+    if(solverParameters[i]->isSublist("QuasiStatic") || solverParameters[i]->isSublist("NOXQuasiStatic") || solverParameters[i]->isSublist("ArcLength") || solverParameters[i]->isSublist("Implicit")){
       implicitTimeIntegration = true;
     }
+    // The matrix-free implicit solver uses the tangent only as a preconditioner, the block diagonal tangent is the default
+    if(solverParameters[i]->isSublist("Implicit") && !solverParameters[i]->isParameter("Peridigm Preconditioner")){
+      if(solverParameters[i]->sublist("Implicit").get<string>("Jacobian Operator", "Have Jacobian") == "Matrix-Free")
+        userSpecifiedBlockDiagonalTangent = true;
+    }
     if(solverParameters[i]->isParameter("Peridigm Preconditioner")){
       std::string peridigmPreconditionerType = solverParameters[i]->get<string>("Peridigm Preconditioner");
       if(peridigmPreconditionerType == "Full Tangent")
@@ -387,11 +397,14 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     double timePrevious =0.0;
 
     for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
-    	contactModel = contactBlockIt->getContactModel();
+      std::vector< Teuchos::RCP<const PeridigmNS::ContactModel> > blockContactModels = contactBlockIt->getContactModels();
+      for(unsigned int i=0 ; i<blockContactModels.size() ; ++i){
+        contactModel = blockContactModels[i];
         if(contactModel->Name() == "Time-Dependent Short-Range Force"){
             New_contactModel = Teuchos::rcp_const_cast<PeridigmNS::ContactModel> (contactModel);
             New_contactModel->evaluateParserFriction(currentValue, previousValue, timeCurrent, timePrevious);
         }
+      }
     }
   }
 
@@ -873,8 +886,10 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
 
   // Call rebalance function if analysis has contact
   // this is required to set up proper contact neighbor list
-  if(analysisHasContact)
+  if(analysisHasContact){
+    contactManager->updateSurfacePoints(0, blocks);
     contactManager->rebalance(0);
+  }
 
   // Create service manager
   serviceManager = Teuchos::rcp(new PeridigmNS::ServiceManager());
@@ -928,6 +943,8 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   if(peridigmParams->isParameter("Restart")){
 	 InitializeRestart();
   }
+
+  recordMemoryUsage("Initialization");
 }
 
 void PeridigmNS::Peridigm::checkContactSearchRadius(const Teuchos::ParameterList& contactParams, Teuchos::RCP<Discretization> peridigmDisc){
@@ -1301,12 +1318,14 @@ void PeridigmNS::Peridigm::instantiateComputeManager(Teuchos::RCP<Discretization
   Teuchos::RCP<Epetra_Map> *tmp4 = &( blockDiagonalTangentMap );
   Teuchos::RCP<Discretization> *tmp5 = &( peridigmDiscretization );
   Teuchos::RCP<int> *tmp6 = &( nonlinearSolverIterations );
+  Teuchos::RCP<PeridigmNS::ContactManager> *tmp7 = &( contactManager );
   computeClassGlobalData->set("tangent",tmp1);
   computeClassGlobalData->set("blockDiagonalTangent",tmp2);
   computeClassGlobalData->set("overlapJacobian",tmp3);
   computeClassGlobalData->set("blockDiagonalTangentMap",tmp4);
   computeClassGlobalData->set("discretization",tmp5);
   computeClassGlobalData->set("nonlinearSolverIterations",tmp6);
+  computeClassGlobalData->set("contactManager",tmp7);
 
   computeManager = Teuchos::rcp( new PeridigmNS::ComputeManager( computeParams, peridigmComm, computeClassGlobalData ) );
 }
@@ -1442,21 +1461,26 @@ void PeridigmNS::Peridigm::execute(Teuchos::RCP<Teuchos::ParameterList> solverPa
 
   TEUCHOS_TEST_FOR_EXCEPT_MSG(solverParams.is_null(), "Error in Peridigm::execute, solverParams is null.\n");
 
-  // allowable explicit time integration schemes:  Verlet
+  // allowable explicit time integration schemes:  Verlet, DynamicRelaxation
   if(solverParams->isSublist("Verlet")){
     executeExplicit(solverParams);}
+  else if(solverParams->isSublist("DynamicRelaxation"))
+    executeDynamicRelaxation(solverParams);
 
-  // allowable implicit time integration schemes:  Implicit, QuasiStatic
+  // allowable implicit time integration schemes:  Implicit, QuasiStatic, ArcLength
   else if(solverParams->isSublist("QuasiStatic"))
     executeQuasiStatic(solverParams);
   else if(solverParams->isSublist("NOXQuasiStatic"))
     executeNOXQuasiStatic(solverParams);
+  else if(solverParams->isSublist("ArcLength"))
+    executeArcLength(solverParams);
   else if(solverParams->isSublist("Implicit"))
     executeImplicit(solverParams);
 
   PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
   const std::string statTag = "Post Execute";
   memstat->addStat(statTag);
+  recordMemoryUsage(statTag);
 }
 
 void PeridigmNS::Peridigm::executeSolvers() {
@@ -1518,6 +1542,13 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     double globalCriticalThermalTimeStep, Tdt_original, thermalSafetyFactor;
     int Tdt_dt = 1;
     bool synchroTimeSteps(false);
+    // The heat equation is advanced either with forward Euler (conditionally stable, limited by the critical thermal time step)
+    // or with the implicit theta-method, which allows thermal time steps that are orders of magnitude larger
+    string thermalTimeIntegration = verletParams->get("Thermal Time Integration", "Explicit");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(thermalTimeIntegration != "Explicit" && thermalTimeIntegration != "Backward Euler" && thermalTimeIntegration != "Crank-Nicolson",
+                                "**** Error:  Invalid \"Thermal Time Integration\", valid options are \"Explicit\", \"Backward Euler\", and \"Crank-Nicolson\".\n");
+    const bool implicitThermal = analysisHasThermal && (thermalTimeIntegration != "Explicit");
+    const double thermalTheta = (thermalTimeIntegration == "Crank-Nicolson") ? 0.5 : 1.0;
 	if (analysisHasThermal){
         double criticalThermalTimeStep = 1.0e50;
         for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
@@ -1527,6 +1558,9 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
         }
         peridigmComm->MinAll(&criticalThermalTimeStep, &globalCriticalThermalTimeStep, 1);
         Tdt = globalCriticalThermalTimeStep; //The division by 100 is due to the exagerate difference between the mechanical time step and the thermal one
+        // The implicit update is not limited by the critical thermal time step; by default it is synchronized with the mechanics
+        if(implicitThermal)
+            Tdt = dt;
         // Query for a user-supplied time step, which overrides the computed value
         double userDefinedThermalTimeStep = 0.0;
         if(verletParams->isParameter("Fixed Thermal dt")){
@@ -1535,7 +1569,7 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
         }
 // 		Multiply the time step by the user-supplied safety factor, if provided
         thermalSafetyFactor = 1.0;
-        if(verletParams->isParameter("Thermal Safety Factor")){
+        if(verletParams->isParameter("Thermal Safety Factor") && !implicitThermal){
             thermalSafetyFactor = verletParams->get<double>("Thermal Safety Factor");
             Tdt *= thermalSafetyFactor;
         }
@@ -1666,6 +1700,8 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 			cout << "  Thermal time step    " << Tdt << "\n" << endl;
 			cout << "Total number of thermal time steps " << nTsteps << "\n" << endl;
 		}
+        if(implicitThermal && peridigmComm->MyPID() == 0)
+            cout << "  Thermal time integration    " << thermalTimeIntegration << "\n" << endl;
         TEUCHOS_TEST_FOR_EXCEPT_MSG(Tdt<dt, "****Error:  Thermal time step can't be smaller than mechanical time step.\n");
     }
     
@@ -1690,8 +1726,13 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     
   workset->timeStep = dt;
   double dt2 = dt/2.0;
- 
 
+  // Frequency, in time steps, at which the force vectors are checked for NaNs; zero disables the check
+  int nanCheckFrequency = verletParams->get<int>("NaN Check Frequency", 1);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(nanCheckFrequency < 0, "****Error:  NaN Check Frequency must be non-negative.\n");
+
+  // Overlap the halo exchange of the kinematic data with the evaluation of interior points
+  bool overlapCommunication = verletParams->get<bool>("Overlap Communication", false);
 
   // Pointer index into sub-vectors for use with BLAS
   double *xPtr, *uPtr, *yPtr, *vPtr, *aPtr;
@@ -1701,6 +1742,13 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   v->ExtractView( &vPtr );
   a->ExtractView( &aPtr );
 
+  double *forcePtr, *externalForcePtr, *densityPtr, *contactForcePtr(0);
+  force->ExtractView( &forcePtr );
+  externalForce->ExtractView( &externalForcePtr );
+  density->ExtractView( &densityPtr );
+  if(analysisHasContact)
+    contactForce->ExtractView( &contactForcePtr );
+
   double *deltaTemperaturePtr, *heatFlowPtr, *internalHeatSourcePtr;
   deltaTemperature->ExtractView( &deltaTemperaturePtr );
   if(analysisHasThermal){
@@ -1822,17 +1870,26 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 
   PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
+  // Implicit thermal step from the initial temperature; as for the explicit update, the new temperature is applied at
+  // the beginning of the next thermal step, so the thermal solution lags the mechanics by one thermal time step
+  Teuchos::RCP<Epetra_Vector> implicitThermalTemperature;
+  if(implicitThermal){
+    implicitThermalTemperature = Teuchos::rcp(new Epetra_Vector(*deltaTemperature));
+    PeridigmNS::Timer::self().startTimer("Implicit Thermal Step");
+    initializeImplicitThermalSolver(thermalTheta, localThermalShockNodeList, *verletParams);
+    solveImplicitThermalStep(Tdt, timeCurrent + Tdt, timeCurrent, implicitThermalTemperature);
+    PeridigmNS::Timer::self().stopTimer("Implicit Thermal Step");
+  }
+
   // evaluate the external (body) forces:
   PeridigmNS::Timer::self().startTimer("Apply Body Forces");
   boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, 0.0); // external forces are dirichlet BCs so the previous time is defaulted to 0.0
   PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
 
   // fill the acceleration vector
-  (*a) = (*force);
-  for(int i=0 ; i<a->MyLength() ; ++i){
-    (*a)[i] += (*externalForce)[i];
-    (*a)[i] /= (*density)[i/3];
-  }
+  for(int i=0 ; i<length ; ++i)
+    aPtr[i] = (forcePtr[i] + externalForcePtr[i])/densityPtr[i/3];
+
   // Write initial configuration to disk
   PeridigmNS::Timer::self().startTimer("Output");
   synchDataManagers();
@@ -1879,8 +1936,10 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     // rebalance, if requested
     PeridigmNS::Timer::self().startTimer("Rebalance");
     // \todo Should we load updated information first?  If so, only do this if we're really going to rebalance.
-    if(analysisHasContact)
+    if(analysisHasContact){
+      contactManager->updateSurfacePoints(step, blocks);
       contactManager->rebalance(step);
+    }
     PeridigmNS::Timer::self().stopTimer("Rebalance");
 
     // Do one step of velocity-Verlet
@@ -1902,17 +1961,19 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
 
     // Y^{n+1} = X_{o} + U^{n} + (dt)*V^{n+1/2}
-    // TODO Replace with blas call
-    for(int i=0 ; i<y->MyLength() ; ++i)
-      yPtr[i] = xPtr[i] + uPtr[i] + dt*vPtr[i];
-
     // U^{n+1} = U^{n} + (dt)*V^{n+1/2}
-    // blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt, vPtr, uPtr, 1, 1);
+    for(int i=0 ; i<length ; ++i){
+      double deltaU = dt*vPtr[i];
+      yPtr[i] = xPtr[i] + uPtr[i] + deltaU;
+      uPtr[i] += deltaU;
+    }
 
     // TODO The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
     
-    if(analysisHasThermal && fmod(step,Tdt_dt) == 0){
+    if(implicitThermal && fmod(step,Tdt_dt) == 0){
+      deltaTemperature->Update(1.0, *implicitThermalTemperature, 0.0);
+    }
+    else if(analysisHasThermal && fmod(step,Tdt_dt) == 0){
       if (hasThermalShock){
         for (size_t i=0; i<localThermalShockNodeList.size(); i++){
           int j = localThermalShockNodeList[i];
@@ -1939,40 +2000,54 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     }
 
     // Copy data from mothership vectors to overlap vectors in data manager
+    // If requested, the halo exchange is only posted here and is completed by the model evaluator
     PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    if ((hasAdiabaticHeating)&&(fmod(step,Hdt_dt)==0))
+      cumulativeHeat -> PutScalar(0.0);
+    if(analysisHasSpecular)
+      scratchBond->PutScalar(0.0);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
-      if(analysisHasSpecular)
-          blockIt->importData(*microPotential, microPotentialFieldId, PeridigmField::STEP_N, Insert);
+      // The blocking imports share the block importers, and so their distributors, with the split-phase
+      // import, so they are issued before the halo exchange is posted
+      if(analysisHasSpecular){
+        blockIt->importData(*microPotential, microPotentialFieldId, PeridigmField::STEP_N, Insert);
+        // zeroing scratchBond and inserting it in micropotential STEP_NP1
+        blockIt->importData(*scratchBond, microPotentialFieldId, PeridigmField::STEP_NP1, Insert);
+      }
       if ((hasAdiabaticHeating)&&(fmod(step,Hdt_dt)==0))
-      {
-        cumulativeHeat -> PutScalar(0.0);
         blockIt->importData(*cumulativeHeat, cumulativeHeatFieldId, PeridigmField::STEP_N, Insert);
+      if(overlapCommunication){
+        blockIt->queueImportData(*u, displacementFieldId, PeridigmField::STEP_NP1);
+        blockIt->queueImportData(*y, coordinatesFieldId, PeridigmField::STEP_NP1);
+        blockIt->queueImportData(*v, velocityFieldId, PeridigmField::STEP_NP1);
+        blockIt->queueImportData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1);
+        blockIt->startImports();
+      }
+      else{
+        blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+        blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
       }
     }
 
     //
     if(analysisHasContact){
-      if(contactModel->Name() == "Time-Dependent Short-Range Force"){
-        for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++) {
-    	 New_contactModel->evaluateParserFriction(currentValue, previousValue, timeCurrent, timePrevious);
+      // Tabulate the time-dependent contact parameters once per step, for every contact block
+      for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++) {
+        std::vector< Teuchos::RCP<const PeridigmNS::ContactModel> > blockContactModels = contactBlockIt->getContactModels();
+        for(unsigned int i=0 ; i<blockContactModels.size() ; ++i){
+          contactModel = blockContactModels[i];
+          if(contactModel->Name() == "Time-Dependent Short-Range Force"){
+            New_contactModel = Teuchos::rcp_const_cast<PeridigmNS::ContactModel> (contactModel);
+            New_contactModel->evaluateParserFriction(currentValue, previousValue, timeCurrent, timePrevious);
+          }
         }
       }
       contactManager->importData(volume, y, v);
     }
     PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
-    // zeroing scratchBond and inserting it in micropotential STEP_NP1
-    if(analysisHasSpecular){
-        scratchBond->PutScalar(0.0);
-        for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-            blockIt->importData(     *scratchBond,   microPotentialFieldId, PeridigmField::STEP_NP1, Insert);
-        }
-    }
-
     // Update forces based on new positions
     PeridigmNS::Timer::self().startTimer("Internal Force");
     modelEvaluator->evalModel(workset);
@@ -2037,41 +2112,59 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
       }
     }
 
-
-    // Check for NaNs in heat flow evaluation
-		if(analysisHasThermal){
-			for(int i=0 ; i<heatFlow->MyLength() ; ++i)
-				TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((heatFlowPtr)[i]), "**** NaN returned by heat flow evaluation.\n");
-		}
-    // Check for NaNs in force evaluation
-    // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
-    for(int i=0 ; i<force->MyLength() ; ++i)
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*force)[i]), "**** NaN returned by force evaluation.\n");
-
-    // Check for NaNs in force evaluation
-    // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
-    for(int i=0 ; i<externalForce->MyLength() ; ++i)
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*externalForce)[i]), "**** NaN returned by external force evaluation.\n");
+    // Implicit thermal step, using the current configuration and bond damage
+    if(implicitThermal && fmod(step,Tdt_dt) == 0){
+      PeridigmNS::Timer::self().startTimer("Implicit Thermal Step");
+      solveImplicitThermalStep(Tdt, timeCurrent + Tdt, timeCurrent, implicitThermalTemperature);
+      PeridigmNS::Timer::self().stopTimer("Implicit Thermal Step");
+    }
 
     if(analysisHasContact){
       contactManager->exportData(contactForce);
-      // Check for NaNs in contact force evaluation
-      for(int i=0 ; i<contactForce->MyLength() ; ++i)
-        TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite((*contactForce)[i]), "**** NaN returned by contact force evaluation.\n");
-      // Add contact forces to forces
-      force->Update(1.0, *contactForce, 1.0);
+      contactManager->updateRigidContactors(dt);
     }
 
-    // fill the acceleration vector
-    (*a) = (*force);
-    for(int i=0 ; i<a->MyLength() ; ++i){
-      (*a)[i] += (*externalForce)[i];
-      (*a)[i] /= (*density)[i/3];
+    // Check for NaNs in the force evaluations every nanCheckFrequency steps.
+    // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
+    bool checkForNaNs = (nanCheckFrequency > 0 && step%nanCheckFrequency == 0);
+
+    if(checkForNaNs && analysisHasThermal){
+      for(int i=0 ; i<heatFlow->MyLength() ; ++i)
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(heatFlowPtr[i]), "**** NaN returned by heat flow evaluation.\n");
     }
 
+    // Add contact forces to forces, fill the acceleration vector, and complete the velocity update in a single sweep
+    // A^{n+1}   = (F^{n+1} + F_{contact}^{n+1} + F_{external}^{n+1}) / rho
     // V^{n+1}   = V^{n+1/2} + (dt/2)*A^{n+1}
-    //blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
+    if(checkForNaNs){
+      bool forceIsFinite(true), externalForceIsFinite(true), contactForceIsFinite(true);
+      for(int i=0 ; i<length ; ++i){
+        forceIsFinite &= boost::math::isfinite(forcePtr[i]);
+        externalForceIsFinite &= boost::math::isfinite(externalForcePtr[i]);
+        if(contactForcePtr){
+          contactForceIsFinite &= boost::math::isfinite(contactForcePtr[i]);
+          forcePtr[i] += contactForcePtr[i];
+        }
+        aPtr[i] = (forcePtr[i] + externalForcePtr[i])/densityPtr[i/3];
+        vPtr[i] += dt2*aPtr[i];
+      }
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!forceIsFinite, "**** NaN returned by force evaluation.\n");
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!externalForceIsFinite, "**** NaN returned by external force evaluation.\n");
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!contactForceIsFinite, "**** NaN returned by contact force evaluation.\n");
+    }
+    else if(contactForcePtr){
+      for(int i=0 ; i<length ; ++i){
+        forcePtr[i] += contactForcePtr[i];
+        aPtr[i] = (forcePtr[i] + externalForcePtr[i])/densityPtr[i/3];
+        vPtr[i] += dt2*aPtr[i];
+      }
+    }
+    else{
+      for(int i=0 ; i<length ; ++i){
+        aPtr[i] = (forcePtr[i] + externalForcePtr[i])/densityPtr[i/3];
+        vPtr[i] += dt2*aPtr[i];
+      }
+    }
 
     PeridigmNS::Timer::self().startTimer("Output");
     synchDataManagers();
@@ -2086,6 +2179,242 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   *out << "\n\n";
 }
 
+void PeridigmNS::Peridigm::executeDynamicRelaxation(Teuchos::RCP<Teuchos::ParameterList> solverParams) {
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** Error:  The DynamicRelaxation solver does not support multiphysics analyses.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasSpecular, "**** Error:  Specular Positions and DynamicRelaxation analysis not compatible yet.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasContact, "**** Error:  Contact and DynamicRelaxation analysis not compatible yet.\n");
+
+  bool solverVerbose = solverParams->get("Verbose", false);
+  Teuchos::RCP<Teuchos::ParameterList> relaxationParams = sublist(solverParams, "DynamicRelaxation", true);
+  int maxIterations = relaxationParams->get("Maximum Iterations", 100000);
+  double massSafetyFactor = relaxationParams->get("Fictitious Mass Safety Factor", 2.0);
+  int printFrequency = relaxationParams->get("Print Frequency", 1000);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(maxIterations < 1, "**** Error:  \"Maximum Iterations\" must be at least one.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(massSafetyFactor < 1.0, "**** Error:  \"Fictitious Mass Safety Factor\" must be greater than or equal to one.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(printFrequency < 1, "**** Error:  \"Print Frequency\" must be at least one.\n");
+
+  // Determine tolerance
+  double tolerance = relaxationParams->get("Relative Tolerance", 1.0e-6);
+  bool useAbsoluteTolerance = false;
+  if(relaxationParams->isParameter("Absolute Tolerance")){
+    useAbsoluteTolerance = true;
+    tolerance = relaxationParams->get<double>("Absolute Tolerance");
+  }
+
+  // Create list of time steps
+  vector<double> timeSteps;
+  if( solverParams->isParameter("Final Time") && relaxationParams->isParameter("Number of Load Steps") ){
+    double timeInitial = solverParams->get("Initial Time", 0.0);
+    double timeFinal = solverParams->get<double>("Final Time");
+    int numLoadSteps = relaxationParams->get<int>("Number of Load Steps");
+    timeSteps.push_back(timeInitial);
+    for(int i=0 ; i<numLoadSteps ; ++i)
+      timeSteps.push_back(timeInitial + (i+1)*(timeFinal-timeInitial)/numLoadSteps);
+  }
+  else if( relaxationParams->isParameter("Time Steps") ){
+    string timeStepString = relaxationParams->get<string>("Time Steps");
+    istringstream iss(timeStepString);
+    copy(istream_iterator<double>(iss),
+	 istream_iterator<double>(),
+	 back_inserter<vector<double> >(timeSteps));
+  }
+  else{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "\n****Error: No valid time step data provided.\n");
+  }
+
+  // The residual is computed on a degree-of-freedom map with the same layout as the tangent map, so that the kinematic B.C.
+  // can be applied, but no matrix is allocated
+  int numMyDoFs = 3*oneDimensionalMap->NumMyElements();
+  vector<int> myGlobalDoFs(numMyDoFs);
+  int* oneDimensionalMapGlobalElements = oneDimensionalMap->MyGlobalElements();
+  for(int iElem=0 ; iElem<oneDimensionalMap->NumMyElements() ; ++iElem)
+    for(int dof=0 ; dof<3 ; ++dof)
+      myGlobalDoFs[3*iElem + dof] = 3*oneDimensionalMapGlobalElements[iElem] + dof;
+  Epetra_Map dofMap(3*oneDimensionalMap->NumGlobalElements(), numMyDoFs, numMyDoFs > 0 ? &myGlobalDoFs[0] : 0, 0, *peridigmComm);
+
+  Teuchos::RCP<Epetra_Vector> residual = Teuchos::rcp(new Epetra_Vector(dofMap));
+  Teuchos::RCP<Epetra_Vector> reaction = Teuchos::rcp(new Epetra_Vector(force->Map()));
+  Epetra_Vector fictitiousMass(dofMap);
+  Epetra_Vector relaxationVelocity(dofMap);
+  Epetra_Vector relaxationAcceleration(dofMap);
+  Epetra_Vector previousRelaxationAcceleration(dofMap);
+  Epetra_Vector uLoadStepStart(u->Map());
+
+  // Underwood's fictitious mass, chosen such that the central difference scheme is stable with a unit pseudo-time step:
+  // m_i >= (1/4) * sum_j |K_ij|.  For a point with bond stiffness sum S_i, the diagonal entry is bounded by S_i and the
+  // off-diagonal entries, one per bond, sum to at most S_i, so the Gershgorin row sum is bounded by 2 S_i.
+  // The safety factor covers state-based materials, whose tangent couples neighbors of neighbors.
+  Epetra_Vector bondStiffnessSum(*oneDimensionalMap);
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    ComputeBondStiffnessSum(*blockIt, bondStiffnessSum);
+  for(int i=0 ; i<numMyDoFs ; ++i){
+    fictitiousMass[i] = 0.25*massSafetyFactor*2.0*bondStiffnessSum[i/3]*(*volume)[i/3];
+    // Points with no bonds carry no internal force, give them the mass of a unit stiffness so they follow the external load
+    if(fictitiousMass[i] <= 0.0)
+      fictitiousMass[i] = 0.25*massSafetyFactor*(*volume)[i/3];
+  }
+
+  double *xPtr, *uPtr, *yPtr, *vPtr, *deltaUPtr;
+  x->ExtractView( &xPtr );
+  u->ExtractView( &uPtr );
+  y->ExtractView( &yPtr );
+  v->ExtractView( &vPtr );
+  deltaU->ExtractView( &deltaUPtr );
+  double *massPtr, *relaxationVPtr, *relaxationAPtr, *previousRelaxationAPtr, *residualPtr;
+  fictitiousMass.ExtractView( &massPtr );
+  relaxationVelocity.ExtractView( &relaxationVPtr );
+  relaxationAcceleration.ExtractView( &relaxationAPtr );
+  previousRelaxationAcceleration.ExtractView( &previousRelaxationAPtr );
+  residual->ExtractView( &residualPtr );
+  int length = u->MyLength();
+
+  // Initialize velocity to zero
+  v->PutScalar(0.0);
+
+  double timeCurrent = timeSteps[0];
+
+  // Write initial configuration to disk
+  PeridigmNS::Timer::self().startTimer("Output");
+  synchDataManagers();
+  outputManager->write(blocks, timeCurrent, (int)timeSteps.size());
+  PeridigmNS::Timer::self().stopTimer("Output");
+
+  Epetra_Time loadStepCPUTime(*peridigmComm);
+  double cumulativeLoadStepCPUTime = 0.0;
+
+  for(unsigned int step=1 ; step<timeSteps.size() ; ++step){
+
+    loadStepCPUTime.ResetStartTime();
+
+    double timePrevious = timeCurrent;
+    timeCurrent = timeSteps[step];
+    double timeIncrement = timeCurrent - timePrevious;
+    workset->timeStep = timeIncrement;
+
+    // Move the nodes with kinematic B.C. to their prescribed positions, all other nodes start from the previous load step
+    uLoadStepStart = *u;
+    deltaU->PutScalar(0.0);
+    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+    boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
+    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+    for(int i=0 ; i<length ; ++i)
+      uPtr[i] += deltaUPtr[i];
+
+    // evaluate the external (body) forces:
+    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+    boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
+    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+
+    relaxationVelocity.PutScalar(0.0);
+    double damping = 0.0;
+    double residualNorm = 0.0;
+    double toleranceMultiplier = 1.0;
+    int iteration = 1;
+    for( ; iteration<=maxIterations+1 ; ++iteration){
+
+      // Positions, and the physical velocity over the load step (the pseudo-velocity of the relaxation is not passed to the material models)
+      for(int i=0 ; i<length ; ++i){
+        yPtr[i] = xPtr[i] + uPtr[i];
+        deltaUPtr[i] = uPtr[i] - uLoadStepStart[i];
+        vPtr[i] = deltaUPtr[i]/timeIncrement;
+      }
+
+      // Out-of-balance force, with the entries corresponding to kinematic B.C. set to zero
+      residualNorm = computeQuasiStaticResidual(residual);
+
+      if(iteration == 1){
+        if(!useAbsoluteTolerance){
+          // The convergence criterion is relative to the reactions at kinematic B.C. and the applied external forces
+          boundaryAndInitialConditionManager->applyKinematicBC_ComputeReactions(force, reaction, numMultiphysDoFs);
+          double reactionNorm2(0.0), externalForceNorm2(0.0);
+          for(int i=0 ; i<reaction->MyLength() ; ++i){
+            double volumeI = (*volume)[i/3];
+            reactionNorm2 += (*reaction)[i]*(*reaction)[i]*volumeI*volumeI;
+            externalForceNorm2 += (*externalForce)[i]*(*externalForce)[i]*volumeI*volumeI;
+          }
+          double localNorms[2] = {reactionNorm2, externalForceNorm2};
+          double globalNorms[2];
+          peridigmComm->SumAll(localNorms, globalNorms, 2);
+          toleranceMultiplier = sqrt(globalNorms[0]) + sqrt(globalNorms[1]);
+        }
+        if(peridigmComm->MyPID() == 0)
+          cout << "Load step " << step << ", initial time = " << timePrevious << ", final time = " << timeCurrent <<
+            ", convergence criterion = " << tolerance*toleranceMultiplier << endl;
+      }
+
+      if(solverVerbose && (iteration-1)%printFrequency == 0 && peridigmComm->MyPID() == 0)
+        cout << "  iteration " << iteration << ": residual = " << residualNorm << ", damping = " << damping << endl;
+
+      if(residualNorm <= tolerance*toleranceMultiplier || iteration > maxIterations)
+        break;
+
+      // Track the total number of iterations taken over the simulation
+      *nonlinearSolverIterations += 1;
+
+      for(int i=0 ; i<numMyDoFs ; ++i)
+        relaxationAPtr[i] = residualPtr[i]/massPtr[i];
+
+      // Adaptive damping from the Rayleigh quotient u^T K u / u^T u, with the diagonal of the local stiffness
+      // estimated from the change in the out-of-balance force over the last pseudo-time step
+      if(iteration > 1){
+        double localSums[2] = {0.0, 0.0};
+        for(int i=0 ; i<numMyDoFs ; ++i){
+          if(relaxationVPtr[i] != 0.0){
+            double localStiffness = -(relaxationAPtr[i] - previousRelaxationAPtr[i])/relaxationVPtr[i];
+            localSums[0] += uPtr[i]*localStiffness*uPtr[i];
+          }
+          localSums[1] += uPtr[i]*uPtr[i];
+        }
+        double globalSums[2];
+        peridigmComm->SumAll(localSums, globalSums, 2);
+        damping = 0.0;
+        if(globalSums[0] > 0.0 && globalSums[1] > 0.0)
+          damping = std::min(2.0*sqrt(globalSums[0]/globalSums[1]), 2.0);
+      }
+
+      // Central difference update with unit pseudo-time step
+      if(iteration == 1){
+        for(int i=0 ; i<numMyDoFs ; ++i)
+          relaxationVPtr[i] = 0.5*relaxationAPtr[i];
+      }
+      else{
+        for(int i=0 ; i<numMyDoFs ; ++i)
+          relaxationVPtr[i] = ((2.0 - damping)*relaxationVPtr[i] + 2.0*relaxationAPtr[i])/(2.0 + damping);
+      }
+      for(int i=0 ; i<length ; ++i)
+        uPtr[i] += relaxationVPtr[i];
+
+      previousRelaxationAcceleration = relaxationAcceleration;
+    }
+
+    int numIterations = iteration - 1;
+    if(residualNorm > tolerance*toleranceMultiplier && peridigmComm->MyPID() == 0)
+      cout << "\nWarning:  Dynamic relaxation failed to converge in maximum allowable iterations." << endl;
+
+    double CPUTime = loadStepCPUTime.ElapsedTime();
+    cumulativeLoadStepCPUTime += CPUTime;
+    if(peridigmComm->MyPID() == 0){
+      cout << "  relaxation iterations = " << numIterations << ", residual = " << residualNorm << ", damping = " << damping << endl;
+      cout << setprecision(2) << "  cpu time for load step = " << CPUTime << " sec., cumulative cpu time = " << cumulativeLoadStepCPUTime << " sec.\n" << endl;
+    }
+
+    // Write output for completed load step
+    PeridigmNS::Timer::self().startTimer("Output");
+    synchDataManagers();
+    outputManager->write(blocks, timeCurrent, (int)timeSteps.size());
+    PeridigmNS::Timer::self().stopTimer("Output");
+
+    // swap state N and state NP1
+    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+      blockIt->updateState();
+
+  } // end loop over load steps
+
+  if(peridigmComm->MyPID() == 0)
+    cout << endl;
+}
+
 bool PeridigmNS::Peridigm::computeF(const Epetra_Vector& x, Epetra_Vector& FVec, NOX::Epetra::Interface::Required::FillType fillType) {
   return evaluateNOX(fillType, &x, &FVec);
 }
@@ -2313,7 +2642,7 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
     tangent->PutScalar(0.0);
     PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
     modelEvaluator->evalJacobian(workset);
-    int err = tangent->GlobalAssemble();
+    int err = overlapJacobian->globalAssemble();
     TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::evaluateNOX(), GlobalAssemble() returned nonzero error code.\n");
     PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
     boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent, numMultiphysDoFs);
@@ -2979,6 +3308,32 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
   double dampedNewtonDiagonalScaleFactor = quasiStaticParams->get("Damped Newton Diagonal Scale Factor", 1.0001);
   double dampedNewtonDiagonalShiftFactor = quasiStaticParams->get("Damped Newton Diagonal Shift Factor", 0.00001);
 
+  // Line search options
+  string lineSearchMethod = quasiStaticParams->get("Line Search", "Heuristic");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(lineSearchMethod != "Heuristic" && lineSearchMethod != "Backtracking",
+                              "**** Error:  Invalid \"Line Search\", valid options are \"Heuristic\" and \"Backtracking\".\n");
+  const bool backtrackingLineSearch = (lineSearchMethod == "Backtracking");
+  int lineSearchMaxEvaluations = quasiStaticParams->get("Line Search Maximum Evaluations", 8);
+  double lineSearchSufficientDecrease = quasiStaticParams->get("Line Search Sufficient Decrease", 1.0e-4);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(lineSearchMaxEvaluations < 1, "**** Error:  \"Line Search Maximum Evaluations\" must be at least one.\n");
+
+  // Adaptive load stepping:  load steps that fail to converge are repeated with a reduced increment,
+  // and the increment is increased again (up to the requested load step) after steps that converge quickly
+  bool adaptiveLoadStepping = quasiStaticParams->get("Adaptive Load Stepping", false);
+  int maxLoadStepCutbacks = quasiStaticParams->get("Maximum Load Step Cutbacks", 5);
+  double loadStepCutbackFactor = quasiStaticParams->get("Load Step Cutback Factor", 0.5);
+  double loadStepGrowthFactor = quasiStaticParams->get("Load Step Growth Factor", 1.5);
+  int loadStepGrowthIterationThreshold = quasiStaticParams->get("Load Step Growth Iteration Threshold", 4);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(loadStepCutbackFactor <= 0.0 || loadStepCutbackFactor >= 1.0, "**** Error:  \"Load Step Cutback Factor\" must be between zero and one.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(loadStepGrowthFactor < 1.0, "**** Error:  \"Load Step Growth Factor\" must be greater than or equal to one.\n");
+
+  // Work vectors for the line search
+  if(analysisHasMultiphysics)
+    lineSearchDeltaU = Teuchos::rcp(new Epetra_Vector(combinedDeltaU->Map()));
+  else
+    lineSearchDeltaU = Teuchos::rcp(new Epetra_Vector(deltaU->Map()));
+  lineSearchWork = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+
   // Determine tolerance
   double tolerance = quasiStaticParams->get("Relative Tolerance", 1.0e-6);
   bool useAbsoluteTolerance = false;
@@ -3078,12 +3433,24 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
   Epetra_Time loadStepCPUTime(*peridigmComm);
   double cumulativeLoadStepCPUTime = 0.0;
 
-  for(int step=1 ; step<(int)timeSteps.size() ; step++){
+  // With adaptive load stepping, the interval between two requested times may be traversed in several increments,
+  // the load step counter advances (and output is written) only when the requested time is reached
+  int step = 1;
+  int numLoadStepCutbacks = 0;
+  bool havePredictor = false;
+  double adaptiveTimeIncrement = timeSteps.size() > 1 ? timeSteps[1] - timeSteps[0] : 0.0;
+  while(step < (int)timeSteps.size()){
 
     loadStepCPUTime.ResetStartTime();
+    lineSearchResidualEvaluations = 0;
 
     double timePrevious = timeCurrent;
     timeCurrent = timeSteps[step];
+    bool reachesRequestedTime = true;
+    if(adaptiveLoadStepping && timePrevious + adaptiveTimeIncrement < timeCurrent - 1.0e-10*fabs(timeCurrent - timePrevious)){
+      timeCurrent = timePrevious + adaptiveTimeIncrement;
+      reachesRequestedTime = false;
+    }
     double timeIncrement = timeCurrent - timePrevious;
     workset->timeStep = timeIncrement;
 
@@ -3188,7 +3555,7 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
       }
 
       // On the first iteration, use a predictor based on the velocity from the previous load step
-      if(solverIteration == 1 && step > 1 && !disableHeuristics) {
+      if(solverIteration == 1 && havePredictor && !disableHeuristics) {
         for(int i=0 ; i<lhs->MyLength() ; ++i)
           (*lhs)[i] = (*predictor)[i]*timeIncrement;
         boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(lhs, numMultiphysDoFs);
@@ -3218,7 +3585,7 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
           tangent->PutScalar(0.0);
           PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
           modelEvaluator->evalJacobian(workset);
-          int err = tangent->GlobalAssemble();
+          int err = overlapJacobian->globalAssemble();
 
           TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::executeQuasiStatic(), GlobalAssemble() returned nonzero error code.\n");
           PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
@@ -3255,9 +3622,21 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
         boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(lhs, numMultiphysDoFs);
 
         PeridigmNS::Timer::self().startTimer("Line Search");
-        alpha = disableHeuristics ? 1.0 : quasiStaticsLineSearch(residual, lhs, timeIncrement);
+        bool stepApplied = false;
+        if(disableHeuristics)
+          alpha = 1.0;
+        else if(backtrackingLineSearch)
+          alpha = quasiStaticsBacktrackingLineSearch(residual, lhs, timeIncrement, lineSearchMaxEvaluations, lineSearchSufficientDecrease, residualNorm, stepApplied);
+        else
+          alpha = quasiStaticsLineSearch(residual, lhs, timeIncrement);
         PeridigmNS::Timer::self().stopTimer("Line Search");
 
+        // The backtracking line search leaves the nodal positions and residual at the accepted step
+        if(stepApplied){
+          solverIteration++;
+          continue;
+        }
+
         // Apply increment to nodal positions
 				if(analysisHasMultiphysics){
 					for(int i=0 ; i<combinedY->MyLength() ; i+=(3+numMultiphysDoFs)){
@@ -3305,6 +3684,19 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
     if(solverIteration >= maxSolverIterations && peridigmComm->MyPID() == 0)
       cout << "\nWarning:  Nonlinear solver failed to converge in maximum allowable iterations." << endl;
 
+    // If the load step did not converge, repeat it with a reduced increment.
+    // State N in the data managers has not been modified, the displacement increment is reset at the start of the step.
+    bool loadStepConverged = boost::math::isfinite(residualNorm) && residualNorm <= tolerance*toleranceMultiplier;
+    if(adaptiveLoadStepping && !loadStepConverged && numLoadStepCutbacks < maxLoadStepCutbacks){
+      numLoadStepCutbacks++;
+      adaptiveTimeIncrement = loadStepCutbackFactor*timeIncrement;
+      timeCurrent = timePrevious;
+      if(peridigmComm->MyPID() == 0)
+        cout << "  --load step failed to converge, reducing load increment to " << adaptiveTimeIncrement
+             << " (cutback " << numLoadStepCutbacks << " of " << maxLoadStepCutbacks << ")--\n" << endl;
+      continue;
+    }
+
     // If the maximum allowable number of load step reductions has been reached and the residual
     // is within a reasonable tolerance, then just accept the solution and forge ahead.
     // If not, abort the analysis.
@@ -3338,8 +3730,11 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
     // Print load step timing information
     double CPUTime = loadStepCPUTime.ElapsedTime();
     cumulativeLoadStepCPUTime += CPUTime;
-    if(peridigmComm->MyPID() == 0)
+    if(peridigmComm->MyPID() == 0){
+      if(!disableHeuristics)
+        cout << "  line search residual evaluations for load step = " << lineSearchResidualEvaluations << endl;
       cout << setprecision(2) << "  cpu time for load step = " << CPUTime << " sec., cumulative cpu time = " << cumulativeLoadStepCPUTime << " sec.\n" << endl;
+    }
 
     // Add the converged displacement increment to the displacement
     // Make sure even the non participating vectors are updated
@@ -3366,83 +3761,485 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
 			}
 		}
 
+    havePredictor = true;
+
     // Write output for completed load step
-    PeridigmNS::Timer::self().startTimer("Output");
-    synchDataManagers();
-    outputManager->write(blocks, timeCurrent,(int)timeSteps.size());
-    PeridigmNS::Timer::self().stopTimer("Output");
+    if(reachesRequestedTime){
+      PeridigmNS::Timer::self().startTimer("Output");
+      synchDataManagers();
+      outputManager->write(blocks, timeCurrent,(int)timeSteps.size());
+      PeridigmNS::Timer::self().stopTimer("Output");
+      step++;
+    }
 
     // swap state N and state NP1
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
       blockIt->updateState();
 
+    // Increase the load increment after a step that converged quickly, up to the requested load step
+    if(adaptiveLoadStepping){
+      numLoadStepCutbacks = 0;
+      if(loadStepConverged && solverIteration - 1 <= loadStepGrowthIterationThreshold)
+        adaptiveTimeIncrement = loadStepGrowthFactor*timeIncrement;
+      if(step < (int)timeSteps.size())
+        adaptiveTimeIncrement = std::min(adaptiveTimeIncrement, timeSteps[step] - timeSteps[step-1]);
+    }
+
   } // end loop over load steps
 
   if(peridigmComm->MyPID() == 0)
     cout << endl;
 }
 
-void PeridigmNS::Peridigm::quasiStaticsSetPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem) {
-  Ifpack IFPFactory;
-  Teuchos::ParameterList ifpackList;
-
-  if (linearProblem.isHermitian()) { // assume matrix Hermitian; construct IC preconditioner
-    Teuchos::RCP<Ifpack_Preconditioner> Prec = Teuchos::rcp( IFPFactory.Create("IC", &(*tangent), 0) );
-    Teuchos::ParameterList ifpackList;
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->SetParameters(ifpackList),
-  		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->SetParameters() returned nonzero error code.\n");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Initialize(),
-		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Initialize() returned nonzero error code.\n");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Compute(),
-		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Compute() returned nonzero error code.\n");
-    // Create the Belos preconditioned operator from the Ifpack preconditioner.
-    // NOTE:  This is necessary because Belos expects an operator to apply the
-    //        preconditioner with Apply() NOT ApplyInverse().
-    Teuchos::RCP<Belos::EpetraPrecOp> belosPrec = Teuchos::rcp( new Belos::EpetraPrecOp( Prec ) );
-    linearProblem.setLeftPrec( belosPrec );
+double PeridigmNS::Peridigm::arcLengthComputeResidual(Teuchos::RCP<Epetra_Vector> residual,
+                                                      Teuchos::RCP<const Epetra_Vector> freeIncrement,
+                                                      Teuchos::RCP<Epetra_Vector> prescribedIncrement,
+                                                      double timeCurrent,
+                                                      double timePrevious,
+                                                      double minimumTimeIncrement) {
+
+  // Evaluate the kinematic B.C. and body forces at the current pseudo-time
+  // The prescribed displacement B.C. also set the velocity, which is undefined for a vanishing time increment,
+  // in that case the prescribed increment is (to within the probe size) zero and the B.C. are skipped
+  deltaU->PutScalar(0.0);
+  if(fabs(timeCurrent - timePrevious) >= minimumTimeIncrement){
+    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+    boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
+    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
   }
-  else { // assume matrix non-Hermitian; construct ILU preconditioner
-    std::string PrecType = "ILU"; // incomplete LU
-    int OverlapLevel = 1; // must be >= 0. If Comm.NumProc() == 1, param is ignored.
-    Teuchos::RCP<Ifpack_Preconditioner> Prec = Teuchos::rcp( IFPFactory.Create(PrecType, &(*tangent), OverlapLevel) );
-    // specify parameters for ILU
-    ifpackList.set("fact: drop tolerance", 1e-9);
-    ifpackList.set("fact: ilut level-of-fill", 1);
-    // the combine mode is on the following: "Add", "Zero", "Insert", "InsertAdd", "Average", "AbsMax"
-    ifpackList.set("schwarz: combine mode", "Add");
-    // sets the parameters
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->SetParameters(ifpackList),
-  		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->SetParameters() returned nonzero error code.\n");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Initialize(),
-		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Initialize() returned nonzero error code.\n");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Compute(),
-		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Compute() returned nonzero error code.\n");
-    // Create the Belos preconditioned operator from the Ifpack preconditioner.
-    // NOTE:  This is necessary because Belos expects an operator to apply the
-    //        preconditioner with Apply() NOT ApplyInverse().
-    Teuchos::RCP<Belos::EpetraPrecOp> belosPrec = Teuchos::rcp( new Belos::EpetraPrecOp( Prec ) );
-    linearProblem.setLeftPrec( belosPrec );
+  PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+  boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
+  PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+
+  // Note that deltaU and the tangent map have the same local ordering for purely mechanical analyses
+  double timeIncrement = timeCurrent - timePrevious;
+  if(fabs(timeIncrement) < minimumTimeIncrement)
+    timeIncrement = minimumTimeIncrement;
+  workset->timeStep = timeIncrement;
+  for(int i=0 ; i<deltaU->MyLength() ; ++i){
+    (*prescribedIncrement)[i] = (*deltaU)[i];
+    (*deltaU)[i] += (*freeIncrement)[i];
+    (*y)[i] = (*x)[i] + (*u)[i] + (*deltaU)[i];
+    (*v)[i] = (*deltaU)[i]/timeIncrement;
   }
+
+  return computeQuasiStaticResidual(residual);
 }
 
-void PeridigmNS::Peridigm::quasiStaticsDampTangent(double dampedNewtonDiagonalScaleFactor,
-                                                   double dampedNewtonDiagonalShiftFactor) {
-  // Create a vector to store the diagonal
-  static Teuchos::RCP<Epetra_Vector> diagonal;
-  if(diagonal.is_null() || !diagonal->Map().SameAs(tangent->Map()))
-    diagonal = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+void PeridigmNS::Peridigm::executeArcLength(Teuchos::RCP<Teuchos::ParameterList> solverParams) {
 
-  // Extract the diagonal, modify it, and re-insert it into the tangent
-  tangent->ExtractDiagonalCopy(*diagonal);
-  diagonal->Scale(dampedNewtonDiagonalScaleFactor);
-  double diagonalNormInf;
-  diagonal->NormInf(&diagonalNormInf);
-  double* diagonalPtr;
-  diagonal->ExtractView(&diagonalPtr);
-  for(int i=0 ; i<diagonal->MyLength() ; ++i)
-    diagonalPtr[i] += dampedNewtonDiagonalShiftFactor*diagonalNormInf;
-  tangent->ReplaceDiagonalValues(*diagonal);
-}
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** Error:  The ArcLength solver does not support multiphysics analyses.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasSpecular, "**** Error:  Specular Positions and ArcLength analysis not compatible yet.\n");
+
+  bool solverVerbose = solverParams->get("Verbose", false);
+  Teuchos::RCP<Teuchos::ParameterList> arcLengthParams = sublist(solverParams, "ArcLength", true);
+
+  // The load factor is the pseudo-time, which scales both the kinematic B.C. and the body forces
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!solverParams->isParameter("Final Time"), "**** Error:  \"Final Time\" must be specified for the ArcLength solver.\n");
+  double timeInitial = solverParams->get("Initial Time", 0.0);
+  double timeFinal = solverParams->get<double>("Final Time");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(timeFinal <= timeInitial, "**** Error:  \"Final Time\" must be greater than \"Initial Time\" for the ArcLength solver.\n");
+  int numLoadSteps = arcLengthParams->get("Number of Load Steps", 10);
+  double initialLoadIncrement = arcLengthParams->get("Initial Load Increment", (timeFinal - timeInitial)/numLoadSteps);
+  int maxArcLengthSteps = arcLengthParams->get("Maximum Number of Arc Length Steps", 100*numLoadSteps);
+  int maxSolverIterations = arcLengthParams->get("Maximum Solver Iterations", 10);
+  int desiredSolverIterations = arcLengthParams->get("Desired Solver Iterations", 5);
+  int maxArcLengthCutbacks = arcLengthParams->get("Maximum Arc Length Cutbacks", 5);
+  double arcLengthCutbackFactor = arcLengthParams->get("Arc Length Cutback Factor", 0.5);
+  double maxArcLengthGrowthFactor = arcLengthParams->get("Maximum Arc Length Growth Factor", 2.0);
+  double loadScaling = arcLengthParams->get("Load Scaling", 0.0);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(initialLoadIncrement <= 0.0, "**** Error:  \"Initial Load Increment\" must be greater than zero.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(desiredSolverIterations < 1, "**** Error:  \"Desired Solver Iterations\" must be at least one.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(arcLengthCutbackFactor <= 0.0 || arcLengthCutbackFactor >= 1.0, "**** Error:  \"Arc Length Cutback Factor\" must be between zero and one.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(maxArcLengthGrowthFactor < 1.0, "**** Error:  \"Maximum Arc Length Growth Factor\" must be greater than or equal to one.\n");
+
+  // Probe used to compute the derivative of the residual with respect to the load factor
+  double loadProbe = 1.0e-6*initialLoadIncrement;
+
+  // Determine tolerance
+  double tolerance = arcLengthParams->get("Relative Tolerance", 1.0e-6);
+  bool useAbsoluteTolerance = false;
+  if(arcLengthParams->isParameter("Absolute Tolerance")){
+    useAbsoluteTolerance = true;
+    tolerance = arcLengthParams->get<double>("Absolute Tolerance");
+  }
+
+  // Vectors specific to the arc-length method, all of which use the map of the tangent matrix
+  Teuchos::RCP<Epetra_Vector> residual = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> loadDerivative = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> residualCorrection = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> loadCorrection = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> freeIncrement = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> prescribedIncrement = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> probePrescribedIncrement = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> prescribedRate = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> increment = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> correctedIncrement = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> incrementDirection = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> previousStepIncrement = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+  Teuchos::RCP<Epetra_Vector> reaction = Teuchos::rcp(new Epetra_Vector(force->Map()));
+
+  // Data for Belos linear solver object
+  Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator> linearProblem;
+  string linearSolver =  arcLengthParams->get("Belos Linear Solver", "BlockCG");
+  Teuchos::ParameterList belosList;
+  belosList.set( "Block Size", 1 );  // Use single-vector iteration
+  belosList.set( "Maximum Iterations", arcLengthParams->get("Belos Maximum Iterations", tangent->NumGlobalRows()) ); // Maximum number of iterations allowed
+  belosList.set( "Convergence Tolerance", arcLengthParams->get("Belos Relative Tolerance", 1.0e-4) ); // Relative convergence tolerance requested
+  belosList.set( "Output Frequency", -1 );
+  int verbosity = Belos::Errors + Belos::Warnings;
+  if( arcLengthParams->get("Belos Print Status", false) == true ){
+    verbosity += Belos::StatusTestDetails;
+    belosList.set( "Output Frequency", 1 );
+  }
+  belosList.set( "Verbosity", verbosity );
+  belosList.set( "Output Style", Belos::Brief );
+  Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> > belosSolver;
+  if (linearSolver == "BlockGMRES") {
+    belosList.set( "Num Blocks", 500); // Maximum number of blocks in Krylov factorization
+    belosList.set( "Maximum Restarts", 10 ); // Maximum number of restarts allowed
+    belosSolver = Teuchos::rcp( new Belos::BlockGmresSolMgr<double,Epetra_MultiVector,Epetra_Operator>(Teuchos::rcp(&linearProblem,false), Teuchos::rcp(&belosList,false)) );
+  }
+  else {
+    linearProblem.setHermitian(); // Assume matrix is Hermitian
+    belosSolver = Teuchos::rcp( new Belos::BlockCGSolMgr<double,Epetra_MultiVector,Epetra_Operator>(Teuchos::rcp(&linearProblem,false), Teuchos::rcp(&belosList,false)) );
+  }
+
+  // Initialize velocity to zero
+  v->PutScalar(0.0);
+
+  double timeCurrent = timeInitial;
+
+  // Write initial configuration to disk
+  PeridigmNS::Timer::self().startTimer("Output");
+  synchDataManagers();
+  outputManager->write(blocks, timeCurrent, maxArcLengthSteps);
+  PeridigmNS::Timer::self().stopTimer("Output");
+
+  Epetra_Time loadStepCPUTime(*peridigmComm);
+  double cumulativeLoadStepCPUTime = 0.0;
+
+  // The arc length is set on the first step such that the predictor reaches the initial load increment
+  double arcLength = 0.0;
+  double previousLoadIncrement = 0.0;
+  bool havePreviousStep = false;
+  int numArcLengthCutbacks = 0;
+  bool loadControlToFinalTime = false;
+  int step = 1;
+  while(timeCurrent < timeFinal && step <= maxArcLengthSteps){
+
+    loadStepCPUTime.ResetStartTime();
+
+    double timePrevious = timeCurrent;
+    freeIncrement->PutScalar(0.0);
+
+    // Reference load vector and prescribed displacement rate at the last converged state
+    // The derivative with respect to the load factor is approximated by a forward difference
+    arcLengthComputeResidual(loadDerivative, freeIncrement, probePrescribedIncrement, timePrevious + loadProbe, timePrevious, loadProbe);
+    arcLengthComputeResidual(residual, freeIncrement, prescribedIncrement, timePrevious, timePrevious, loadProbe);
+    loadDerivative->Update(-1.0/loadProbe, *residual, 1.0/loadProbe);
+    prescribedRate->Update(1.0/loadProbe, *probePrescribedIncrement, -1.0/loadProbe, *prescribedIncrement, 0.0);
+
+    // Tangent at the last converged state
+    bool solveFailed = false;
+    arcLengthEvaluateTangent();
+    if(quasiStaticsSolveSystem(loadDerivative, loadCorrection, linearProblem, belosSolver) != Belos::Converged)
+      solveFailed = true;
+    boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(loadCorrection, numMultiphysDoFs);
+
+    // Predictor:  the direction is tangent to the equilibrium path, with its sign chosen such that the
+    // path continues in the direction of the previous step (this allows the solution to trace limit points)
+    incrementDirection->Update(1.0, *loadCorrection, 1.0, *prescribedRate, 0.0);
+    double directionDot, loadDerivativeDot;
+    incrementDirection->Dot(*incrementDirection, &directionDot);
+    loadDerivative->Dot(*loadDerivative, &loadDerivativeDot);
+    double directionNorm = sqrt(directionDot + loadScaling*loadScaling*loadDerivativeDot);
+    if(arcLength == 0.0)
+      arcLength = initialLoadIncrement*directionNorm;
+    double predictorSign = 1.0;
+    if(havePreviousStep){
+      double previousDot;
+      incrementDirection->Dot(*previousStepIncrement, &previousDot);
+      predictorSign = previousDot + loadScaling*loadScaling*previousLoadIncrement*loadDerivativeDot < 0.0 ? -1.0 : 1.0;
+    }
+    double loadIncrement = 0.0;
+    if(directionNorm > 0.0 && !solveFailed){
+      loadIncrement = predictorSign*arcLength/directionNorm;
+    }
+    else{
+      solveFailed = true;
+    }
+
+    // If the predictor would pass the final time, or a previous attempt at this step converged beyond it, the step
+    // is instead taken under load control to the final time, such that the analysis ends exactly at the final time
+    bool finalStep = false;
+    if(!solveFailed && (timePrevious + loadIncrement >= timeFinal || loadControlToFinalTime)){
+      finalStep = true;
+      loadIncrement = timeFinal - timePrevious;
+    }
+    freeIncrement->Update(loadIncrement, *loadCorrection, 0.0);
+    timeCurrent = finalStep ? timeFinal : timePrevious + loadIncrement;
+
+    if(peridigmComm->MyPID() == 0){
+      cout << "Arc length step " << step << ", initial time = " << timePrevious << ", predicted time = " << timeCurrent
+           << ", arc length = " << arcLength << endl;
+      if(finalStep)
+        cout << "  final step, load control to the final time" << endl;
+    }
+
+    // Corrector:  Newton iterations on the residual augmented with the cylindrical (or spherical, if "Load Scaling" is nonzero)
+    // arc-length constraint, solved by bordering so that the tangent matrix is unchanged
+    double residualNorm = 1.0e50;
+    double toleranceMultiplier = 1.0;
+    int solverIteration = 1;
+    while(!solveFailed && solverIteration <= maxSolverIterations + 1){
+
+      // Residual, and its derivative with respect to the load factor (not needed under load control), at the current iterate
+      if(!finalStep)
+        arcLengthComputeResidual(loadDerivative, freeIncrement, probePrescribedIncrement, timeCurrent + loadProbe, timePrevious, loadProbe);
+      residualNorm = arcLengthComputeResidual(residual, freeIncrement, prescribedIncrement, timeCurrent, timePrevious, loadProbe);
+      if(!finalStep){
+        loadDerivative->Update(-1.0/loadProbe, *residual, 1.0/loadProbe);
+        prescribedRate->Update(1.0/loadProbe, *probePrescribedIncrement, -1.0/loadProbe, *prescribedIncrement, 0.0);
+      }
+
+      if(solverIteration == 1 && !useAbsoluteTolerance){
+        // compute the vector of reactions, i.e., the forces corresponding to degrees of freedom for which kinematic B.C. are applied
+        boundaryAndInitialConditionManager->applyKinematicBC_ComputeReactions(force, reaction, numMultiphysDoFs);
+        for(int i=0 ; i<reaction->MyLength() ; ++i)
+          (*reaction)[i] *= (*volume)[i/3];
+        double reactionNorm2;
+        reaction->Norm2(&reactionNorm2);
+        toleranceMultiplier = reactionNorm2;
+      }
+
+      if(peridigmComm->MyPID() == 0)
+        cout << "  iteration " << solverIteration << ": residual = " << residualNorm << ", time = " << timeCurrent << endl;
+
+      if(residualNorm <= tolerance*toleranceMultiplier || solverIteration > maxSolverIterations)
+        break;
+
+      // Track the total number of iterations taken over the simulation
+      *nonlinearSolverIterations += 1;
+
+      // Under load control (final step), a Newton correction at fixed load
+      if(finalStep){
+        arcLengthEvaluateTangent();
+        boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual, numMultiphysDoFs);
+        if(quasiStaticsSolveSystem(residual, residualCorrection, linearProblem, belosSolver) != Belos::Converged){
+          if(peridigmComm->MyPID() == 0)
+            cout << "\nError:  Belos linear solver failed to converge." << endl;
+          solveFailed = true;
+          break;
+        }
+        boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residualCorrection, numMultiphysDoFs);
+        freeIncrement->Update(1.0, *residualCorrection, 1.0);
+        solverIteration++;
+        continue;
+      }
+
+      // Two solves with the same tangent, one for the residual and one for the reference load
+      arcLengthEvaluateTangent();
+      boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual, numMultiphysDoFs);
+      if(quasiStaticsSolveSystem(residual, residualCorrection, linearProblem, belosSolver) != Belos::Converged ||
+         quasiStaticsSolveSystem(loadDerivative, loadCorrection, linearProblem, belosSolver) != Belos::Converged){
+        if(peridigmComm->MyPID() == 0)
+          cout << "\nError:  Belos linear solver failed to converge." << endl;
+        solveFailed = true;
+        break;
+      }
+      boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residualCorrection, numMultiphysDoFs);
+      boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(loadCorrection, numMultiphysDoFs);
+
+      // The total increment after the correction is (increment + residualCorrection) + deltaLoad*incrementDirection,
+      // substitution into the arc-length constraint gives a quadratic equation for deltaLoad
+      increment->Update(1.0, *freeIncrement, 1.0, *prescribedIncrement, 0.0);
+      correctedIncrement->Update(1.0, *increment, 1.0, *residualCorrection, 0.0);
+      incrementDirection->Update(1.0, *loadCorrection, 1.0, *prescribedRate, 0.0);
+      double aDotA, aDotB, bDotB;
+      correctedIncrement->Dot(*correctedIncrement, &aDotA);
+      correctedIncrement->Dot(*incrementDirection, &aDotB);
+      incrementDirection->Dot(*incrementDirection, &bDotB);
+      loadDerivative->Dot(*loadDerivative, &loadDerivativeDot);
+      double psi2q = loadScaling*loadScaling*loadDerivativeDot;
+      double a1 = bDotB + psi2q;
+      double a2 = 2.0*(aDotB + psi2q*loadIncrement);
+      double a3 = aDotA + psi2q*loadIncrement*loadIncrement - arcLength*arcLength;
+      double discriminant = a2*a2 - 4.0*a1*a3;
+      if(a1 <= 0.0 || discriminant < 0.0){
+        if(peridigmComm->MyPID() == 0)
+          cout << "  --arc-length constraint has no real root--" << endl;
+        solveFailed = true;
+        break;
+      }
+
+      // Of the two roots, take the one whose increment makes the smallest angle with the current increment
+      double root[2];
+      root[0] = (-a2 + sqrt(discriminant))/(2.0*a1);
+      root[1] = (-a2 - sqrt(discriminant))/(2.0*a1);
+      double aDotIncrement, bDotIncrement, incrementDot;
+      correctedIncrement->Dot(*increment, &aDotIncrement);
+      incrementDirection->Dot(*increment, &bDotIncrement);
+      increment->Dot(*increment, &incrementDot);
+      double cosine[2];
+      for(int r=0 ; r<2 ; ++r)
+        cosine[r] = aDotIncrement + root[r]*bDotIncrement + psi2q*loadIncrement*(loadIncrement + root[r]);
+      double deltaLoad = cosine[0] >= cosine[1] ? root[0] : root[1];
+
+      freeIncrement->Update(1.0, *residualCorrection, deltaLoad, *loadCorrection, 1.0);
+      loadIncrement += deltaLoad;
+      timeCurrent = timePrevious + loadIncrement;
+
+      solverIteration++;
+    }
+
+    // If the step did not converge, repeat it with a shorter arc length
+    // State N in the data managers has not been modified, so the step is simply restarted from the last converged state
+    bool stepConverged = !solveFailed && boost::math::isfinite(residualNorm) && residualNorm <= tolerance*toleranceMultiplier;
+    if(stepConverged && !finalStep && timeCurrent > timeFinal){
+      loadControlToFinalTime = true;
+      timeCurrent = timePrevious;
+      if(peridigmComm->MyPID() == 0)
+        cout << "  --arc-length step converged beyond the final time, repeating the step under load control--\n" << endl;
+      continue;
+    }
+    if(!stepConverged){
+      if(numArcLengthCutbacks < maxArcLengthCutbacks){
+        numArcLengthCutbacks++;
+        arcLength *= arcLengthCutbackFactor;
+        loadControlToFinalTime = false;
+        timeCurrent = timePrevious;
+        if(peridigmComm->MyPID() == 0)
+          cout << "  --arc-length step failed to converge, reducing arc length to " << arcLength
+               << " (cutback " << numArcLengthCutbacks << " of " << maxArcLengthCutbacks << ")--\n" << endl;
+        continue;
+      }
+      if(!solveFailed && residualNorm < 100.0*tolerance*toleranceMultiplier){
+        if(peridigmComm->MyPID() == 0)
+          cout << "\nWarning:  Accepting current solution and progressing to next arc-length step.\n" << endl;
+      }
+      else{
+        if(peridigmComm->MyPID() == 0)
+          cout << "\nError:  Aborting analysis.\n" << endl;
+        break;
+      }
+    }
+
+    // Print step timing information
+    double CPUTime = loadStepCPUTime.ElapsedTime();
+    cumulativeLoadStepCPUTime += CPUTime;
+    if(peridigmComm->MyPID() == 0){
+      if(solverVerbose)
+        cout << "  converged time = " << timeCurrent << ", load increment = " << loadIncrement << endl;
+      cout << setprecision(2) << "  cpu time for arc-length step = " << CPUTime << " sec., cumulative cpu time = " << cumulativeLoadStepCPUTime << " sec.\n" << endl;
+    }
+
+    // Add the converged displacement increment to the displacement
+    previousStepIncrement->Update(1.0, *freeIncrement, 1.0, *prescribedIncrement, 0.0);
+    previousLoadIncrement = loadIncrement;
+    havePreviousStep = true;
+    for(int i=0 ; i<u->MyLength() ; ++i)
+      (*u)[i] += (*deltaU)[i];
+
+    // Write output for completed step
+    PeridigmNS::Timer::self().startTimer("Output");
+    synchDataManagers();
+    outputManager->write(blocks, timeCurrent, maxArcLengthSteps);
+    PeridigmNS::Timer::self().stopTimer("Output");
+
+    // swap state N and state NP1
+    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+      blockIt->updateState();
+
+    // Scale the arc length with the ratio of desired to actual iterations
+    int numIterations = solverIteration - 1 > 0 ? solverIteration - 1 : 1;
+    double growthFactor = sqrt(static_cast<double>(desiredSolverIterations)/numIterations);
+    arcLength *= std::min(growthFactor, maxArcLengthGrowthFactor);
+    numArcLengthCutbacks = 0;
+    loadControlToFinalTime = false;
+    step++;
+
+  } // end loop over arc-length steps
+
+  if(timeCurrent < timeFinal && peridigmComm->MyPID() == 0)
+    cout << "\nWarning:  ArcLength solver stopped at time " << timeCurrent << " before reaching the final time " << timeFinal << "." << endl;
+
+  if(peridigmComm->MyPID() == 0)
+    cout << endl;
+}
+
+void PeridigmNS::Peridigm::arcLengthEvaluateTangent() {
+  tangent->PutScalar(0.0);
+  PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
+  modelEvaluator->evalJacobian(workset);
+  int err = overlapJacobian->globalAssemble();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::executeArcLength(), GlobalAssemble() returned nonzero error code.\n");
+  PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
+  boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent, numMultiphysDoFs);
+  tangent->Scale(-1.0);
+}
+
+void PeridigmNS::Peridigm::quasiStaticsSetPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem) {
+  Ifpack IFPFactory;
+  Teuchos::ParameterList ifpackList;
+
+  if (linearProblem.isHermitian()) { // assume matrix Hermitian; construct IC preconditioner
+    Teuchos::RCP<Ifpack_Preconditioner> Prec = Teuchos::rcp( IFPFactory.Create("IC", &(*tangent), 0) );
+    Teuchos::ParameterList ifpackList;
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->SetParameters(ifpackList),
+  		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->SetParameters() returned nonzero error code.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Initialize(),
+		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Initialize() returned nonzero error code.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Compute(),
+		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Compute() returned nonzero error code.\n");
+    // Create the Belos preconditioned operator from the Ifpack preconditioner.
+    // NOTE:  This is necessary because Belos expects an operator to apply the
+    //        preconditioner with Apply() NOT ApplyInverse().
+    Teuchos::RCP<Belos::EpetraPrecOp> belosPrec = Teuchos::rcp( new Belos::EpetraPrecOp( Prec ) );
+    linearProblem.setLeftPrec( belosPrec );
+  }
+  else { // assume matrix non-Hermitian; construct ILU preconditioner
+    std::string PrecType = "ILU"; // incomplete LU
+    int OverlapLevel = 1; // must be >= 0. If Comm.NumProc() == 1, param is ignored.
+    Teuchos::RCP<Ifpack_Preconditioner> Prec = Teuchos::rcp( IFPFactory.Create(PrecType, &(*tangent), OverlapLevel) );
+    // specify parameters for ILU
+    ifpackList.set("fact: drop tolerance", 1e-9);
+    ifpackList.set("fact: ilut level-of-fill", 1);
+    // the combine mode is on the following: "Add", "Zero", "Insert", "InsertAdd", "Average", "AbsMax"
+    ifpackList.set("schwarz: combine mode", "Add");
+    // sets the parameters
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->SetParameters(ifpackList),
+  		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->SetParameters() returned nonzero error code.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Initialize(),
+		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Initialize() returned nonzero error code.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(Prec->Compute(),
+		      "**** PeridigmNS::Peridigm::executeQuasiStatic(), Prec->Compute() returned nonzero error code.\n");
+    // Create the Belos preconditioned operator from the Ifpack preconditioner.
+    // NOTE:  This is necessary because Belos expects an operator to apply the
+    //        preconditioner with Apply() NOT ApplyInverse().
+    Teuchos::RCP<Belos::EpetraPrecOp> belosPrec = Teuchos::rcp( new Belos::EpetraPrecOp( Prec ) );
+    linearProblem.setLeftPrec( belosPrec );
+  }
+}
+
+void PeridigmNS::Peridigm::quasiStaticsDampTangent(double dampedNewtonDiagonalScaleFactor,
+                                                   double dampedNewtonDiagonalShiftFactor) {
+  // Create a vector to store the diagonal
+  static Teuchos::RCP<Epetra_Vector> diagonal;
+  if(diagonal.is_null() || !diagonal->Map().SameAs(tangent->Map()))
+    diagonal = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+
+  // Extract the diagonal, modify it, and re-insert it into the tangent
+  tangent->ExtractDiagonalCopy(*diagonal);
+  diagonal->Scale(dampedNewtonDiagonalScaleFactor);
+  double diagonalNormInf;
+  diagonal->NormInf(&diagonalNormInf);
+  double* diagonalPtr;
+  diagonal->ExtractView(&diagonalPtr);
+  for(int i=0 ; i<diagonal->MyLength() ; ++i)
+    diagonalPtr[i] += dampedNewtonDiagonalShiftFactor*diagonalNormInf;
+  tangent->ReplaceDiagonalValues(*diagonal);
+}
 
 Belos::ReturnType PeridigmNS::Peridigm::quasiStaticsSolveSystem(Teuchos::RCP<Epetra_Vector> residual,
 								Teuchos::RCP<Epetra_Vector> lhs,
@@ -3491,11 +4288,11 @@ double PeridigmNS::Peridigm::quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector>
                                                     Teuchos::RCP<Epetra_Vector> lhs,
                                                     double dt)
 {
-  Teuchos::RCP<Epetra_Vector> tempVector;
+  Teuchos::RCP<Epetra_Vector> tempVector = lineSearchDeltaU;
   if(analysisHasMultiphysics)
-  	tempVector = Teuchos::rcp(new Epetra_Vector(*combinedDeltaU));
+  	*tempVector = *combinedDeltaU;
   else
-  	tempVector = Teuchos::rcp(new Epetra_Vector(*deltaU));
+  	*tempVector = *deltaU;
 
   // Pointers into mothership vectors
   double *xPtr, *uPtr, *yPtr, *vPtr, *deltaUPtr, *lhsPtr, *residualPtr;
@@ -3521,6 +4318,7 @@ double PeridigmNS::Peridigm::quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector>
 
   // compute the current residual
   double unperturbedResidualNorm = computeQuasiStaticResidual(residual);
+  lineSearchResidualEvaluations += 1;
   TEUCHOS_TEST_FOR_EXCEPT_MSG(!boost::math::isfinite(unperturbedResidualNorm), "**** NaN detected in residual calculation in quasiStaticsLineSearch().\n");
   if(unperturbedResidualNorm == 0.0)
     return 0.0;
@@ -3564,8 +4362,9 @@ double PeridigmNS::Peridigm::quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector>
   	}
   }
 
-  Teuchos::RCP<Epetra_Vector> perturbedResidual = Teuchos::rcp(new Epetra_Vector(*residual));
+  Teuchos::RCP<Epetra_Vector> perturbedResidual = lineSearchWork;
   computeQuasiStaticResidual(perturbedResidual);
+  lineSearchResidualEvaluations += 1;
   double SR, SPerturbedR;
   lhs->Dot(*residual, &SR);
   lhs->Dot(*perturbedResidual, &SPerturbedR);
@@ -3624,6 +4423,7 @@ double PeridigmNS::Peridigm::quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector>
     }
 
     double residualNorm = computeQuasiStaticResidual(residual);
+    lineSearchResidualEvaluations += 1;
 		if(analysisHasMultiphysics){
 			*combinedDeltaU = *tempVector;
 		}
@@ -3699,6 +4499,7 @@ double PeridigmNS::Peridigm::quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector>
     }
 
     double residualNorm = computeQuasiStaticResidual(residual);
+    lineSearchResidualEvaluations += 1;
 	if(analysisHasMultiphysics){
       *combinedDeltaU = *tempVector;
 	}
@@ -3744,6 +4545,172 @@ double PeridigmNS::Peridigm::quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector>
   return bestAlpha;
 }
 
+double PeridigmNS::Peridigm::quasiStaticsBacktrackingLineSearch(Teuchos::RCP<Epetra_Vector> residual,
+                                                                Teuchos::RCP<Epetra_Vector> lhs,
+                                                                double dt,
+                                                                int maxEvaluations,
+                                                                double sufficientDecrease,
+                                                                double& residualNorm,
+                                                                bool& stepApplied)
+{
+  stepApplied = false;
+
+  // Trial steps are taken relative to the current displacement increment
+  if(analysisHasMultiphysics)
+    *lineSearchDeltaU = *combinedDeltaU;
+  else
+    *lineSearchDeltaU = *deltaU;
+
+  // Merit function phi(alpha) = 0.5*||R||^2, the residual passed in corresponds to alpha = 0
+  double residualL2;
+  residual->Norm2(&residualL2);
+  double phi0 = 0.5*residualL2*residualL2;
+  if(phi0 == 0.0)
+    return 0.0;
+
+  // Directional derivative of the merit function, phi'(0) = -R^T K s, where the tangent K has been scaled by -1.
+  // If the search direction is not a descent direction for the current tangent (e.g., the predictor step),
+  // fall back to the value for an exact Newton step, phi'(0) = -||R||^2.
+  tangent->Multiply(false, *lhs, *lineSearchWork);
+  double slope;
+  residual->Dot(*lineSearchWork, &slope);
+  slope *= -1.0;
+  if(!(slope < 0.0))
+    slope = -2.0*phi0;
+
+  double alpha = 1.0;
+  double previousAlpha = 0.0;
+  double previousPhi = 0.0;
+  bool previousPhiIsFinite = false;
+  double bestAlpha = 1.0;
+  double bestPhi = 1.0e50;
+  for(int evaluation=1 ; evaluation<=maxEvaluations ; ++evaluation){
+
+    quasiStaticsApplyLineSearchStep(alpha, lhs, dt);
+    double trialResidualNorm = computeQuasiStaticResidual(residual);
+    lineSearchResidualEvaluations += 1;
+    residual->Norm2(&residualL2);
+    double phi = 0.5*residualL2*residualL2;
+    bool phiIsFinite = boost::math::isfinite(phi);
+
+    if(phiIsFinite && phi < bestPhi){
+      bestAlpha = alpha;
+      bestPhi = phi;
+    }
+
+    // Armijo sufficient decrease condition
+    if(phiIsFinite && phi <= phi0 + sufficientDecrease*alpha*slope){
+      residualNorm = trialResidualNorm;
+      stepApplied = true;
+      return alpha;
+    }
+
+    // Select the next step length
+    double nextAlpha;
+    if(!phiIsFinite){
+      nextAlpha = 0.5*alpha;
+    }
+    else if(!previousPhiIsFinite){
+      // Minimizer of the quadratic interpolating phi(0), phi'(0), and phi(alpha)
+      nextAlpha = -0.5*slope*alpha*alpha/(phi - phi0 - slope*alpha);
+    }
+    else{
+      // Minimizer of the cubic interpolating phi(0), phi'(0), and the two most recent trial points
+      double f1 = (phi - phi0 - slope*alpha)/(alpha*alpha);
+      double f2 = (previousPhi - phi0 - slope*previousAlpha)/(previousAlpha*previousAlpha);
+      double a = (f1 - f2)/(alpha - previousAlpha);
+      double b = (-previousAlpha*f1 + alpha*f2)/(alpha - previousAlpha);
+      if(a == 0.0){
+        nextAlpha = -0.5*slope/b;
+      }
+      else{
+        double discriminant = b*b - 3.0*a*slope;
+        if(discriminant < 0.0)
+          nextAlpha = 0.5*alpha;
+        else if(b <= 0.0)
+          nextAlpha = (-b + sqrt(discriminant))/(3.0*a);
+        else
+          nextAlpha = -slope/(b + sqrt(discriminant));
+      }
+    }
+
+    // Safeguard the reduction of the step length
+    if(!boost::math::isfinite(nextAlpha) || nextAlpha > 0.5*alpha)
+      nextAlpha = 0.5*alpha;
+    if(nextAlpha < 0.1*alpha)
+      nextAlpha = 0.1*alpha;
+
+    previousAlpha = alpha;
+    previousPhi = phi;
+    previousPhiIsFinite = phiIsFinite;
+    alpha = nextAlpha;
+  }
+
+  // No step satisfied the sufficient decrease condition, restore the displacement increment and return the best step found
+  if(analysisHasMultiphysics)
+    *combinedDeltaU = *lineSearchDeltaU;
+  else
+    *deltaU = *lineSearchDeltaU;
+
+  if(peridigmComm->MyPID() == 0)
+    cout << "  --line search did not satisfy the sufficient decrease condition in " << maxEvaluations << " evaluations, selecting alpha = " << bestAlpha << "--" << endl;
+
+  return bestAlpha;
+}
+
+void PeridigmNS::Peridigm::quasiStaticsApplyLineSearchStep(double alpha,
+                                                           Teuchos::RCP<Epetra_Vector> lhs,
+                                                           double dt)
+{
+  double *xPtr, *uPtr, *yPtr, *vPtr, *deltaUPtr, *lhsPtr, *startPtr;
+  x->ExtractView( &xPtr );
+  u->ExtractView( &uPtr );
+  y->ExtractView( &yPtr );
+  v->ExtractView( &vPtr );
+  deltaU->ExtractView( &deltaUPtr );
+  lhs->ExtractView( &lhsPtr );
+  lineSearchDeltaU->ExtractView( &startPtr );
+
+  if(analysisHasMultiphysics){
+    double *combinedUPtr, *combinedYPtr, *combinedVPtr, *combinedDeltaUPtr;
+    double *fluidPressureDeltaUPtr, *fluidPressureYPtr, *fluidPressureVPtr;
+    combinedU->ExtractView( &combinedUPtr );
+    combinedY->ExtractView( &combinedYPtr );
+    combinedV->ExtractView( &combinedVPtr );
+    combinedDeltaU->ExtractView( &combinedDeltaUPtr );
+    fluidPressureY->ExtractView( &fluidPressureYPtr );
+    fluidPressureV->ExtractView( &fluidPressureVPtr );
+    fluidPressureDeltaU->ExtractView( &fluidPressureDeltaUPtr );
+    for(int i=0 ; i<combinedY->MyLength() ; i+=(3+numMultiphysDoFs)){
+      for(int j=0 ; j<3 ; ++j){
+        combinedDeltaUPtr[i+j] = startPtr[i+j] + alpha*lhsPtr[i+j];
+        combinedYPtr[i+j] = xPtr[i*3/(3+numMultiphysDoFs)+j] + combinedUPtr[i+j] + combinedDeltaUPtr[i+j];
+        combinedVPtr[i+j] = combinedDeltaUPtr[i+j]/dt;
+      }
+      combinedDeltaUPtr[i+3] = startPtr[i+3] + alpha*lhsPtr[i+3];
+      combinedYPtr[i+3] = combinedUPtr[i+3] + combinedDeltaUPtr[i+3];
+      combinedVPtr[i+3] = combinedDeltaUPtr[i+3]/dt;
+    }
+    for(int i=0 ; i<y->MyLength() ; i+=3){
+      for(int j=0 ; j<3 ; ++j){
+        deltaUPtr[i+j] = combinedDeltaUPtr[i/3*(3+numMultiphysDoFs) + j];
+        yPtr[i+j] = combinedYPtr[i/3*(3+numMultiphysDoFs) + j];
+        vPtr[i+j] = combinedVPtr[i/3*(3+numMultiphysDoFs) + j];
+      }
+      fluidPressureDeltaUPtr[i/3] = combinedDeltaUPtr[i/3*(3+numMultiphysDoFs) + 3];
+      fluidPressureYPtr[i/3] = combinedYPtr[i/3*(3+numMultiphysDoFs) + 3];
+      fluidPressureVPtr[i/3] = combinedVPtr[i/3*(3+numMultiphysDoFs) + 3];
+    }
+  }
+  else{
+    for(int i=0 ; i<y->MyLength() ; ++i){
+      deltaUPtr[i] = startPtr[i] + alpha*lhsPtr[i];
+      yPtr[i] = xPtr[i] + uPtr[i] + deltaUPtr[i];
+      vPtr[i] = deltaUPtr[i]/dt;
+    }
+  }
+}
+
 void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList> solverParams) {
 	//TODO: Eliminate fluid pressure V
 
@@ -3781,6 +4748,49 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
   double dt2 = dt*dt;
   int nsteps = (int)floor((timeFinal-timeInitial)/dt);
 
+  // Adaptive time stepping:  time steps that fail to converge are repeated with a reduced time step,
+  // and the time step is increased again (up to "Fixed dt") after steps that converge quickly
+  bool adaptiveTimeStepping = implicitParams->get("Adaptive Time Stepping", false);
+  int maxTimeStepCutbacks = implicitParams->get("Maximum Time Step Cutbacks", 5);
+  double timeStepCutbackFactor = implicitParams->get("Time Step Cutback Factor", 0.5);
+  double timeStepGrowthFactor = implicitParams->get("Time Step Growth Factor", 1.5);
+  int timeStepGrowthIterationThreshold = implicitParams->get("Time Step Growth Iteration Threshold", 4);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(timeStepCutbackFactor <= 0.0 || timeStepCutbackFactor >= 1.0, "**** Error:  \"Time Step Cutback Factor\" must be between zero and one.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(timeStepGrowthFactor < 1.0, "**** Error:  \"Time Step Growth Factor\" must be greater than or equal to one.\n");
+  const double nominalDt = dt;
+  int numTimeStepCutbacks = 0;
+
+  // Jacobian-free Newton-Krylov:  the tangent is replaced by directional derivatives of the residual, and the tangent
+  // matrix (typically the block diagonal tangent, see "Peridigm Preconditioner") is used only as a preconditioner
+  string jacobianOperator = implicitParams->get("Jacobian Operator", "Have Jacobian");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(jacobianOperator != "Have Jacobian" && jacobianOperator != "Matrix-Free",
+                              "**** Error:  Invalid \"Jacobian Operator\", valid options are \"Have Jacobian\" and \"Matrix-Free\".\n");
+  const bool isMatrixFree = (jacobianOperator == "Matrix-Free");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(isMatrixFree && analysisHasMultiphysics, "**** Error:  \"Jacobian Operator\" = \"Matrix-Free\" is not supported for multiphysics analyses.\n");
+  bool useMatrixFreePreconditioner = true;
+  if(solverParams->isParameter("Peridigm Preconditioner") && solverParams->get<string>("Peridigm Preconditioner") == "None")
+    useMatrixFreePreconditioner = false;
+  Teuchos::RCP<Epetra_Vector> u2;
+  Teuchos::RCP<Epetra_Vector> v2;
+  Teuchos::RCP<PeridigmNS::FiniteDifferenceJacobianOperator> matrixFreeOperator;
+  Teuchos::RCP<Epetra_Vector> matrixFreeBaseResidual;
+  if(isMatrixFree){
+    Teuchos::RCP<Epetra_Vector> freeDoFMask = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+    freeDoFMask->PutScalar(1.0);
+    boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(freeDoFMask, numMultiphysDoFs);
+    // The Newmark predictors and the time step are captured by reference, so the operator follows their values at each step
+    PeridigmNS::FiniteDifferenceJacobianOperator::ResidualFunction implicitResidual =
+      [this, &u2, &v2, &beta, &gamma, &dt](Teuchos::RCP<const Epetra_Vector> uTrial, Teuchos::RCP<Epetra_Vector> trialResidual){
+        computeImplicitResidual(uTrial, u2, v2, beta, gamma, dt, Teuchos::null, trialResidual);
+      };
+    matrixFreeOperator = Teuchos::rcp(new PeridigmNS::FiniteDifferenceJacobianOperator(tangent->RowMap(), *threeDimensionalMap, freeDoFMask,
+                                                                                       implicitParams->get("Matrix-Free Perturbation", 1.0e-6),
+                                                                                       implicitResidual, "Peridigm Implicit Matrix-Free Operator"));
+    matrixFreeBaseResidual = Teuchos::rcp(new Epetra_Vector(tangent->Map()));
+    if(peridigmComm->MyPID() == 0)
+      cout << "Implicit time integration with matrix-free Jacobian operator\n" << endl;
+  }
+
   // Pointer index into sub-vectors for use with BLAS
   double *xPtr, *uPtr, *yPtr, *vPtr, *aPtr;
   double *fluidPressureUPtr, *fluidPressureYPtr, *fluidPressureVPtr;
@@ -3806,13 +4816,20 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
   int verbosity = Belos::Errors + Belos::Warnings;
   belosList.set( "Verbosity", verbosity );
   belosList.set( "Output Style", Belos::Brief );
-  Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> > belosSolver
-    = Teuchos::rcp( new Belos::BlockCGSolMgr<double,Epetra_MultiVector,Epetra_Operator>(Teuchos::rcp(&linearProblem,false), Teuchos::rcp(&belosList,false)) );
+  Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> > belosSolver;
+  if(isMatrixFree){
+    // The finite-difference operator is not exactly symmetric, and its accuracy limits the attainable linear solver tolerance
+    belosList.set( "Convergence Tolerance", implicitParams->get("Matrix-Free Linear Solver Tolerance", 1.0e-6) );
+    belosList.set( "Num Blocks", implicitParams->get("Matrix-Free Krylov Subspace Size", 100) ); // Maximum number of blocks in Krylov factorization
+    belosList.set( "Maximum Restarts", 10 ); // Maximum number of restarts allowed
+    belosSolver = Teuchos::rcp( new Belos::BlockGmresSolMgr<double,Epetra_MultiVector,Epetra_Operator>(Teuchos::rcp(&linearProblem,false), Teuchos::rcp(&belosList,false)) );
+  }
+  else{
+    belosSolver = Teuchos::rcp( new Belos::BlockCGSolMgr<double,Epetra_MultiVector,Epetra_Operator>(Teuchos::rcp(&linearProblem,false), Teuchos::rcp(&belosList,false)) );
+  }
 
   // Create temporary owned (e.g., "mothership") vectors for data at timestep n
   // to be used in Newmark integration
-  Teuchos::RCP<Epetra_Vector> u2;
-  Teuchos::RCP<Epetra_Vector> v2;
   Teuchos::RCP<Epetra_Vector> fluidPressureU2;
 
   u2 = Teuchos::rcp(new Epetra_Vector(*threeDimensionalMap));
@@ -3832,10 +4849,22 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
   outputManager->write(blocks, timeCurrent, nsteps);
   PeridigmNS::Timer::self().stopTimer("Output");
 
-  for(int step=0; step<nsteps ; step++){
+  int step = 0;
+  while(adaptiveTimeStepping ? timeFinal - timeCurrent > 1.0e-10*nominalDt : step < nsteps){
+
+    // The residual is scaled by beta*dt*dt, so with a varying time step the tolerance is scaled by the same factor,
+    // relative to "Fixed dt", to keep the convergence criterion on the force balance itself independent of the step
+    double stepTolerance = absoluteTolerance;
+    if(adaptiveTimeStepping){
+      if(timeCurrent + dt > timeFinal)
+        dt = timeFinal - timeCurrent;
+      dt2 = dt*dt;
+      workset->timeStep = dt;
+      stepTolerance = absoluteTolerance*dt2/(nominalDt*nominalDt);
+    }
 
     if(peridigmComm->MyPID() == 0)
-      cout << "Load step " << step << ", initial time = " << step*dt << ", final time = " << (step+1)*dt << endl;
+      cout << "Load step " << step << ", initial time = " << timeCurrent - timeInitial << ", final time = " << timeCurrent - timeInitial + dt << endl;
 
     *un = *u;
     *vn = *v;
@@ -3872,113 +4901,22 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
     // Fill the owned vectors with probe data
     // Assign predictor (use u2)
     u->Update(1.0, *u2, 0.0);
-    // a = (1.0/(beta*dt*dt))*(u_np1 - u2);
-    // a will be zero unless a different predictor is used, so do the following computation anyway
-    a->Update(1.0, *u, -1.0, *u2, 0.0);
-    a->Scale(1.0/(beta*dt2));
-    // v = v2 + dt*gamma*an
-    v->Update(1.0, *v2, dt*gamma, *a, 0.0);
-    // Update y to be consistent with u
-    y->Update(1.0, *x, 1.0, *u, 0.0);
-
-    if(analysisHasMultiphysics){
-	fluidPressureU->Update(1.0,*fluidPressureU2,0.0);
-	fluidPressureY->Update(1.0, *fluidPressureU, 0.0);
-    }
-
-    // Copy data from mothership vectors to overlap vectors in data manager
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*a, accelerationFieldId, PeridigmField::STEP_NP1, Insert);
-      blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
-      if(analysisHasMultiphysics){
-	blockIt->importData(*fluidPressureU, fluidPressureUFieldId, PeridigmField::STEP_NP1, Insert);
-	blockIt->importData(*fluidPressureY, fluidPressureYFieldId, PeridigmField::STEP_NP1, Insert);
-	blockIt->importData(*fluidPressureV, fluidPressureVFieldId, PeridigmField::STEP_NP1, Insert);
-      }
-    }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
-
-    // Update forces based on new positions
-    PeridigmNS::Timer::self().startTimer("Internal Force");
-    modelEvaluator->evalModel(workset);
-    PeridigmNS::Timer::self().stopTimer("Internal Force");
-
-    // Copy force from the data manager to the mothership vector
-    force->PutScalar(0.0);
-    if(analysisHasMultiphysics){
-	fluidFlow->PutScalar(0.0);
-	for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
- 		scratch->PutScalar(0.0);
-		scratchOneD->PutScalar(0.0);
-
-		blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-		blockIt->exportData(*scratchOneD, fluidFlowDensityFieldId, PeridigmField::STEP_NP1, Add);
-
-		force->Update(1.0, *scratch, 1.0);
-		fluidFlow->Update(1.0, *scratchOneD, 1.0);
-	}
-	scratchOneD->PutScalar(0.0);
-    }
-    else{
-	for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-		scratch->PutScalar(0.0);
-
-		blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-
-		force->Update(1.0, *scratch, 1.0);
-	}
-    }
-    scratch->PutScalar(0.0);
-
+    if(analysisHasMultiphysics)
+      fluidPressureU->Update(1.0,*fluidPressureU2,0.0);
 
-    // evaluate the external (body) forces:
+    // evaluate the external (body) forces, which are fixed over the time step
     PeridigmNS::Timer::self().startTimer("Apply Body Forces");
     boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, 0.0);
     PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
 
-    // Compute the residual
-    // residual = beta*dt*dt*(M*a - force)
-    // Note that due to restrictions to CrsMatrix, the residual has a different (but equivalent) map
-    // than the force and acceleration
-    if(analysisHasMultiphysics){
-	for(int i=0 ; i<residual->MyLength() ; i+=(3+numMultiphysDoFs)){
-	    for(int j=0 ; j<3 ; ++j){
-		(*residual)[i+j] = beta*dt2*( (*density)[i/(3+numMultiphysDoFs)] *
-				   (*a)[i/(3+numMultiphysDoFs)*3+j] -
-				   (*force)[i/(3+numMultiphysDoFs)*3+j] -
-				   (*externalForce)[i/(3+numMultiphysDoFs)*3+j]);
-		}
-			//      Expression based off of the backward Euler integration scheme as well
-			//      as Equation (34) from "A state-based peridynamic formulation of diffusive mass
-			//      transport" (Amit Katiyar, John T. Foster, and Mukul Sharma).
-			//
-			//	The residual measures how well the previous estimate of fluidPressureU_n+1
-			//	predicted the current estimate of fluidPressureU_n+1. If the difference is
-			//	minimal, little change change be expected with further iteration.
-			(*residual)[i+3] = ((*fluidPressureU)[i/(3+numMultiphysDoFs)]-
-				           (*fluidPressureUn)[i/(3+numMultiphysDoFs)])/dt -
-				           (*fluidFlow)[i/(3+numMultiphysDoFs)]/
-					   ((*fluidDensity)[i/(3+numMultiphysDoFs)]*
-					   (*fluidCompressibility)[i/(3+numMultiphysDoFs)]);
-	}
-    }
-    else{
-	for(int i=0 ; i<residual->MyLength() ; ++i)
-   	     (*residual)[i] = beta*dt2*( (*density)[i/3] * (*a)[i] - (*force)[i] - (*externalForce)[i]);
-    }
-
-    // Modify residual for kinematic BC
-    boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual, numMultiphysDoFs);
+    // Compute the residual for the predictor
+    computeImplicitResidual(u, u2, v2, beta, gamma, dt, fluidPressureUn, residual);
 
     double residualNorm;
     residual->Norm2(&residualNorm);
 
     int NLSolverIteration = 0;
-    while(residualNorm > absoluteTolerance && NLSolverIteration <= maxSolverIterations){
+    while(residualNorm > stepTolerance && NLSolverIteration <= maxSolverIterations){
 
       // Track the total number of iterations taken over the simulation
       *nonlinearSolverIterations += 1;
@@ -3987,10 +4925,20 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
         cout << "  iteration " << NLSolverIteration << ": residual = " << residualNorm << endl;
 
       // Fill the Jacobian
-      computeImplicitJacobian(beta, dt);
+      if(!isMatrixFree || useMatrixFreePreconditioner){
+        computeImplicitJacobian(beta, dt);
 
-      // Modify Jacobian for kinematic BC
-      boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent, numMultiphysDoFs);
+        // Modify Jacobian for kinematic BC
+        boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent, numMultiphysDoFs);
+      }
+
+      // For the matrix-free operator, the Jacobian is linearized about the current displacement and residual
+      if(isMatrixFree){
+        *matrixFreeBaseResidual = *residual;
+        matrixFreeOperator->setBasePoint(u, matrixFreeBaseResidual);
+        if(useMatrixFreePreconditioner)
+          quasiStaticsSetPreconditioner(linearProblem);
+      }
 
       // Want to solve J*displacementIncrement = -residual
       residual->Scale(-1.0);
@@ -4000,7 +4948,10 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
       if(analysisHasMultiphysics){
 	fluidPressureDeltaU->PutScalar(0.0);
       }
-      linearProblem.setOperator(tangent);
+      if(isMatrixFree)
+        linearProblem.setOperator(matrixFreeOperator);
+      else
+        linearProblem.setOperator(tangent);
 
       bool isSet = linearProblem.setProblem(displacementIncrement, residual);
 
@@ -4020,114 +4971,56 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
 
 	//Apply increment to fluidPressure displacement and current value analogues.
 	fluidPressureU->Update(1.0,*fluidPressureDeltaU,1.0);
-	fluidPressureY->Update(1.0, *fluidPressureU, 0.0);
       }
       // Apply increment in u to u
       for(int i=0 ; i<u->MyLength() ; i+=3)
 	for(int j=0 ; j<3 ; ++j)
           (*u)[i+j] += (*displacementIncrement)[(3+numMultiphysDoFs)*i/3+j];
 
-      // Update y to be consistent with u
-      y->Update(1.0, *x, 1.0, *u, 0.0);
-
-      // a = (1.0/(beta*dt*dt))*(u_np1 - u2);
-      a->Update(1.0, *u, -1.0, *u2, 0.0);
-      a->Scale(1.0/(beta*dt2));
-      // v = v2 + dt*gamma*an
-      v->Update(1.0, *v2, dt*gamma, *a, 0.0);
-
-      // Copy data from mothership vectors to overlap vectors in data manager
-      PeridigmNS::Timer::self().startTimer("Gather/Scatter");
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        blockIt->importData(*u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
-        blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
-        blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
-        blockIt->importData(*a, accelerationFieldId, PeridigmField::STEP_NP1, Insert);
-        blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
-
-	if(analysisHasMultiphysics){
-		blockIt->importData(*fluidPressureU, fluidPressureUFieldId, PeridigmField::STEP_NP1, Insert);
-		blockIt->importData(*fluidPressureY, fluidPressureYFieldId, PeridigmField::STEP_NP1, Insert);
-	}
-      }
-      PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
-
-      // Update forces based on new positions
-      PeridigmNS::Timer::self().startTimer("Internal Force");
-      modelEvaluator->evalModel(workset);
-      PeridigmNS::Timer::self().stopTimer("Internal Force");
-
-      // Copy force from the data manager to the mothership vector
-	force->PutScalar(0.0);
-	if(analysisHasMultiphysics){
-		fluidFlow->PutScalar(0.0);
-		for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-			scratch->PutScalar(0.0);
-			scratchOneD->PutScalar(0.0);
-
-			blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-			blockIt->exportData(*scratchOneD, fluidFlowDensityFieldId, PeridigmField::STEP_NP1, Add);
-
-			force->Update(1.0, *scratch, 1.0);
-			fluidFlow->Update(1.0, *scratchOneD, 1.0);
-		}
-		scratchOneD->PutScalar(0.0);
-	}
-	else{
-		for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-			scratch->PutScalar(0.0);
-
-			blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-
-			force->Update(1.0, *scratch, 1.0);
-		}
-	}
-	scratch->PutScalar(0.0);
-
-      // evaluate the external (body) forces:
-      PeridigmNS::Timer::self().startTimer("Apply Body Forces");
-      boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, 0.0);
-      PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
-
       // Compute residual vector and its norm
-      // residual = beta*dt*dt*(M*a - force)
-      // Note that due to restrictions to CrsMatrix, the residual has a different (but equivalent) map
-      // than the force and acceleration
-	if(analysisHasMultiphysics){
-		for(int i=0 ; i<residual->MyLength() ; i+=(3+numMultiphysDoFs)){
-			for(int j=0 ; j<3 ; ++j){
-				(*residual)[i+j] = beta*dt2*( (*density)[i/(3+numMultiphysDoFs)] *
-						 (*a)[i/(3+numMultiphysDoFs)*3+j] -
-						 (*force)[i/(3+numMultiphysDoFs)*3+j] -
-						 (*externalForce)[i/(3+numMultiphysDoFs)*3+j]);
-			}
-				//TODO: Values for fluid density and compressibility other than 1.0 and 1.0
-				//      need to be added, otherwise this expression is the transient diffusion
-				//      residual. It is based off of the backward Euler integration scheme as well
-				//      as Equation (34) from "A state-based peridynamic formulation of diffusive mass
-				//      transport" (Amit Katiyar, John T. Foster, and Mukul Sharma).
-				(*residual)[i+3] = (((*fluidPressureU)[i/(3+numMultiphysDoFs)]-
-						    (*fluidPressureUn)[i/(3+numMultiphysDoFs)])/dt -
-						    (*fluidFlow)[i/(3+numMultiphysDoFs)]);
-		}
-	}
-	else{
-		for(int i=0 ; i<residual->MyLength() ; ++i)
-			(*residual)[i] = beta*dt2*( (*density)[i/3] * (*a)[i] - (*force)[i] - (*externalForce)[i]);
-	}
-
-      // Modify residual for kinematic BC
-      boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual, numMultiphysDoFs);
-
+      computeImplicitResidual(u, u2, v2, beta, gamma, dt, fluidPressureUn, residual);
       residual->Norm2(&residualNorm);
 
       NLSolverIteration++;
     }
 
-    if(peridigmComm->MyPID() == 0)
-      cout << "  iteration " << NLSolverIteration << ": residual = " << residualNorm << "\n" << endl;
+    if(peridigmComm->MyPID() == 0){
+      cout << "  iteration " << NLSolverIteration << ": residual = " << residualNorm << endl;
+      if(isMatrixFree)
+        cout << "  cumulative matrix-free residual evaluations = " << matrixFreeOperator->getNumResidualEvaluations() << endl;
+      cout << endl;
+    }
 
-    timeCurrent = timeInitial + (step+1)*dt;
+    // If the time step did not converge, restore the state at the beginning of the step and repeat it with a reduced time step.
+    // State N in the data managers has not been modified.
+    bool timeStepConverged = boost::math::isfinite(residualNorm) && residualNorm <= stepTolerance;
+    if(adaptiveTimeStepping && !timeStepConverged){
+      if(numTimeStepCutbacks < maxTimeStepCutbacks){
+        *u = *un;
+        *v = *vn;
+        *a = *an;
+        y->Update(1.0, *x, 1.0, *u, 0.0);
+        if(analysisHasMultiphysics){
+          *fluidPressureU = *fluidPressureUn;
+          *fluidPressureV = *fluidPressureVn;
+          fluidPressureY->Update(1.0, *fluidPressureU, 0.0);
+        }
+        numTimeStepCutbacks++;
+        dt *= timeStepCutbackFactor;
+        if(peridigmComm->MyPID() == 0)
+          cout << "  --time step failed to converge, reducing time step to " << dt
+               << " (cutback " << numTimeStepCutbacks << " of " << maxTimeStepCutbacks << ")--\n" << endl;
+        continue;
+      }
+      if(peridigmComm->MyPID() == 0)
+        cout << "Warning:  Time step failed to converge after the maximum number of cutbacks, proceeding with nonconverged solution.\n" << endl;
+    }
+
+    if(adaptiveTimeStepping)
+      timeCurrent += dt;
+    else
+      timeCurrent = timeInitial + (step+1)*dt;
+    step++;
 
     // Write output for completed time step
     PeridigmNS::Timer::self().startTimer("Output");
@@ -4138,6 +5031,13 @@ void PeridigmNS::Peridigm::executeImplicit(Teuchos::RCP<Teuchos::ParameterList>
     // swap state N and state NP1
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
       blockIt->updateState();
+
+    // Increase the time step after a step that converged quickly, up to the user-specified time step
+    if(adaptiveTimeStepping){
+      numTimeStepCutbacks = 0;
+      if(timeStepConverged && NLSolverIteration <= timeStepGrowthIterationThreshold)
+        dt = std::min(timeStepGrowthFactor*dt, nominalDt);
+    }
   }
 }
 
@@ -4207,8 +5107,10 @@ void PeridigmNS::Peridigm::allocateJacobian(const int numDoFs) {
   }
 
   // Allocate space in the global Epetra_FECrsMatrix
+  // The graph for rows owned by other processors is retained for direct block assembly
   vector<int> indices;
   vector<double> zeros;
+  map< int, vector<int> > offProcessorGraph;
   for(map<int, boost::unordered_set<int> >::iterator rowEntry=rowEntries.begin(); rowEntry!=rowEntries.end() ; ++rowEntry){
     unsigned int numRowNonzeros = rowEntry->second.size();
     if(zeros.size() < numRowNonzeros)
@@ -4225,13 +5127,17 @@ void PeridigmNS::Peridigm::allocateJacobian(const int numDoFs) {
     int err = tangent->InsertGlobalValues(rowEntry->first, numRowNonzeros, (const double*)&zeros[0], (const int*)&indices[0]);
     TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** PeridigmNS::Peridigm::allocateJacobian(), InsertGlobalValues() returned negative error code.\n");
 
+    if(!tangentMap->MyGID(rowEntry->first))
+      offProcessorGraph[rowEntry->first] = indices;
+
     rowEntry->second.clear();
   }
   int err = tangent->GlobalAssemble();
   TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::allocateJacobian(), GlobalAssemble() returned nonzero error code.\n");
 
-  // create the serial Jacobian
+  // create the serial Jacobian, material models sum numDoFs x numDoFs node blocks directly into the tangent
   overlapJacobian = Teuchos::rcp(new PeridigmNS::SerialMatrix(tangent));
+  overlapJacobian->enableBlockAssembly(numDoFs, offProcessorGraph, peridigmParams->get("Verbose", false));
   workset->jacobian = overlapJacobian;
 
   PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
@@ -4296,6 +5202,61 @@ void PeridigmNS::Peridigm::allocateBlockDiagonalJacobian() {
   memstat->addStat(statTag);
 }
 
+void PeridigmNS::Peridigm::recordMemoryUsage(const std::string& phase) {
+
+  PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
+
+  // Field data stored in the DataManagers, summed over all blocks.
+  // Every processor holds the same set of blocks and fields, so the entries line up across processors in the parallel reduction.
+  std::map<int, double> bytesPerFieldId;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    blockIt->getDataManager()->accumulateMemoryUsage(bytesPerFieldId);
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  for(std::map<int, double>::const_iterator it = bytesPerFieldId.begin() ; it != bytesPerFieldId.end() ; ++it)
+    memstat->addAllocationStat("Field " + fieldManager.getFieldSpec(it->first).getLabel(), it->second);
+
+  // Neighbor lists
+  double neighborhoodBytes(0.0);
+  if(!globalNeighborhoodData.is_null())
+    neighborhoodBytes += globalNeighborhoodData->memorySizeInBytes();
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    if(!blockIt->getNeighborhoodData().is_null())
+      neighborhoodBytes += blockIt->getNeighborhoodData()->memorySizeInBytes();
+  }
+  memstat->addAllocationStat("Neighborhood Data", neighborhoodBytes);
+
+  // Global mothership vectors
+  double mothershipBytes(0.0);
+  Teuchos::RCP<Epetra_MultiVector> motherships[4] = {oneDimensionalMothership, threeDimensionalMothership, nDimensionalMothership, bondMothership};
+  for(int i=0 ; i<4 ; ++i){
+    if(!motherships[i].is_null())
+      mothershipBytes += static_cast<double>(motherships[i]->MyLength())*motherships[i]->NumVectors()*sizeof(double);
+  }
+  memstat->addAllocationStat("Mothership Vectors", mothershipBytes);
+
+  // Tangent matrices; values and column indices for each nonzero plus the row offsets
+  double jacobianBytes(0.0);
+  if(!tangent.is_null())
+    jacobianBytes += static_cast<double>(tangent->NumMyNonzeros())*(sizeof(double) + sizeof(int)) + static_cast<double>(tangent->NumMyRows() + 1)*sizeof(int);
+  if(!blockDiagonalTangent.is_null() && blockDiagonalTangent.get() != tangent.get())
+    jacobianBytes += static_cast<double>(blockDiagonalTangent->NumMyNonzeros())*(sizeof(double) + sizeof(int)) + static_cast<double>(blockDiagonalTangent->NumMyRows() + 1)*sizeof(int);
+  memstat->addAllocationStat("Jacobian", jacobianBytes);
+
+  // Contact neighbor lists and contact data
+  if(analysisHasContact){
+    std::map<std::string, double> contactBytes;
+    contactManager->accumulateMemoryUsage(contactBytes);
+    for(std::map<std::string, double>::const_iterator it = contactBytes.begin() ; it != contactBytes.end() ; ++it)
+      memstat->addAllocationStat(it->first, it->second);
+  }
+
+  // Temporary buffers used for output
+  if(!outputManager.is_null())
+    memstat->addAllocationStat("Exodus Output Buffers", outputManager->memorySizeInBytes());
+
+  memstat->addPeakRSSStat(phase);
+}
+
 double PeridigmNS::Peridigm::computeQuasiStaticResidual(Teuchos::RCP<Epetra_Vector> residual) {
 
   PeridigmNS::Timer::self().startTimer("Compute Residual");
@@ -4432,7 +5393,7 @@ void PeridigmNS::Peridigm::computeImplicitJacobian(double beta, double dt) {
   tangent->PutScalar(0.0);
   PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
   modelEvaluator->evalJacobian(workset);
-  int err = tangent->GlobalAssemble();
+  int err = overlapJacobian->globalAssemble();
   TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::computeImplicitJacobian(), GlobalAssemble() returned nonzero error code.\n");
   PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
 
@@ -4447,6 +5408,275 @@ void PeridigmNS::Peridigm::computeImplicitJacobian(double beta, double dt) {
   tangent->ReplaceDiagonalValues(diagonal);
 }
 
+void PeridigmNS::Peridigm::computeImplicitResidual(Teuchos::RCP<const Epetra_Vector> uTrial,
+                                                  Teuchos::RCP<const Epetra_Vector> u2,
+                                                  Teuchos::RCP<const Epetra_Vector> v2,
+                                                  double beta,
+                                                  double gamma,
+                                                  double dt,
+                                                  Teuchos::RCP<const Epetra_Vector> fluidPressureUn,
+                                                  Teuchos::RCP<Epetra_Vector> residual) {
+
+  PeridigmNS::Timer::self().startTimer("Compute Residual");
+
+  double dt2 = dt*dt;
+
+  // a = (1.0/(beta*dt*dt))*(u_np1 - u2);
+  a->Update(1.0, *uTrial, -1.0, *u2, 0.0);
+  a->Scale(1.0/(beta*dt2));
+  // v = v2 + dt*gamma*an
+  v->Update(1.0, *v2, dt*gamma, *a, 0.0);
+  // Update y to be consistent with u
+  y->Update(1.0, *x, 1.0, *uTrial, 0.0);
+  if(analysisHasMultiphysics)
+    fluidPressureY->Update(1.0, *fluidPressureU, 0.0);
+
+  // Copy data from mothership vectors to overlap vectors in data manager
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    blockIt->importData(*uTrial, displacementFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*v, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*a, accelerationFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
+    if(analysisHasMultiphysics){
+      blockIt->importData(*fluidPressureU, fluidPressureUFieldId, PeridigmField::STEP_NP1, Insert);
+      blockIt->importData(*fluidPressureY, fluidPressureYFieldId, PeridigmField::STEP_NP1, Insert);
+      blockIt->importData(*fluidPressureV, fluidPressureVFieldId, PeridigmField::STEP_NP1, Insert);
+    }
+  }
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+  // Update forces based on new positions
+  PeridigmNS::Timer::self().startTimer("Internal Force");
+  modelEvaluator->evalModel(workset);
+  PeridigmNS::Timer::self().stopTimer("Internal Force");
+
+  // Copy force from the data manager to the mothership vector
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  force->PutScalar(0.0);
+  if(analysisHasMultiphysics)
+    fluidFlow->PutScalar(0.0);
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    scratch->PutScalar(0.0);
+    blockIt->exportData(*scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+    force->Update(1.0, *scratch, 1.0);
+    if(analysisHasMultiphysics){
+      scratchOneD->PutScalar(0.0);
+      blockIt->exportData(*scratchOneD, fluidFlowDensityFieldId, PeridigmField::STEP_NP1, Add);
+      fluidFlow->Update(1.0, *scratchOneD, 1.0);
+    }
+  }
+  scratch->PutScalar(0.0);
+  if(analysisHasMultiphysics)
+    scratchOneD->PutScalar(0.0);
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+  // residual = beta*dt*dt*(M*a - force)
+  // Note that due to restrictions to CrsMatrix, the residual has a different (but equivalent) map
+  // than the force and acceleration
+  if(analysisHasMultiphysics){
+    const int stride = 3 + numMultiphysDoFs;
+    for(int i=0 ; i<residual->MyLength() ; i+=stride){
+      const int node = i/stride;
+      for(int j=0 ; j<3 ; ++j)
+        (*residual)[i+j] = beta*dt2*( (*density)[node]*(*a)[3*node+j] - (*force)[3*node+j] - (*externalForce)[3*node+j] );
+      // Expression based off of the backward Euler integration scheme as well as Equation (34) from "A state-based
+      // peridynamic formulation of diffusive mass transport" (Amit Katiyar, John T. Foster, and Mukul Sharma).
+      //
+      // The residual measures how well the previous estimate of fluidPressureU_n+1 predicted the current estimate
+      // of fluidPressureU_n+1. If the difference is minimal, little change change be expected with further iteration.
+      (*residual)[i+3] = ((*fluidPressureU)[node] - (*fluidPressureUn)[node])/dt -
+                         (*fluidFlow)[node]/((*fluidDensity)[node]*(*fluidCompressibility)[node]);
+    }
+  }
+  else{
+    for(int i=0 ; i<residual->MyLength() ; ++i)
+      (*residual)[i] = beta*dt2*( (*density)[i/3] * (*a)[i] - (*force)[i] - (*externalForce)[i]);
+  }
+
+  // Modify residual for kinematic BC
+  boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual, numMultiphysDoFs);
+
+  PeridigmNS::Timer::self().stopTimer("Compute Residual");
+}
+
+void PeridigmNS::Peridigm::computeHeatRate(Teuchos::RCP<const Epetra_Vector> temperature,
+                                           const std::vector<int>& thermalShockNodes,
+                                           Teuchos::RCP<Epetra_Vector> heatRate)
+{
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+    blockIt->importData(*temperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+  PeridigmNS::Timer::self().startTimer("Heat Flow");
+  modelEvaluator->evalHeatFlow(workset);
+  PeridigmNS::Timer::self().stopTimer("Heat Flow");
+
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  heatRate->PutScalar(0.0);
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    scratchOneD->PutScalar(0.0);
+    blockIt->exportData(*scratchOneD, heatFlowFieldId, PeridigmField::STEP_NP1, Add);
+    heatRate->Update(1.0, *scratchOneD, 1.0);
+  }
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+
+  // Source terms, consistent with the explicit update in executeExplicit()
+  for(int j=0 ; j<heatRate->MyLength() ; ++j)
+    (*heatRate)[j] += (*density)[j]*(*internalHeatSource)[j];
+  for(unsigned int i=0 ; i<thermalShockNodes.size() ; ++i){
+    int j = thermalShockNodes[i];
+    (*heatRate)[j] += (*convectionConstant)[j]*(-(*temperature)[j] + (*fluidTemperature)[j]) + (*internalHeatSource)[j];
+  }
+}
+
+void PeridigmNS::Peridigm::initializeImplicitThermalSolver(double theta,
+                                                           const std::vector<int>& thermalShockNodes,
+                                                           Teuchos::ParameterList& thermalSolverParams)
+{
+  implicitThermalTheta = theta;
+  implicitThermalShockNodes = thermalShockNodes;
+  implicitThermalMaxIterations = thermalSolverParams.get("Maximum Thermal Solver Iterations", 10);
+  implicitThermalTolerance = thermalSolverParams.get("Thermal Solver Tolerance", 1.0e-5);
+  const double linearSolverTolerance = thermalSolverParams.get("Thermal Linear Solver Tolerance", 1.0e-6);
+  const double perturbation = thermalSolverParams.get("Thermal Matrix-Free Perturbation", 1.0e-6);
+  const int krylovSubspaceSize = thermalSolverParams.get("Thermal Krylov Subspace Size", 100);
+
+  implicitThermalTemperatureN = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  implicitThermalHeatRateN = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  implicitThermalTemperature = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  implicitThermalHeatRate = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  implicitThermalHeatCapacityOverTimeStep = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+
+  // Prescribed temperatures are applied on fixed node sets, so the mask does not change over the analysis
+  implicitThermalFreeDoFMask = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  implicitThermalFreeDoFMask->PutScalar(1.0);
+  boundaryAndInitialConditionManager->applyTemperatureBC_InsertZeros(implicitThermalFreeDoFMask);
+
+  // The operator works on a point map with the same layout as the temperature map, as required by Epetra_Operator
+  Epetra_Map thermalMap(-1, oneDimensionalMap->NumMyElements(), oneDimensionalMap->MyGlobalElements(),
+                        oneDimensionalMap->IndexBase(), oneDimensionalMap->Comm());
+  PeridigmNS::FiniteDifferenceJacobianOperator::ResidualFunction thermalResidual =
+    [this](Teuchos::RCP<const Epetra_Vector> temperature, Teuchos::RCP<Epetra_Vector> residual){
+      computeImplicitThermalResidual(temperature, residual);
+    };
+  implicitThermalOperator = Teuchos::rcp(new PeridigmNS::FiniteDifferenceJacobianOperator(thermalMap, *oneDimensionalMap, implicitThermalFreeDoFMask,
+                                                                                          perturbation, thermalResidual,
+                                                                                          "Peridigm Implicit Thermal Operator"));
+
+  implicitThermalResidual = Teuchos::rcp(new Epetra_Vector(implicitThermalOperator->OperatorRangeMap()));
+  implicitThermalBaseResidual = Teuchos::rcp(new Epetra_Vector(implicitThermalOperator->OperatorRangeMap()));
+  implicitThermalIncrement = Teuchos::rcp(new Epetra_Vector(implicitThermalOperator->OperatorDomainMap()));
+
+  implicitThermalLinearProblem = Teuchos::rcp(new Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>);
+  implicitThermalLinearProblem->setOperator(implicitThermalOperator);
+  implicitThermalBelosParams = Teuchos::rcp(new Teuchos::ParameterList);
+  implicitThermalBelosParams->set( "Block Size", 1 );
+  implicitThermalBelosParams->set( "Maximum Iterations", implicitThermalOperator->OperatorDomainMap().NumGlobalElements() );
+  implicitThermalBelosParams->set( "Convergence Tolerance", linearSolverTolerance );
+  implicitThermalBelosParams->set( "Num Blocks", krylovSubspaceSize );
+  implicitThermalBelosParams->set( "Maximum Restarts", 10 );
+  implicitThermalBelosParams->set( "Output Frequency", -1 );
+  implicitThermalBelosParams->set( "Verbosity", Belos::Errors + Belos::Warnings );
+  implicitThermalBelosParams->set( "Output Style", Belos::Brief );
+  implicitThermalBelosSolver =
+    Teuchos::rcp( new Belos::BlockGmresSolMgr<double,Epetra_MultiVector,Epetra_Operator>(implicitThermalLinearProblem, implicitThermalBelosParams) );
+}
+
+void PeridigmNS::Peridigm::computeImplicitThermalResidual(Teuchos::RCP<const Epetra_Vector> temperature,
+                                                          Teuchos::RCP<Epetra_Vector> residual)
+{
+  computeHeatRate(temperature, implicitThermalShockNodes, implicitThermalHeatRate);
+
+  const double theta = implicitThermalTheta;
+  const double* mask = implicitThermalFreeDoFMask->Values();
+  const double* capacity = implicitThermalHeatCapacityOverTimeStep->Values();
+  const double* T = temperature->Values();
+  const double* TN = implicitThermalTemperatureN->Values();
+  const double* H = implicitThermalHeatRate->Values();
+  const double* HN = implicitThermalHeatRateN->Values();
+  double* R = residual->Values();
+  for(int j=0 ; j<residual->MyLength() ; ++j)
+    R[j] = mask[j]*( capacity[j]*(T[j] - TN[j]) - theta*H[j] - (1.0 - theta)*HN[j] );
+}
+
+void PeridigmNS::Peridigm::solveImplicitThermalStep(double thermalTimeStep,
+                                                    double timeNew,
+                                                    double timeCurrent,
+                                                    Teuchos::RCP<Epetra_Vector> newTemperature)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(implicitThermalOperator.is_null(), "**** Peridigm::solveImplicitThermalStep(), the implicit thermal solver is not initialized.\n");
+
+  const int length = deltaTemperature->MyLength();
+
+  // Temperature and heat rate at the beginning of the thermal step
+  implicitThermalTemperatureN->Update(1.0, *deltaTemperature, 0.0);
+  implicitThermalHeatRateN->Update(1.0, *heatFlow, 0.0);
+  for(int j=0 ; j<length ; ++j)
+    (*implicitThermalHeatRateN)[j] += (*density)[j]*(*internalHeatSource)[j];
+  for(unsigned int i=0 ; i<implicitThermalShockNodes.size() ; ++i){
+    int j = implicitThermalShockNodes[i];
+    (*implicitThermalHeatRateN)[j] += (*convectionConstant)[j]*(-(*implicitThermalTemperatureN)[j] + (*fluidTemperature)[j]) + (*internalHeatSource)[j];
+  }
+
+  // Initial guess, with the prescribed temperatures at the end of the thermal step
+  boundaryAndInitialConditionManager->applyTemperatureBCs(timeNew, timeCurrent);
+  implicitThermalTemperature->Update(1.0, *deltaTemperature, 0.0);
+  deltaTemperature->Update(1.0, *implicitThermalTemperatureN, 0.0);
+
+  // The heat capacity is frozen at the beginning of the thermal step
+  for(int j=0 ; j<length ; ++j)
+    (*implicitThermalHeatCapacityOverTimeStep)[j] = (*density)[j]*(*specificHeat)[j]/thermalTimeStep;
+
+  // Newton iterations on  rho*c*(T - T^n)/dt - theta*H(T) - (1-theta)*H(T^n) = 0
+  double initialResidualNorm(0.0), residualNorm(0.0);
+  int iteration = 0;
+  while(true){
+    computeImplicitThermalResidual(implicitThermalTemperature, implicitThermalResidual);
+    implicitThermalResidual->Norm2(&residualNorm);
+    if(iteration == 0)
+      initialResidualNorm = residualNorm;
+    if(residualNorm <= implicitThermalTolerance*initialResidualNorm || residualNorm == 0.0 || iteration == implicitThermalMaxIterations)
+      break;
+
+    // Solve J*dT = -R, with the Jacobian linearized about the current iterate
+    implicitThermalBaseResidual->Update(1.0, *implicitThermalResidual, 0.0);
+    implicitThermalOperator->setBasePoint(implicitThermalTemperature, implicitThermalBaseResidual);
+    implicitThermalResidual->Scale(-1.0);
+    implicitThermalIncrement->PutScalar(0.0);
+    bool isSet = implicitThermalLinearProblem->setProblem(implicitThermalIncrement, implicitThermalResidual);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!isSet, "**** Peridigm::solveImplicitThermalStep(), failed to set linear problem.\n");
+    PeridigmNS::Timer::self().startTimer("Solve Thermal Linear System");
+    Belos::ReturnType isConverged = implicitThermalBelosSolver->solve();
+    PeridigmNS::Timer::self().stopTimer("Solve Thermal Linear System");
+    if(isConverged != Belos::Converged && peridigmComm->MyPID() == 0)
+      cout << "Warning:  Belos thermal linear solver failed to converge!  Proceeding with nonconverged solution..." << endl;
+
+    for(int j=0 ; j<length ; ++j)
+      (*implicitThermalTemperature)[j] += (*implicitThermalIncrement)[j];
+    iteration++;
+  }
+
+  if(residualNorm > implicitThermalTolerance*initialResidualNorm && peridigmComm->MyPID() == 0)
+    cout << "Warning:  Implicit thermal step did not converge in " << implicitThermalMaxIterations << " iterations (residual norm "
+         << residualNorm << ", initial residual norm " << initialResidualNorm << ")." << endl;
+
+  newTemperature->Update(1.0, *implicitThermalTemperature, 0.0);
+
+  // The heat rate evaluations overwrite the temperature and heat flow in the blocks; copy back the mothership values,
+  // which are unchanged, rather than evaluating the heat flow again
+  PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+  for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    blockIt->importData(*deltaTemperature, deltaTemperatureFieldId, PeridigmField::STEP_NP1, Insert);
+    blockIt->importData(*heatFlow, heatFlowFieldId, PeridigmField::STEP_NP1, Insert);
+  }
+  PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+}
+
 void PeridigmNS::Peridigm::synchDataManagers() {
 
   // Copy data from mothership vectors to overlap vectors in blocks
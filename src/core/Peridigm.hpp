@@ -91,6 +91,8 @@ namespace PeridigmNS {
 
   class UserDefinedTimeDependentShortRangeForceContactModel;
 
+  class FiniteDifferenceJacobianOperator;
+
   class Peridigm : public NOX::Epetra::Interface::Required, public NOX::Epetra::Interface::Jacobian, public NOX::Epetra::Interface::Preconditioner {
 
   public:
@@ -177,7 +179,7 @@ namespace PeridigmNS {
       TEUCHOS_TEST_FOR_EXCEPT_MSG(tangent.is_null(), "**** PeridigmNS::Peridigm::evaluateTangentStiffnessMatrix(), tangent has not been allocated!\n");
       tangent->PutScalar(0.0);
       modelEvaluator->evalJacobian(workset);
-      int err = tangent->GlobalAssemble();
+      int err = overlapJacobian->globalAssemble();
       TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::evaluateTangentStiffnessMatrix(), GlobalAssemble() returned nonzero error code.\n");
       // Note:  Peridigm expects the tangent to be scaled using tangent->Scale(-1.0);
       //        but Albany does not.
@@ -269,12 +271,41 @@ namespace PeridigmNS {
 
     void executeExplicit(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
+    /*! \brief Main routine to drive problem solution for quasistatics using adaptive dynamic relaxation.
+     *
+     *  Each load step is relaxed to equilibrium with a damped central difference scheme using Underwood's fictitious
+     *  mass, bounded through the Gershgorin row sum (diagonal and off-diagonal) of the bond stiffnesses and scaled by
+     *  "Fictitious Mass Safety Factor", and a damping coefficient updated from the Rayleigh quotient of the local
+     *  stiffness.  Only the internal force evaluation is required, so no tangent matrix is allocated.
+     */
+    void executeDynamicRelaxation(Teuchos::RCP<Teuchos::ParameterList> solverParams);
+
     //! Main routine to drive problem solution for quasistatics
     void executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
     //! Main routine to drive problem solution for quasistatics using NOX
     void executeNOXQuasiStatic(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
+    /*! \brief Main routine to drive problem solution for quasistatics using the Riks/Crisfield arc-length method.
+     *
+     *  The load factor is the pseudo-time, which scales the kinematic B.C. and the body forces.  Each Newton iteration
+     *  solves the tangent system for the residual and for the derivative of the residual with respect to the load factor,
+     *  and the load correction is obtained from the arc-length constraint.  This allows the solver to trace the equilibrium
+     *  path through limit points in softening problems, where load-controlled quasistatics fail.
+     */
+    void executeArcLength(Teuchos::RCP<Teuchos::ParameterList> solverParams);
+
+    //! Compute the quasistatic residual for the given free-DOF displacement increment, with the kinematic B.C. and body forces evaluated at timeCurrent.
+    double arcLengthComputeResidual(Teuchos::RCP<Epetra_Vector> residual,
+                                    Teuchos::RCP<const Epetra_Vector> freeIncrement,
+                                    Teuchos::RCP<Epetra_Vector> prescribedIncrement,
+                                    double timeCurrent,
+                                    double timePrevious,
+                                    double minimumTimeIncrement);
+
+    //! Assemble the tangent at the current configuration and apply the kinematic B.C.
+    void arcLengthEvaluateTangent();
+
     //! Set the preconditioner for the global linear system
     void quasiStaticsSetPreconditioner(Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem);
 
@@ -293,15 +324,81 @@ namespace PeridigmNS {
                                   Teuchos::RCP<Epetra_Vector> lhs,
                                   double dt);
 
+    /*! \brief Perform a backtracking line search with Armijo sufficient decrease and quadratic/cubic interpolation.
+     *
+     *  The merit function is 0.5*||R||^2.  The search returns at the first step length that satisfies the sufficient decrease
+     *  condition, in which case the nodal positions and the residual are left at the accepted step and stepApplied is set to true.
+     *  Otherwise the displacement increment is restored and the step length with the lowest merit function is returned.
+     */
+    double quasiStaticsBacktrackingLineSearch(Teuchos::RCP<Epetra_Vector> residual,
+                                              Teuchos::RCP<Epetra_Vector> lhs,
+                                              double dt,
+                                              int maxEvaluations,
+                                              double sufficientDecrease,
+                                              double& residualNorm,
+                                              bool& stepApplied);
+
+    //! Set the displacement increment to the line search starting point plus alpha times the search direction and update positions and velocities.
+    void quasiStaticsApplyLineSearchStep(double alpha,
+                                         Teuchos::RCP<Epetra_Vector> lhs,
+                                         double dt);
+
     //! Main routine to drive problem solution with implicit time integration
     void executeImplicit(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
+    /*! \brief Compute the residual of implicit (Newmark) time integration for a trial displacement.
+     *
+     *  The mothership acceleration, velocity, and current coordinates are set consistent with the trial displacement.  For
+     *  multiphysics analyses the fluid pressure rows use the current fluid pressure and fluidPressureUn, the pressure at the
+     *  beginning of the step; otherwise fluidPressureUn may be null.  The external force must be up to date.
+     */
+    void computeImplicitResidual(Teuchos::RCP<const Epetra_Vector> uTrial,
+                                 Teuchos::RCP<const Epetra_Vector> u2,
+                                 Teuchos::RCP<const Epetra_Vector> v2,
+                                 double beta,
+                                 double gamma,
+                                 double dt,
+                                 Teuchos::RCP<const Epetra_Vector> fluidPressureUn,
+                                 Teuchos::RCP<Epetra_Vector> residual);
+
+    /*! \brief Compute the heat rate H(T) of the heat equation rho*c*dT/dt = H(T) for a trial temperature.
+     *
+     *  H(T) is the nonlocal heat flow plus the internal heat source and, on the thermal shock node set, the convective
+     *  exchange with the fluid.  The current coordinates and bond damage already stored in the blocks are used.
+     */
+    void computeHeatRate(Teuchos::RCP<const Epetra_Vector> temperature,
+                         const std::vector<int>& thermalShockNodes,
+                         Teuchos::RCP<Epetra_Vector> heatRate);
+
+    //! Allocate the vectors, operator, and linear solver of the implicit thermal time integration; called once before the time loop.
+    void initializeImplicitThermalSolver(double theta,
+                                         const std::vector<int>& thermalShockNodes,
+                                         Teuchos::ParameterList& thermalSolverParams);
+
+    //! Residual of the implicit thermal update, rho*c*(T - T^n)/dt - theta*H(T) - (1-theta)*H(T^n), with zeros at prescribed temperatures.
+    void computeImplicitThermalResidual(Teuchos::RCP<const Epetra_Vector> temperature,
+                                        Teuchos::RCP<Epetra_Vector> residual);
+
+    /*! \brief Advance the temperature over one thermal time step with the implicit theta-method (backward Euler for theta = 1, Crank-Nicolson for theta = 0.5).
+     *
+     *  The mothership temperature is left unchanged; the result, with prescribed temperatures evaluated at timeNew, is
+     *  returned in newTemperature.  The mothership heat flow must hold the heat flow at the current temperature.  The
+     *  temperature and heat flow stored in the blocks are reset to the mothership values on return.
+     */
+    void solveImplicitThermalStep(double thermalTimeStep,
+                                  double timeNew,
+                                  double timeCurrent,
+                                  Teuchos::RCP<Epetra_Vector> newTemperature);
+
     //! Allocate memory for non-zeros in global Jacobian
     void allocateJacobian(const int numDoFs);
 
     //! Allocate memory for non-zeros in block diagonal Jacobian
     void allocateBlockDiagonalJacobian();
 
+    //! Record the memory owned by each subsystem and sample the peak resident set size at the given phase
+    void recordMemoryUsage(const std::string& phase);
+
     //! Compute the Jacobian for implicit dynamics
     void computeImplicitJacobian(double beta, double dt);
 
@@ -368,6 +465,9 @@ namespace PeridigmNS {
     //! Accessor for compute manager
     Teuchos::RCP< PeridigmNS::ComputeManager > getComputeManager() { return computeManager; }
 
+    //! Accessor for contact manager
+    Teuchos::RCP< PeridigmNS::ContactManager > getContactManager() { return contactManager; }
+
     //! Set the time step (for use when calling Peridigm as a library).
     void setTimeStep(double timeStep) { workset->timeStep = timeStep; }
 
@@ -526,6 +626,33 @@ namespace PeridigmNS {
     //! Global vector for temperature change
   	Teuchos::RCP<Epetra_Vector> deltaTemperature;
 
+    //! Implicit thermal time integration:  theta, prescribed thermal shock nodes, and Newton solver settings
+    double implicitThermalTheta;
+    std::vector<int> implicitThermalShockNodes;
+    int implicitThermalMaxIterations;
+    double implicitThermalTolerance;
+
+    //! Implicit thermal time integration:  temperature and heat rate at the beginning of the thermal step
+    Teuchos::RCP<Epetra_Vector> implicitThermalTemperatureN;
+    Teuchos::RCP<Epetra_Vector> implicitThermalHeatRateN;
+
+    //! Implicit thermal time integration:  Newton iterate, its heat rate and residual, and the Newton increment
+    Teuchos::RCP<Epetra_Vector> implicitThermalTemperature;
+    Teuchos::RCP<Epetra_Vector> implicitThermalHeatRate;
+    Teuchos::RCP<Epetra_Vector> implicitThermalResidual;
+    Teuchos::RCP<Epetra_Vector> implicitThermalBaseResidual;
+    Teuchos::RCP<Epetra_Vector> implicitThermalIncrement;
+
+    //! Implicit thermal time integration:  zero at prescribed temperatures, and rho*c/dt frozen at the beginning of the thermal step
+    Teuchos::RCP<Epetra_Vector> implicitThermalFreeDoFMask;
+    Teuchos::RCP<Epetra_Vector> implicitThermalHeatCapacityOverTimeStep;
+
+    //! Implicit thermal time integration:  matrix-free Jacobian and linear solver
+    Teuchos::RCP<PeridigmNS::FiniteDifferenceJacobianOperator> implicitThermalOperator;
+    Teuchos::RCP< Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator> > implicitThermalLinearProblem;
+    Teuchos::RCP<Teuchos::ParameterList> implicitThermalBelosParams;
+    Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> > implicitThermalBelosSolver;
+
     //! Global vector for force
     Teuchos::RCP<Epetra_Vector> force;
 
@@ -666,6 +793,13 @@ namespace PeridigmNS {
     int numMultiphysDoFs;
     string textMultiphysDoFs;
 
+    //! Work vectors for the quasi-static line search, allocated once per analysis
+    Teuchos::RCP<Epetra_Vector> lineSearchDeltaU;
+    Teuchos::RCP<Epetra_Vector> lineSearchWork;
+
+    //! Number of residual evaluations performed by the quasi-static line search in the current load step
+    int lineSearchResidualEvaluations;
+
     // specular bonds quantities
     int specularBondPositionFieldId;
     int microPotentialFieldId;
@@ -49,11 +49,14 @@
 #include "Peridigm_Field.hpp"
 #include <vector>
 #include <set>
+#include <algorithm>
+#include <utility>
+#include <Epetra_Distributor.h>
 
 using namespace std;
 
 PeridigmNS::BlockBase::BlockBase(std::string blockName_, int blockID_, Teuchos::ParameterList& blockParams_)
-  : blockName(blockName_), blockID(blockID_), blockParams(blockParams_)
+  : blockName(blockName_), blockID(blockID_), pendingImports(false), blockParams(blockParams_)
 {}
 
 void PeridigmNS::BlockBase::initialize(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
@@ -76,6 +79,8 @@ void PeridigmNS::BlockBase::initialize(Teuchos::RCP<const Epetra_BlockMap> globa
                                                                       globalOverlapScalarBondMap,
                                                                       globalNeighborhoodData,
                                                                       true);
+
+  computeBoundaryPointFlags();
 }
 
 void PeridigmNS::BlockBase::importData(const Epetra_Vector& source, int fieldId, PeridigmField::Step step, Epetra_CombineMode combineMode)
@@ -93,14 +98,20 @@ void PeridigmNS::BlockBase::importData(const Epetra_Vector& source, int fieldId,
     else if(source.Map().ElementSize() == 1){
       if(oneDimensionalImporter.is_null())
         oneDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapScalarPointMap(), source.Map()));
-      dataManager->getData(fieldId, step)->Import(source, *oneDimensionalImporter, combineMode);
+      if(combineMode == Insert)
+        importPointData(source, dataManager->getData(fieldId, step), *oneDimensionalImporter, 1, scalarImport);
+      else
+        dataManager->getData(fieldId, step)->Import(source, *oneDimensionalImporter, combineMode);
     }
 
     // vector data
     else if(source.Map().ElementSize() == 3){
       if(threeDimensionalImporter.is_null())
         threeDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapVectorPointMap(), source.Map()));
-      dataManager->getData(fieldId, step)->Import(source, *threeDimensionalImporter, combineMode);
+      if(combineMode == Insert)
+        importPointData(source, dataManager->getData(fieldId, step), *threeDimensionalImporter, 3, vectorImport);
+      else
+        dataManager->getData(fieldId, step)->Import(source, *threeDimensionalImporter, combineMode);
     }
   }
 }
@@ -120,14 +131,275 @@ void PeridigmNS::BlockBase::exportData(Epetra_Vector& target, int fieldId, Perid
     else if(target.Map().ElementSize() == 1){
       if(oneDimensionalImporter.is_null())
         oneDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapScalarPointMap(), target.Map()));
-      target.Export(*(dataManager->getData(fieldId, step)), *oneDimensionalImporter, combineMode);  
+      if(combineMode == Add || combineMode == Insert)
+        exportPointData(*(dataManager->getData(fieldId, step)), target, *oneDimensionalImporter, 1, combineMode, scalarExport);
+      else
+        target.Export(*(dataManager->getData(fieldId, step)), *oneDimensionalImporter, combineMode);
     }
 
     // vector data
     else if(target.Map().ElementSize() == 3){
       if(threeDimensionalImporter.is_null())
         threeDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapVectorPointMap(), target.Map()));
-      target.Export(*(dataManager->getData(fieldId, step)), *threeDimensionalImporter, combineMode);  
+      if(combineMode == Add || combineMode == Insert)
+        exportPointData(*(dataManager->getData(fieldId, step)), target, *threeDimensionalImporter, 3, combineMode, vectorExport);
+      else
+        target.Export(*(dataManager->getData(fieldId, step)), *threeDimensionalImporter, combineMode);
+    }
+  }
+}
+
+void PeridigmNS::BlockBase::importPointData(const Epetra_Vector& source,
+                                            Teuchos::RCP<Epetra_Vector> target,
+                                            const Epetra_Import& importer,
+                                            int elementSize,
+                                            SplitPhaseImport& data)
+{
+  // A blocking import is a split-phase import of a single field with nothing to overlap
+  data.sources.push_back(&source);
+  data.targets.push_back(target);
+  postSplitPhaseImport(data, importer, elementSize);
+  completeSplitPhaseImport(data, importer, elementSize);
+}
+
+void PeridigmNS::BlockBase::exportPointData(const Epetra_Vector& source,
+                                            Epetra_Vector& target,
+                                            const Epetra_Import& importer,
+                                            int elementSize,
+                                            Epetra_CombineMode combineMode,
+                                            PointExport& data)
+{
+  // The export runs the importer in reverse:  the owned entries of the overlap vector are combined into the target
+  // directly, and the ghosted entries are sent back to their owners
+  const double* from = source.Values();
+  double* to = target.Values();
+  const bool add = (combineMode == Add);
+
+  int numSameIDs = importer.NumSameIDs();
+  int numPermuteIDs = importer.NumPermuteIDs();
+  const int* permuteFromLIDs = importer.PermuteFromLIDs();
+  const int* permuteToLIDs = importer.PermuteToLIDs();
+  for(int i=0 ; i<numSameIDs*elementSize ; ++i)
+    to[i] = add ? to[i] + from[i] : from[i];
+  for(int i=0 ; i<numPermuteIDs ; ++i){
+    for(int j=0 ; j<elementSize ; ++j){
+      double& value = to[permuteFromLIDs[i]*elementSize + j];
+      const double contribution = from[permuteToLIDs[i]*elementSize + j];
+      value = add ? value + contribution : contribution;
+    }
+  }
+
+  if(importer.SourceMap().DistributedGlobal()){
+    int numRemoteIDs = importer.NumRemoteIDs();
+    const int* remoteLIDs = importer.RemoteLIDs();
+    if(data.remoteLIDsContiguous == -1)
+      data.remoteLIDsContiguous = remoteLIDsAreContiguous(importer) ? 1 : 0;
+
+    // The ghosts are sent in the order in which they were received, so a contiguous range of ghosts is sent in place
+    char* exportBuffer;
+    if(data.remoteLIDsContiguous == 1 && numRemoteIDs > 0){
+      exportBuffer = reinterpret_cast<char*>(const_cast<double*>(from + remoteLIDs[0]*elementSize));
+    }
+    else{
+      data.exportBuffer.resize(std::max(1, numRemoteIDs*elementSize));
+      for(int i=0 ; i<numRemoteIDs ; ++i){
+        for(int j=0 ; j<elementSize ; ++j)
+          data.exportBuffer[i*elementSize + j] = from[remoteLIDs[i]*elementSize + j];
+      }
+      exportBuffer = reinterpret_cast<char*>(&data.exportBuffer[0]);
+    }
+
+    // The receive buffer is sized so that the distributor does not reallocate it
+    int numExportIDs = importer.NumExportIDs();
+    const int* exportLIDs = importer.ExportLIDs();
+    data.importBuffer.resize(std::max(1, numExportIDs*elementSize));
+    char* importBuffer = reinterpret_cast<char*>(&data.importBuffer[0]);
+    int importBufferLength = static_cast<int>(data.importBuffer.size()*sizeof(double));
+    int err = importer.Distributor().DoReverse(exportBuffer,
+                                               elementSize*static_cast<int>(sizeof(double)),
+                                               importBufferLength,
+                                               importBuffer);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n**** Error in BlockBase::exportData(), DoReverse() returned nonzero error code.\n");
+
+    for(int i=0 ; i<numExportIDs ; ++i){
+      for(int j=0 ; j<elementSize ; ++j){
+        double& value = to[exportLIDs[i]*elementSize + j];
+        const double contribution = data.importBuffer[i*elementSize + j];
+        value = add ? value + contribution : contribution;
+      }
+    }
+  }
+}
+
+bool PeridigmNS::BlockBase::remoteLIDsAreContiguous(const Epetra_Import& importer)
+{
+  int numRemoteIDs = importer.NumRemoteIDs();
+  const int* remoteLIDs = importer.RemoteLIDs();
+  for(int i=1 ; i<numRemoteIDs ; ++i){
+    if(remoteLIDs[i] != remoteLIDs[0] + i)
+      return false;
+  }
+  return true;
+}
+
+void PeridigmNS::BlockBase::queueImportData(const Epetra_Vector& source, int fieldId, PeridigmField::Step step)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(pendingImports, "\n**** Error in BlockBase::queueImportData(), the previous split-phase import has not been completed.\n");
+
+  if(dataManager->hasData(fieldId, step)){
+
+    // bond data is not ghosted, import it immediately
+    if(source.Map().ConstantElementSize() == 0){
+      importData(source, fieldId, step, Insert);
+    }
+
+    // scalar data
+    else if(source.Map().ElementSize() == 1){
+      if(oneDimensionalImporter.is_null())
+        oneDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapScalarPointMap(), source.Map()));
+      scalarSplitPhaseImport.sources.push_back(&source);
+      scalarSplitPhaseImport.targets.push_back(dataManager->getData(fieldId, step));
+    }
+
+    // vector data
+    else if(source.Map().ElementSize() == 3){
+      if(threeDimensionalImporter.is_null())
+        threeDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapVectorPointMap(), source.Map()));
+      vectorSplitPhaseImport.sources.push_back(&source);
+      vectorSplitPhaseImport.targets.push_back(dataManager->getData(fieldId, step));
+    }
+  }
+}
+
+void PeridigmNS::BlockBase::startImports()
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(pendingImports, "\n**** Error in BlockBase::startImports(), the previous split-phase import has not been completed.\n");
+
+  if(!scalarSplitPhaseImport.targets.empty())
+    postSplitPhaseImport(scalarSplitPhaseImport, *oneDimensionalImporter, 1);
+  if(!vectorSplitPhaseImport.targets.empty())
+    postSplitPhaseImport(vectorSplitPhaseImport, *threeDimensionalImporter, 3);
+  pendingImports = true;
+}
+
+void PeridigmNS::BlockBase::completeImports()
+{
+  if(!pendingImports)
+    return;
+
+  if(!scalarSplitPhaseImport.targets.empty())
+    completeSplitPhaseImport(scalarSplitPhaseImport, *oneDimensionalImporter, 1);
+  if(!vectorSplitPhaseImport.targets.empty())
+    completeSplitPhaseImport(vectorSplitPhaseImport, *threeDimensionalImporter, 3);
+  pendingImports = false;
+}
+
+void PeridigmNS::BlockBase::postSplitPhaseImport(SplitPhaseImport& data, const Epetra_Import& importer, int elementSize)
+{
+  int numFields = static_cast<int>(data.sources.size());
+
+  // Locally-owned data is copied directly into the overlap vectors
+  int numSameIDs = importer.NumSameIDs();
+  int numPermuteIDs = importer.NumPermuteIDs();
+  const int* permuteFromLIDs = importer.PermuteFromLIDs();
+  const int* permuteToLIDs = importer.PermuteToLIDs();
+  for(int iField=0 ; iField<numFields ; ++iField){
+    const double* source = data.sources[iField]->Values();
+    double* target = data.targets[iField]->Values();
+    for(int i=0 ; i<numSameIDs*elementSize ; ++i)
+      target[i] = source[i];
+    for(int i=0 ; i<numPermuteIDs ; ++i){
+      for(int j=0 ; j<elementSize ; ++j)
+        target[permuteToLIDs[i]*elementSize + j] = source[permuteFromLIDs[i]*elementSize + j];
+    }
+  }
+
+  // Pack the data requested by other processors, all fields for a given point are sent as a single packet,
+  // and post the non-blocking sends and receives
+  if(importer.SourceMap().DistributedGlobal()){
+    int packetLength = numFields*elementSize;
+    int numExportIDs = importer.NumExportIDs();
+    const int* exportLIDs = importer.ExportLIDs();
+    data.exportBuffer.resize(std::max(1, numExportIDs*packetLength));
+    for(int iField=0 ; iField<numFields ; ++iField){
+      const double* source = data.sources[iField]->Values();
+      for(int i=0 ; i<numExportIDs ; ++i){
+        for(int j=0 ; j<elementSize ; ++j)
+          data.exportBuffer[i*packetLength + iField*elementSize + j] = source[exportLIDs[i]*elementSize + j];
+      }
+    }
+    // The receive buffer is sized so that the distributor does not reallocate it
+    data.importBuffer.resize(std::max(1, importer.NumRemoteIDs()*packetLength));
+    char* importBuffer = reinterpret_cast<char*>(&data.importBuffer[0]);
+    int importBufferLength = static_cast<int>(data.importBuffer.size()*sizeof(double));
+    int err = importer.Distributor().DoPosts(reinterpret_cast<char*>(&data.exportBuffer[0]),
+                                             packetLength*static_cast<int>(sizeof(double)),
+                                             importBufferLength,
+                                             importBuffer);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n**** Error in BlockBase::startImports(), DoPosts() returned nonzero error code.\n");
+  }
+
+  data.sources.clear();
+}
+
+void PeridigmNS::BlockBase::completeSplitPhaseImport(SplitPhaseImport& data, const Epetra_Import& importer, int elementSize)
+{
+  if(importer.SourceMap().DistributedGlobal()){
+    int err = importer.Distributor().DoWaits();
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n**** Error in BlockBase::completeImports(), DoWaits() returned nonzero error code.\n");
+
+    int numFields = static_cast<int>(data.targets.size());
+    int packetLength = numFields*elementSize;
+    int numRemoteIDs = importer.NumRemoteIDs();
+    const int* remoteLIDs = importer.RemoteLIDs();
+
+    // The ghosts are ordered by owning processor (see createMapsFromGlobalMaps()), so the remote local IDs are
+    // normally a contiguous range and the received packets are copied without indirect addressing
+    if(data.remoteLIDsContiguous == -1)
+      data.remoteLIDsContiguous = remoteLIDsAreContiguous(importer) ? 1 : 0;
+
+    if(data.remoteLIDsContiguous == 1 && numRemoteIDs > 0){
+      const double* importBuffer = &data.importBuffer[0];
+      if(numFields == 1){
+        std::copy(importBuffer, importBuffer + numRemoteIDs*elementSize, data.targets[0]->Values() + remoteLIDs[0]*elementSize);
+      }
+      else{
+        for(int iField=0 ; iField<numFields ; ++iField){
+          double* target = data.targets[iField]->Values() + remoteLIDs[0]*elementSize;
+          const double* packet = importBuffer + iField*elementSize;
+          for(int i=0 ; i<numRemoteIDs ; ++i){
+            for(int j=0 ; j<elementSize ; ++j)
+              target[i*elementSize + j] = packet[i*packetLength + j];
+          }
+        }
+      }
+    }
+    else{
+      for(int iField=0 ; iField<numFields ; ++iField){
+        double* target = data.targets[iField]->Values();
+        for(int i=0 ; i<numRemoteIDs ; ++i){
+          for(int j=0 ; j<elementSize ; ++j)
+            target[remoteLIDs[i]*elementSize + j] = data.importBuffer[i*packetLength + iField*elementSize + j];
+        }
+      }
+    }
+  }
+
+  data.targets.clear();
+}
+
+void PeridigmNS::BlockBase::computeBoundaryPointFlags()
+{
+  int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+  const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+  boundaryPointFlags.assign(numOwnedPoints, 0);
+  int neighborhoodListIndex(0);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      int neighborID = neighborhoodList[neighborhoodListIndex++];
+      if(!ownedScalarPointMap->MyGID(overlapScalarPointMap->GID(neighborID)))
+        boundaryPointFlags[iID] = 1;
     }
   }
 }
@@ -223,8 +495,25 @@ void PeridigmNS::BlockBase::createMapsFromGlobalMaps(Teuchos::RCP<const Epetra_B
 
   // Append ghosts to IDs
   // This creates the overlap global ID list
-  for(set<int>::iterator it=ghosts.begin() ; it!=ghosts.end() ; ++it)
-    IDs.push_back(*it);
+  // Ghosts owned by this processor (points in other blocks) come first, followed by the off-processor ghosts grouped
+  // by owning processor and sorted by global ID within each group.  This is the order in which Epetra_Import receives
+  // remote data, so the remote local IDs of the importer form a contiguous range and received data is unpacked
+  // without indirect addressing.
+  vector<int> ghostIDs(ghosts.begin(), ghosts.end());
+  vector<int> ghostPIDs(ghostIDs.size());
+  vector<int> ghostLIDs(ghostIDs.size());
+  int* ghostIDsPtr = ghostIDs.empty() ? 0 : &ghostIDs[0];
+  int* ghostPIDsPtr = ghostPIDs.empty() ? 0 : &ghostPIDs[0];
+  int* ghostLIDsPtr = ghostLIDs.empty() ? 0 : &ghostLIDs[0];
+  globalOwnedScalarPointMap->RemoteIDList(static_cast<int>(ghostIDs.size()), ghostIDsPtr, ghostPIDsPtr, ghostLIDsPtr);
+  const int myPID = globalOwnedScalarPointMap->Comm().MyPID();
+  vector< pair<int,int> > orderedGhosts;
+  orderedGhosts.reserve(ghostIDs.size());
+  for(unsigned int i=0 ; i<ghostIDs.size() ; ++i)
+    orderedGhosts.push_back(make_pair(ghostPIDs[i] == myPID ? -1 : ghostPIDs[i], ghostIDs[i]));
+  sort(orderedGhosts.begin(), orderedGhosts.end());
+  for(unsigned int i=0 ; i<orderedGhosts.size() ; ++i)
+    IDs.push_back(orderedGhosts[i].second);
 
   // Create the overlap scalar point map and the overlap vector point map
 
@@ -260,6 +549,12 @@ void PeridigmNS::BlockBase::createMapsFromGlobalMaps(Teuchos::RCP<const Epetra_B
   oneDimensionalImporter = Teuchos::RCP<Epetra_Import>();
   threeDimensionalImporter = Teuchos::RCP<Epetra_Import>();
   bondImporter = Teuchos::RCP<Epetra_Import>();
+  scalarSplitPhaseImport.remoteLIDsContiguous = -1;
+  vectorSplitPhaseImport.remoteLIDsContiguous = -1;
+  scalarImport.remoteLIDsContiguous = -1;
+  vectorImport.remoteLIDsContiguous = -1;
+  scalarExport.remoteLIDsContiguous = -1;
+  vectorExport.remoteLIDsContiguous = -1;
 }
 
 Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::BlockBase::createNeighborhoodDataFromGlobalNeighborhoodData(Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
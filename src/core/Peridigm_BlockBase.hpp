@@ -67,7 +67,7 @@ namespace PeridigmNS {
   public:
 
     //! Constructor
-    BlockBase() : blockName("Undefined"), blockID(-1) {}
+    BlockBase() : blockName("Undefined"), blockID(-1), pendingImports(false) {}
 
     //! Constructor
     BlockBase(std::string blockName_, int blockID_, Teuchos::ParameterList& blockParams_);
@@ -169,6 +169,30 @@ namespace PeridigmNS {
      */
     void exportData(Epetra_Vector& target, int fieldId, PeridigmField::Step step, Epetra_CombineMode combineMode);
 
+    /*! \brief Queue point data for a split-phase import.
+     *
+     *  Queued data is transferred by startImports() and completeImports(), which together are equivalent to calling
+     *  importData() with Insert for each queued field.  Only scalar and vector point data may be queued; bond data is
+     *  imported immediately.
+     */
+    void queueImportData(const Epetra_Vector& source, int fieldId, PeridigmField::Step step);
+
+    //! Copy the locally-owned portion of the queued data into the overlap vectors and post the non-blocking halo exchange.
+    void startImports();
+
+    //! Wait for the halo exchange posted by startImports() to complete and copy the ghosted values into the overlap vectors.
+    void completeImports();
+
+    //! Returns true if startImports() has been called and completeImports() has not.
+    bool importsPending() const { return pendingImports; }
+
+    /*! \brief Flags identifying owned points with ghosted neighbors.
+     *
+     *  Entry i is one if owned point i has at least one neighbor that is not locally owned, and zero otherwise.
+     *  Points with a flag of zero are interior points and can be evaluated before the halo exchange completes.
+     */
+    const std::vector<int>& getBoundaryPointFlags() const { return boundaryPointFlags; }
+
     //! Swaps STATE_N and STATE_NP1.
     void updateState(){ dataManager->updateState(); };
 
@@ -211,6 +235,53 @@ namespace PeridigmNS {
      */
     void initializeDataManager(std::vector<int> fieldIds);
 
+    //! Identify the owned points that have ghosted neighbors.
+    void computeBoundaryPointFlags();
+
+    //! Point data queued for a split-phase import, along with the communication buffers.
+    struct SplitPhaseImport {
+      SplitPhaseImport() : remoteLIDsContiguous(-1) {}
+      std::vector<const Epetra_Vector*> sources;
+      std::vector< Teuchos::RCP<Epetra_Vector> > targets;
+      std::vector<double> exportBuffer;
+      std::vector<double> importBuffer;
+      //! One if the remote local IDs of the importer form a contiguous range, zero if not, -1 if not yet determined
+      int remoteLIDsContiguous;
+    };
+
+    //! Copy locally-owned data and post the non-blocking sends and receives for the given split-phase import.
+    void postSplitPhaseImport(SplitPhaseImport& data, const Epetra_Import& importer, int elementSize);
+
+    //! Wait for the sends and receives for the given split-phase import to complete and unpack the received data.
+    void completeSplitPhaseImport(SplitPhaseImport& data, const Epetra_Import& importer, int elementSize);
+
+    //! Buffers for exporting point data from the overlap vectors.
+    struct PointExport {
+      PointExport() : remoteLIDsContiguous(-1) {}
+      std::vector<double> exportBuffer;
+      std::vector<double> importBuffer;
+      //! One if the remote local IDs of the importer form a contiguous range, zero if not, -1 if not yet determined
+      int remoteLIDsContiguous;
+    };
+
+    //! Import a single field of point data with Insert, unpacking contiguous ghosts without indirect addressing.
+    void importPointData(const Epetra_Vector& source,
+                         Teuchos::RCP<Epetra_Vector> target,
+                         const Epetra_Import& importer,
+                         int elementSize,
+                         SplitPhaseImport& data);
+
+    //! Export a single field of point data with Add or Insert, sending contiguous ghosts without packing them.
+    void exportPointData(const Epetra_Vector& source,
+                         Epetra_Vector& target,
+                         const Epetra_Import& importer,
+                         int elementSize,
+                         Epetra_CombineMode combineMode,
+                         PointExport& data);
+
+    //! Returns true if the remote local IDs of the importer form a contiguous range.
+    static bool remoteLIDsAreContiguous(const Epetra_Import& importer);
+
     std::string blockName;
     int blockID;
 
@@ -242,6 +313,24 @@ namespace PeridigmNS {
     //! The neighborhood data
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData;
 
+    //! Flags identifying owned points with ghosted neighbors
+    std::vector<int> boundaryPointFlags;
+
+    //! @name Split-phase import of scalar and vector point data
+    //@{
+    SplitPhaseImport scalarSplitPhaseImport;
+    SplitPhaseImport vectorSplitPhaseImport;
+    bool pendingImports;
+    //@}
+
+    //! @name Buffers for the blocking import and export of scalar and vector point data
+    //@{
+    SplitPhaseImport scalarImport;
+    SplitPhaseImport vectorImport;
+    PointExport scalarExport;
+    PointExport vectorExport;
+    //@}
+
     //! List of auxiliary field specs
     std::vector<int> auxiliaryFieldIds;
 
@@ -330,6 +330,43 @@ void PeridigmNS::BoundaryAndInitialConditionManager::applyTemperatureBCs(const d
   }
 }
 
+void PeridigmNS::BoundaryAndInitialConditionManager::applyTemperatureBC_InsertZeros(Teuchos::RCP<Epetra_Vector> vec)
+{
+  const Epetra_BlockMap& oneDimensionalMap = vec->Map();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(oneDimensionalMap.ElementSize() != 1, "**** applyTemperatureBC_InsertZeros() must be called with map having element size = 1.\n");
+
+  for(unsigned i=0;i<boundaryConditions.size();++i){
+    Teuchos::RCP<BoundaryCondition> boundaryCondition = boundaryConditions[i];
+    if(boundaryCondition->getType() != PRESCRIBED_TEMPERATURE)
+      continue;
+    const Set_Definition setDef = to_set_definition(boundaryCondition->getNodeSetName());
+    // apply the bc to every element in the entire domain
+    if(setDef==FULL_DOMAIN){
+      vec->PutScalar(0.0);
+      continue;
+    }
+    std::map< std::string, std::vector<int> >::iterator itBegin;
+    std::map< std::string, std::vector<int> >::iterator itEnd;
+    if (setDef == ALL_SETS){
+      itBegin = nodeSets->begin();
+      itEnd = nodeSets->end();
+    }
+    else{
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(boundaryCondition->getNodeSetName()) == nodeSets->end(), "**** Node set not found: " + boundaryCondition->getNodeSetName() + "\n");
+      itBegin = nodeSets->find(boundaryCondition->getNodeSetName());
+      itEnd = itBegin; itEnd++;
+    }
+    for(std::map<std::string,std::vector<int> > ::iterator setIt=itBegin;setIt!=itEnd;++setIt){
+      vector<int> & nodeList = setIt->second;
+      for(unsigned int j=0 ; j<nodeList.size() ; j++){
+        int localNodeID = oneDimensionalMap.LID(nodeList[j]);
+        if(localNodeID != -1)
+          (*vec)[localNodeID] = 0.0;
+      }
+    }
+  }
+}
+
 void PeridigmNS::BoundaryAndInitialConditionManager::applyForceContributions(const double & timeCurrent, const double & timePrevious){
   clearForceContributions();
   for(unsigned i=0;i<forceContributions.size();++i){
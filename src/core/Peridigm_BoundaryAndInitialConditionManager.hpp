@@ -109,6 +109,9 @@ namespace PeridigmNS {
 		//! Update the current fluid pressure
 		void updateFluidPressureY();
 
+    //! Set entries corresponding to prescribed temperature boundary conditions to zero (vector on the one-dimensional node map).
+    void applyTemperatureBC_InsertZeros(Teuchos::RCP<Epetra_Vector> vec);
+
     //! Copies entries corresponding to kinematic boundary contitions into the vector of reaction forces.
     void applyKinematicBC_ComputeReactions(Teuchos::RCP<const Epetra_Vector> force, Teuchos::RCP<Epetra_Vector> reaction, const int numMultiphysDoFs);
 
@@ -49,6 +49,7 @@
 #include "Peridigm_Field.hpp"
 #include <vector>
 #include <set>
+#include <algorithm>
 
 using namespace std;
 
@@ -80,9 +81,15 @@ void PeridigmNS::ContactBlock::initialize(Teuchos::RCP<const Epetra_BlockMap> gl
   vector<int> fieldIds;
   // Ids passed in via setAuxiliaryFieldIds(), if any
   fieldIds.insert(fieldIds.end(), auxiliaryFieldIds.begin(), auxiliaryFieldIds.end());
-  // Contact model fieldIds
-  vector<int> contactModelFieldIds = contactModel->FieldIds();
-  fieldIds.insert(fieldIds.end(), contactModelFieldIds.begin(), contactModelFieldIds.end());
+  // Contact model fieldIds, for every contact model used by the block
+  vector< Teuchos::RCP<const PeridigmNS::ContactModel> > contactModels = getContactModels();
+  for(unsigned int i=0 ; i<contactModels.size() ; ++i){
+    vector<int> contactModelFieldIds = contactModels[i]->FieldIds();
+    fieldIds.insert(fieldIds.end(), contactModelFieldIds.begin(), contactModelFieldIds.end());
+  }
+  // Remove duplicates
+  sort(fieldIds.begin(), fieldIds.end());
+  fieldIds.erase(unique(fieldIds.begin(), fieldIds.end()), fieldIds.end());
 
   BlockBase::initializeDataManager(fieldIds);
 }
@@ -115,3 +122,70 @@ void PeridigmNS::ContactBlock::rebalance(Teuchos::RCP<const Epetra_BlockMap> reb
                          ownedScalarBondMap,
                          overlapScalarBondMap);
 }
+
+vector< Teuchos::RCP<const PeridigmNS::ContactModel> > PeridigmNS::ContactBlock::getContactModels() const
+{
+  vector< Teuchos::RCP<const PeridigmNS::ContactModel> > contactModels;
+  if(pairContactModels.empty()){
+    if(!contactModel.is_null())
+      contactModels.push_back(contactModel);
+    return contactModels;
+  }
+  for(map< int, Teuchos::RCP<const PeridigmNS::ContactModel> >::const_iterator it=pairContactModels.begin() ; it!=pairContactModels.end() ; ++it){
+    if(find(contactModels.begin(), contactModels.end(), it->second) == contactModels.end())
+      contactModels.push_back(it->second);
+  }
+  return contactModels;
+}
+
+void PeridigmNS::ContactBlock::createContactModelNeighborhoods(int blockIdFieldId)
+{
+  contactModelNeighborhoods.clear();
+
+  // A single contact model is applied to the full neighborhood
+  vector< Teuchos::RCP<const PeridigmNS::ContactModel> > contactModels = getContactModels();
+  if(pairContactModels.empty() || contactModels.size() == 1){
+    if(contactModels.size() == 1)
+      contactModelNeighborhoods.push_back( make_pair(contactModels[0], neighborhoodData) );
+    return;
+  }
+
+  double* blockIds;
+  dataManager->getData(blockIdFieldId, PeridigmField::STEP_NONE)->ExtractView(&blockIds);
+
+  const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+  const int* ownedIDs = neighborhoodData->OwnedIDs();
+  const int* fullNeighborhoodList = neighborhoodData->NeighborhoodList();
+  for(unsigned int iModel=0 ; iModel<contactModels.size() ; ++iModel){
+
+    // Neighbors whose block interacts with this block through the current model
+    vector<int> neighborhoodList;
+    vector<int> neighborhoodPtr(numOwnedPoints);
+    int fullIndex = 0;
+    for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+      neighborhoodPtr[iID] = neighborhoodList.size();
+      int numNeighborsIndex = neighborhoodList.size();
+      neighborhoodList.push_back(0);
+      int numNeighbors = fullNeighborhoodList[fullIndex++];
+      for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+        int neighborID = fullNeighborhoodList[fullIndex++];
+        map< int, Teuchos::RCP<const PeridigmNS::ContactModel> >::const_iterator it = pairContactModels.find( static_cast<int>(blockIds[neighborID]) );
+        if(it != pairContactModels.end() && it->second == contactModels[iModel]){
+          neighborhoodList.push_back(neighborID);
+          neighborhoodList[numNeighborsIndex] += 1;
+        }
+      }
+    }
+
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> modelNeighborhoodData = Teuchos::rcp(new PeridigmNS::NeighborhoodData);
+    modelNeighborhoodData->SetNumOwned(numOwnedPoints);
+    if(numOwnedPoints > 0){
+      memcpy(modelNeighborhoodData->OwnedIDs(), ownedIDs, numOwnedPoints*sizeof(int));
+      memcpy(modelNeighborhoodData->NeighborhoodPtr(), &neighborhoodPtr[0], numOwnedPoints*sizeof(int));
+    }
+    modelNeighborhoodData->SetNeighborhoodListSize(neighborhoodList.size());
+    if(neighborhoodList.size() > 0)
+      memcpy(modelNeighborhoodData->NeighborhoodList(), &neighborhoodList[0], neighborhoodList.size()*sizeof(int));
+    contactModelNeighborhoods.push_back( make_pair(contactModels[iModel], modelNeighborhoodData) );
+  }
+}
@@ -50,6 +50,8 @@
 
 #include "Peridigm_BlockBase.hpp"
 #include "Peridigm_ContactModel.hpp"
+#include <map>
+#include <vector>
 
 namespace PeridigmNS {
 
@@ -89,6 +91,27 @@ class ContactBlock : public BlockBase {
       contactModel = contactModel_;
     }
 
+    //! Set the contact model for pairs between this block and the block with the given id
+    void setPairContactModel(int partnerBlockId, Teuchos::RCP<const PeridigmNS::ContactModel> pairContactModel){
+      pairContactModels[partnerBlockId] = pairContactModel;
+    }
+
+    //! Get the distinct contact models used by this block
+    std::vector< Teuchos::RCP<const PeridigmNS::ContactModel> > getContactModels() const;
+
+    /*! \brief Split the block neighborhood into one neighborhood per contact model.
+     *
+     *  Each neighbor is assigned to the contact model of the pair formed by this block and the neighbor's block,
+     *  as given by the Block_Id field.  If no pair contact models were set, the block contact model is applied
+     *  to the full neighborhood.  Must be called whenever the neighborhood or the block ids change.
+     */
+    void createContactModelNeighborhoods(int blockIdFieldId);
+
+    //! Get the contact models with the neighborhoods they are applied to
+    const std::vector< std::pair< Teuchos::RCP<const PeridigmNS::ContactModel>, Teuchos::RCP<PeridigmNS::NeighborhoodData> > >& getContactModelNeighborhoods() const {
+      return contactModelNeighborhoods;
+    }
+
     //! Rebalance the block based on rebalanced global maps and neighborhood information.
     void rebalance(Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOwnedScalarPointMap,
                    Teuchos::RCP<const Epetra_BlockMap> rebalancedGlobalOverlapScalarPointMap,
@@ -103,6 +126,12 @@ class ContactBlock : public BlockBase {
 
     //! The contact model
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel;
+
+    //! Contact model for each block this block interacts with, keyed by the id of the other block
+    std::map< int, Teuchos::RCP<const PeridigmNS::ContactModel> > pairContactModels;
+
+    //! Contact models paired with the part of the neighborhood they are applied to
+    std::vector< std::pair< Teuchos::RCP<const PeridigmNS::ContactModel>, Teuchos::RCP<PeridigmNS::NeighborhoodData> > > contactModelNeighborhoods;
   };
 }
 
@@ -48,7 +48,9 @@
 #include "Peridigm_ContactManager.hpp"
 #include "Peridigm_HorizonManager.hpp"
 #include "Peridigm_ContactModelFactory.hpp"
+#include "Peridigm_RigidContactorFactory.hpp"
 #include "Peridigm_Timer.hpp"
+#include "Peridigm_Memstat.hpp"
 #include <boost/algorithm/string/trim.hpp> // \todo Replace this include with correct include for istream_iterator.
 #include "Peridigm_PdQuickGridDiscretization.hpp"
 #include <Epetra_Map.h>
@@ -64,6 +66,7 @@
 
 #include "PdZoltan.h"
 #include "NeighborhoodList.h"
+#include <algorithm>
 
 using namespace std;
 
@@ -73,6 +76,7 @@ PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contact
                                            Teuchos::RCP<Discretization> disc,
                                            Teuchos::RCP<Teuchos::ParameterList> peridigmParams)
   : verbose(false), myPID(-1), params(contactParams), contactRebalanceFrequency(0), contactSearchRadius(0.0),
+    surfaceOnlySearch(false), surfaceDetectionTolerance(0.05), ownerComputes(false),
     blockIdFieldId(-1), volumeFieldId(-1), coordinatesFieldId(-1), velocityFieldId(-1), contactForceDensityFieldId(-1)
 {
   if(contactParams.isParameter("Verbose"))
@@ -92,9 +96,30 @@ PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contact
   if(!contactParams.isParameter("Search Frequency"))
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Search Frequency\" not specified.");
   contactRebalanceFrequency = contactParams.get<int>("Search Frequency");
+  if(contactParams.isParameter("Surface Only Search"))
+    surfaceOnlySearch = contactParams.get<bool>("Surface Only Search");
+  if(contactParams.isParameter("Surface Detection Tolerance"))
+    surfaceDetectionTolerance = contactParams.get<double>("Surface Detection Tolerance");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(surfaceDetectionTolerance < 0.0 || surfaceDetectionTolerance >= 1.0,
+                              "\n**** Error, contact parameter \"Surface Detection Tolerance\" must be in the range [0.0, 1.0).\n");
+  if(contactParams.isParameter("Owner Computes"))
+    ownerComputes = contactParams.get<bool>("Owner Computes");
 
   createContactInteractionsList(contactParams, disc);
 
+  if(contactParams.isSublist("Node To Facet"))
+    nodeToFacetContact = Teuchos::rcp(new PeridigmNS::NodeToFacetContact(contactParams.sublist("Node To Facet"), disc));
+
+  if(contactParams.isSublist("Rigid Contactors")){
+    RigidContactorFactory rigidContactorFactory;
+    const Teuchos::ParameterList& rigidContactorParams = contactParams.sublist("Rigid Contactors");
+    for(Teuchos::ParameterList::ConstIterator it = rigidContactorParams.begin() ; it != rigidContactorParams.end() ; it++){
+      const string& name = it->first;
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!rigidContactorParams.isSublist(name), "\n**** Error, expected a ParameterList for each entry in \"Rigid Contactors\".\n");
+      rigidContactors.push_back( rigidContactorFactory.create(rigidContactorParams.sublist(name), name, disc) );
+    }
+  }
+
   
 
 
@@ -166,36 +191,38 @@ PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contact
 void PeridigmNS::ContactManager::createContactInteractionsList(const Teuchos::ParameterList& contactParams,
                                                                Teuchos::RCP<Discretization> disc)
 {
-  set< boost::tuple<int, int, string> > contactInteractionSet;
+  // Interactions are applied in the order general contact, self contact, individual interactions,
+  // if a block pair has multiple contact definitions, the final definition is the one that will be used
   Teuchos::ParameterList interactionParams = contactParams.sublist("Interactions");
 
   // First, check for general and self contact
   bool hasGeneralContact = interactionParams.isSublist("General Contact");
-  string generalContactModelName, selfContactModelName;
-  if(hasGeneralContact)
-    generalContactModelName = interactionParams.sublist("General Contact").get<string>("Contact Model");
   bool hasSelfContact = interactionParams.isSublist("Self Contact");
-  if(hasSelfContact)
-    selfContactModelName = interactionParams.sublist("Self Contact").get<string>("Contact Model");
+  set<int> selfContactExcludedBlockIds;
+  if(hasSelfContact){
+    const Teuchos::ParameterList& selfContactParams = interactionParams.sublist("Self Contact");
+    // Self contact may be switched off for individual blocks
+    if(selfContactParams.isParameter("Excluded Blocks")){
+      istringstream iss(selfContactParams.get<string>("Excluded Blocks"));
+      vector<string> excludedBlockNames;
+      copy(istream_iterator<string>(iss),
+           istream_iterator<string>(),
+           back_inserter<vector<string> >(excludedBlockNames));
+      for(vector<string>::const_iterator it=excludedBlockNames.begin() ; it!=excludedBlockNames.end() ; ++it)
+        selfContactExcludedBlockIds.insert( disc->blockNameToBlockId(*it) );
+    }
+  }
   if(hasGeneralContact || hasSelfContact){
     vector<string> blockNames = disc->getBlockNames() ;
     for(unsigned int i=0 ; i<blockNames.size() ; ++i){
-      for(unsigned int j=0 ; j<blockNames.size() ; ++j){
+      for(unsigned int j=i ; j<blockNames.size() ; ++j){
         int blockId_1 = disc->blockNameToBlockId(blockNames[i]);
         int blockId_2 = disc->blockNameToBlockId(blockNames[j]);
-        if(blockId_1 > blockId_2){
-          int temp = blockId_1;
-          blockId_1 = blockId_2;
-          blockId_2 = temp;
-        }
-        if(hasSelfContact && i == j){
-          boost::tuple<int, int, string> interactionTuple(blockId_1, blockId_2, selfContactModelName);
-          contactInteractionSet.insert(interactionTuple);          
-        }
-        if(hasGeneralContact && i != j){
-          boost::tuple<int, int, string> interactionTuple(blockId_1, blockId_2, generalContactModelName);
-          contactInteractionSet.insert(interactionTuple);
-        }
+        pair<int, int> blockPair(min(blockId_1, blockId_2), max(blockId_1, blockId_2));
+        if(hasSelfContact && i == j && selfContactExcludedBlockIds.find(blockId_1) == selfContactExcludedBlockIds.end())
+          pairInteractionParams[blockPair] = interactionParams.sublist("Self Contact");
+        if(hasGeneralContact && i != j)
+          pairInteractionParams[blockPair] = interactionParams.sublist("General Contact");
       }
     }
   }
@@ -207,37 +234,64 @@ void PeridigmNS::ContactManager::createContactInteractionsList(const Teuchos::Pa
       Teuchos::ParameterList& interaction = interactionParams.sublist(name);
       int blockId_1 = disc->blockNameToBlockId( interaction.get<string>("First Block") );
       int blockId_2 = disc->blockNameToBlockId( interaction.get<string>("Second Block") );
-      string contactModelName = interaction.get<string>("Contact Model");
-      boost::tuple<int, int, string> interactionTuple(blockId_1, blockId_2, contactModelName);
-      contactInteractionSet.insert(interactionTuple);
+      pair<int, int> blockPair(min(blockId_1, blockId_2), max(blockId_1, blockId_2));
+      pairInteractionParams[blockPair] = interaction;
     }
   }
 
-  // Elliminate duplicates and load the interactions into a vector
-  set< boost::tuple<int, int, string> >::iterator it, nextIt;
-  nextIt = contactInteractionSet.begin();
-  nextIt++;
-  for(it = contactInteractionSet.begin() ; it != contactInteractionSet.end() ; it++){
-    // If a block pair has multiple contact definitions, the final definition is the one that will be used
-    bool duplicate = false;
-    if( nextIt != contactInteractionSet.end() && it->get<0>() == nextIt->get<0>() && it->get<1>() == nextIt->get<1>() )
-      duplicate = true;
-    if(!duplicate)
-      contactInteractions.push_back(*it);
-    if( nextIt != contactInteractionSet.end() )
-      nextIt++;
+  // Load the interactions into a vector and record the search settings of each pair
+  // The search radius and frequency default to the values given for the contact section as a whole
+  for(map< pair<int, int>, Teuchos::ParameterList >::const_iterator it=pairInteractionParams.begin() ; it!=pairInteractionParams.end() ; ++it){
+    const Teuchos::ParameterList& interaction = it->second;
+    contactInteractions.push_back( boost::tuple<int, int, string>(it->first.first, it->first.second, interaction.get<string>("Contact Model")) );
+    double searchRadius = contactSearchRadius;
+    if(interaction.isParameter("Search Radius"))
+      searchRadius = interaction.get<double>("Search Radius");
+    int searchFrequency = contactRebalanceFrequency;
+    if(interaction.isParameter("Search Frequency"))
+      searchFrequency = interaction.get<int>("Search Frequency");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(searchRadius <= 0.0, "\n**** Error, contact interaction \"Search Radius\" must be greater than zero.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(searchFrequency < 1, "\n**** Error, contact interaction \"Search Frequency\" must be at least one.\n");
+    pairSearchRadius[it->first] = searchRadius;
+    pairSearchFrequency[it->first] = searchFrequency;
   }
 
   // Print to stdout if verbose flag is set
   if(verbose && myPID == 0){
     cout << "-- Contact Interactions" << endl;
-    cout << "   First block    Second block    Contact model" << endl;
-    for(unsigned int i=0 ; i<contactInteractions.size() ; ++i)
-      cout << "   " << contactInteractions[i].get<0>() << "              " <<  contactInteractions[i].get<1>() << "               " <<  contactInteractions[i].get<2>() << endl;
+    cout << "   First block    Second block    Contact model    Search radius    Search frequency" << endl;
+    for(unsigned int i=0 ; i<contactInteractions.size() ; ++i){
+      pair<int, int> blockPair(contactInteractions[i].get<0>(), contactInteractions[i].get<1>());
+      cout << "   " << contactInteractions[i].get<0>() << "              " <<  contactInteractions[i].get<1>() << "               " <<  contactInteractions[i].get<2>()
+           << "    " << pairSearchRadius[blockPair] << "    " << pairSearchFrequency[blockPair] << endl;
+    }
     cout << endl;
   }
 }
 
+bool PeridigmNS::ContactManager::isContactSearchStep(int step) const
+{
+  // The initial search is always carried out, it replaces the bonded neighborhoods loaded at initialization
+  if(step == 0)
+    return true;
+  for(map< pair<int, int>, int >::const_iterator it=pairSearchFrequency.begin() ; it!=pairSearchFrequency.end() ; ++it){
+    if(isPairSearchStep(it->first, step))
+      return true;
+  }
+  return false;
+}
+
+bool PeridigmNS::ContactManager::isPairSearchStep(const pair<int, int>& blockPair, int step) const
+{
+  // The initial search is always carried out
+  if(step == 0)
+    return true;
+  map< pair<int, int>, int >::const_iterator it = pairSearchFrequency.find(blockPair);
+  if(it == pairSearchFrequency.end())
+    return false;
+  return step%it->second == 0;
+}
+
 void PeridigmNS::ContactManager::initialize(Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap_,
                                             Teuchos::RCP<const Epetra_BlockMap> threeDimensionalMap_,
                                             Teuchos::RCP<const Epetra_BlockMap> oneDimensionalOverlapMap_,
@@ -247,6 +301,7 @@ void PeridigmNS::ContactManager::initialize(Teuchos::RCP<const Epetra_BlockMap>
                                             Teuchos::RCP<const Epetra_Vector> blockIds_)
 {
   ContactModelFactory contactModelFactory;
+  Teuchos::ParameterList contactModelParams = params.sublist("Models", true);
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
 
     // Obtain the horizon for this block
@@ -254,17 +309,54 @@ void PeridigmNS::ContactManager::initialize(Teuchos::RCP<const Epetra_BlockMap>
     string blockName = contactBlockIt->getName();
     TEUCHOS_TEST_FOR_EXCEPT_MSG(!horizonManager.blockHasConstantHorizon(blockName) , "\n**** Error, variable horizon not supported by contact!\n");
     double blockHorizon = horizonManager.getBlockConstantHorizonValue(blockName);
+    int blockId = contactBlockIt->getID();
+
+    // Create the contact model for each interaction of this block
+    // The interaction may override the spring constant and friction coefficient of the named model,
+    // interactions that end up with identical parameters share a single contact model instance
+    vector< pair<Teuchos::ParameterList, Teuchos::RCP<const PeridigmNS::ContactModel> > > blockContactModels;
+    for(map< pair<int, int>, Teuchos::ParameterList >::const_iterator it=pairInteractionParams.begin() ; it!=pairInteractionParams.end() ; ++it){
+      if(it->first.first != blockId && it->first.second != blockId)
+        continue;
+      int partnerBlockId = (it->first.first == blockId) ? it->first.second : it->first.first;
+      const Teuchos::ParameterList& interaction = it->second;
+      string contactModelName = interaction.get<string>("Contact Model");
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!contactModelParams.isSublist(contactModelName),
+                                  "\n**** Error, contact model \"" + contactModelName + "\" not found in contact \"Models\" section.\n");
+      Teuchos::ParameterList contactParams = contactModelParams.sublist(contactModelName);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(contactParams.isParameter("Horizon") , "\n**** Error, Horizon is an invalid contact model parameter.\n");
+      contactParams.set("Horizon", blockHorizon);
+      if(!contactParams.isParameter("Friction Coefficient"))
+        contactParams.set("Friction Coefficient", 0.0);
+      if(interaction.isParameter("Spring Constant"))
+        contactParams.setEntry("Spring Constant", interaction.getEntry("Spring Constant"));
+      if(interaction.isParameter("Friction Coefficient"))
+        contactParams.setEntry("Friction Coefficient", interaction.getEntry("Friction Coefficient"));
+      Teuchos::RCP<const PeridigmNS::ContactModel> contactModel;
+      for(unsigned int i=0 ; i<blockContactModels.size() ; ++i){
+        if(blockContactModels[i].first == contactParams)
+          contactModel = blockContactModels[i].second;
+      }
+      if(contactModel.is_null()){
+        contactModel = contactModelFactory.create(contactParams);
+        blockContactModels.push_back( pair<Teuchos::ParameterList, Teuchos::RCP<const PeridigmNS::ContactModel> >(contactParams, contactModel) );
+      }
+      contactBlockIt->setPairContactModel(partnerBlockId, contactModel);
+    }
 
-    // For the initial implementation, assume that there is only one contact model
-    // \todo Refactor contact!
-    Teuchos::ParameterList contactModelParams = params.sublist("Models", true);
-    Teuchos::ParameterList contactParams = contactModelParams.sublist( contactModelParams.begin()->first );
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(contactParams.isParameter("Horizon") , "\n**** Error, Horizon is an invalid contact model parameter.\n");
-    contactParams.set("Horizon", blockHorizon);
-    if(!contactParams.isParameter("Friction Coefficient"))
-      contactParams.set("Friction Coefficient", 0.0);
-    Teuchos::RCP<const PeridigmNS::ContactModel> contactModel = contactModelFactory.create(contactParams);
-    contactBlockIt->setContactModel(contactModel);
+    // The block-wide contact model is the first model of the block's interactions,
+    // blocks without interactions fall back on the first entry in the "Models" section
+    if(blockContactModels.size() > 0){
+      contactBlockIt->setContactModel(blockContactModels[0].second);
+    }
+    else{
+      Teuchos::ParameterList contactParams = contactModelParams.sublist( contactModelParams.begin()->first );
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(contactParams.isParameter("Horizon") , "\n**** Error, Horizon is an invalid contact model parameter.\n");
+      contactParams.set("Horizon", blockHorizon);
+      if(!contactParams.isParameter("Friction Coefficient"))
+        contactParams.set("Friction Coefficient", 0.0);
+      contactBlockIt->setContactModel(contactModelFactory.create(contactParams));
+    }
   }
 
   oneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(*oneDimensionalMap_));
@@ -358,20 +450,60 @@ void PeridigmNS::ContactManager::initialize(Teuchos::RCP<const Epetra_BlockMap>
 
   PeridigmNS::Timer::self().stopTimer("Initialize Contact Maps");
 
+  // Record the reference-configuration bond count of each point and the fully-bonded interior count of its block,
+  // these are used to identify exposed points for the surface-only contact search
+  if(surfaceOnlySearch){
+    originalNumNeighbors = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+    referenceNumNeighbors = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+    map<int, int> localMaxNumNeighbors;
+    int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    int* neighborhoodListOwnedIds = neighborhoodData->OwnedIDs();
+    int neighborhoodListIndex = 0;
+    for(int i=0 ; i<neighborhoodData->NumOwnedPoints() ; ++i){
+      int numNeighbors = neighborhoodList[neighborhoodListIndex];
+      neighborhoodListIndex += numNeighbors + 1;
+      int localId = oneDimensionalMap->LID( oneDimensionalOverlapContactMap->GID(neighborhoodListOwnedIds[i]) );
+      if(localId == -1)
+        continue;
+      (*originalNumNeighbors)[localId] = numNeighbors;
+      int blockId = static_cast<int>( (*blockIds_)[localId] );
+      if(numNeighbors > localMaxNumNeighbors[blockId])
+        localMaxNumNeighbors[blockId] = numNeighbors;
+    }
+    map<int, int> globalMaxNumNeighbors;
+    for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
+      int blockId = contactBlockIt->getID();
+      int localMax = localMaxNumNeighbors[blockId];
+      int globalMax(0);
+      oneDimensionalMap->Comm().MaxAll(&localMax, &globalMax, 1);
+      globalMaxNumNeighbors[blockId] = globalMax > 0 ? globalMax : 1;
+    }
+    for(int i=0 ; i<oneDimensionalMap->NumMyElements() ; ++i){
+      map<int, int>::const_iterator it = globalMaxNumNeighbors.find( static_cast<int>( (*blockIds_)[i] ) );
+      (*referenceNumNeighbors)[i] = (it != globalMaxNumNeighbors.end()) ? it->second : 1.0;
+    }
+  }
+
   // Instantiate the importers for passing data between the mothership and contact mothership vectors
   oneDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*oneDimensionalContactMap, *oneDimensionalMap));
   threeDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*threeDimensionalContactMap, *threeDimensionalMap));
 
   // Create the contact mothership multivectors
-  oneDimensionalContactMothership = Teuchos::rcp(new Epetra_MultiVector(*oneDimensionalContactMap, 2));
+  oneDimensionalContactMothership = Teuchos::rcp(new Epetra_MultiVector(*oneDimensionalContactMap, 3));
   contactBlockIDs = Teuchos::rcp((*oneDimensionalContactMothership)(0), false);         // block ID
   contactVolume = Teuchos::rcp((*oneDimensionalContactMothership)(1), false);           // cell volume
+  contactIntactBondFraction = Teuchos::rcp((*oneDimensionalContactMothership)(2), false);   // intact bond fraction
 
   threeDimensionalContactMothership = Teuchos::rcp(new Epetra_MultiVector(*threeDimensionalContactMap, 4));
   contactY = Teuchos::rcp((*threeDimensionalContactMothership)(0), false);             // current positions
   contactV = Teuchos::rcp((*threeDimensionalContactMothership)(1), false);             // velocities
   contactContactForce = Teuchos::rcp((*threeDimensionalContactMothership)(2), false);  // contact force
   contactScratch = Teuchos::rcp((*threeDimensionalContactMothership)(3), false);       // scratch
+
+  if(!nodeToFacetContact.is_null() || rigidContactors.size() > 0)
+    contactSurfaceForce = Teuchos::rcp(new Epetra_Vector(*threeDimensionalContactMap));
+  if(!nodeToFacetContact.is_null())
+    nodeToFacetContact->setContactMap(*threeDimensionalContactMap);
 }
 
 void PeridigmNS::ContactManager::loadAllMothershipData(Teuchos::RCP<Epetra_Vector> blockIds,
@@ -385,6 +517,14 @@ void PeridigmNS::ContactManager::loadAllMothershipData(Teuchos::RCP<Epetra_Vecto
   contactV->Import(*v, *threeDimensionalMothershipToContactMothershipImporter, Insert);
   contactContactForce->PutScalar(0.0);
   contactScratch->PutScalar(0.0);
+  if(surfaceOnlySearch){
+    Epetra_Vector intactBondFraction(*oneDimensionalMap);
+    intactBondFraction.ReciprocalMultiply(1.0, *referenceNumNeighbors, *originalNumNeighbors, 0.0);
+    contactIntactBondFraction->Import(intactBondFraction, *oneDimensionalMothershipToContactMothershipImporter, Insert);
+  }
+  else{
+    contactIntactBondFraction->PutScalar(0.0);
+  }
 }
 
 void PeridigmNS::ContactManager::loadNeighborhoodData(Teuchos::RCP<PeridigmNS::NeighborhoodData> globalNeighborhoodData,
@@ -470,6 +610,7 @@ void PeridigmNS::ContactManager::initializeContactBlocks()
     contactBlockIt->importData(*contactVolume, volumeFieldId, PeridigmField::STEP_NONE, Insert);
     contactBlockIt->importData(*contactY, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
     contactBlockIt->importData(*contactV, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+    contactBlockIt->createContactModelNeighborhoods(blockIdFieldId);
   }
 }
 
@@ -478,13 +619,18 @@ void PeridigmNS::ContactManager::importData(Teuchos::RCP<Epetra_Vector> volume,
                                             Teuchos::RCP<Epetra_Vector> velocity)
 {
   // Import data to the contact manager's mothership vectors
+  // With owner computes the contact and mothership partitionings coincide and this is a local copy
   contactY->Import(*coordinates, *threeDimensionalMothershipToContactMothershipImporter, Insert);
   contactV->Import(*velocity, *threeDimensionalMothershipToContactMothershipImporter, Insert);
 
   // Distribute data to the contact blocks
+  // Positions and velocities travel together in a single halo exchange per block, which is posted here and
+  // completed by evaluateContactForce() so that it proceeds while the internal forces are evaluated
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
-    contactBlockIt->importData(*contactY, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
-    contactBlockIt->importData(*contactV, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+    contactBlockIt->completeImports();
+    contactBlockIt->queueImportData(*contactY, coordinatesFieldId, PeridigmField::STEP_NP1);
+    contactBlockIt->queueImportData(*contactV, velocityFieldId, PeridigmField::STEP_NP1);
+    contactBlockIt->startImports();
   }
 }
 
@@ -496,15 +642,64 @@ void PeridigmNS::ContactManager::exportData(Teuchos::RCP<Epetra_Vector> contactF
     contactBlockIt->exportData(*contactScratch, contactForceDensityFieldId, PeridigmField::STEP_NP1, Add);
     contactContactForce->Update(1.0, *contactScratch, 1.0);
   }
+  if(!contactSurfaceForce.is_null())
+    contactContactForce->Update(1.0, *contactSurfaceForce, 1.0);
   // Copy data from the contact mothership vector to the mothership vector
   contactForce->Export(*contactContactForce, *threeDimensionalMothershipToContactMothershipImporter, Insert);
 }
 
+void PeridigmNS::ContactManager::updateSurfacePoints(int step, Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks)
+{
+  if(!surfaceOnlySearch || !isContactSearchStep(step))
+    return;
+
+  // Start from the reference-configuration bond counts and remove the broken part of each bond
+  Epetra_Vector intactBondFraction(*originalNumNeighbors);
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int bondDamageFieldId(-1);
+  if(fieldManager.hasField("Bond_Damage"))
+    bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+
+  if(bondDamageFieldId != -1){
+    for(std::vector<PeridigmNS::Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+      Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+      if(dataManager.is_null() || !dataManager->hasData(bondDamageFieldId, PeridigmField::STEP_N))
+        continue;
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> blockNeighborhoodData = blockIt->getNeighborhoodData();
+      Teuchos::RCP<const Epetra_BlockMap> blockOverlapMap = blockIt->getOverlapScalarPointMap();
+      double* bondDamage;
+      dataManager->getData(bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamage);
+      const int* ownedIds = blockNeighborhoodData->OwnedIDs();
+      const int* neighborhoodList = blockNeighborhoodData->NeighborhoodList();
+      int neighborhoodListIndex = 0;
+      int bondIndex = 0;
+      for(int i=0 ; i<blockNeighborhoodData->NumOwnedPoints() ; ++i){
+        int numNeighbors = neighborhoodList[neighborhoodListIndex];
+        neighborhoodListIndex += numNeighbors + 1;
+        double brokenBonds = 0.0;
+        for(int j=0 ; j<numNeighbors ; ++j)
+          brokenBonds += bondDamage[bondIndex++];
+        int localId = oneDimensionalMap->LID( blockOverlapMap->GID(ownedIds[i]) );
+        if(localId != -1)
+          intactBondFraction[localId] -= brokenBonds;
+      }
+    }
+  }
+
+  intactBondFraction.ReciprocalMultiply(1.0, *referenceNumNeighbors, intactBondFraction, 0.0);
+  contactIntactBondFraction->Import(intactBondFraction, *oneDimensionalMothershipToContactMothershipImporter, Insert);
+}
+
 void PeridigmNS::ContactManager::rebalance(int step)
 {
-  if( step%contactRebalanceFrequency != 0)
+  if(!isContactSearchStep(step))
     return;
 
+  // The contact blocks are about to be redistributed, finish any pending halo exchange on the current maps
+  for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++)
+    contactBlockIt->completeImports();
+
   const Epetra_Comm& comm = oneDimensionalMap->Comm();
 
   // \todo Handle serial case.  We don't need to rebalance, but we still want to update the contact search.
@@ -523,6 +718,79 @@ void PeridigmNS::ContactManager::rebalance(int step)
   // this list has the global ID for each neighbor of each on-processor point (that is, on processor in the rebalanced configuration)
   Teuchos::RCP<Epetra_Vector> rebalancedNeighborGlobalIDs = createRebalancedNeighborGlobalIDList(rebalancedBondMap, bondMapImporter);
 
+  // carry over the contact pairs of the interactions that are not searched at this step
+  Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs = Teuchos::rcp(new map<int, vector<int> >());
+  Teuchos::RCP< set<int> > offProcessorContactIDs = Teuchos::rcp(new set<int>());
+  retainContactPairs(step, rebalancedOneDimensionalMap, oneDimensionalMapImporter, contactNeighborGlobalIDs, offProcessorContactIDs);
+
+  // the search radius of each block is the largest search radius of its interactions that are searched at this step
+  map<int, double> blockSearchRadius;
+  for(map< pair<int, int>, double >::const_iterator it=pairSearchRadius.begin() ; it!=pairSearchRadius.end() ; ++it){
+    if(isPairSearchStep(it->first, step)){
+      blockSearchRadius[it->first.first] = max(blockSearchRadius[it->first.first], it->second);
+      blockSearchRadius[it->first.second] = max(blockSearchRadius[it->first.second], it->second);
+    }
+  }
+
+  // this function does three things:
+  // 1) fills the neighborhood information in rebalancedDecomp based on the contact search
+  // 2) creates a list of global IDs for each locally-owned point that will need to be searched for contact (contactNeighborGlobalIDs)
+  // 3) keeps track of the additional off-processor IDs that need to be ghosted as a result of the contact search (offProcessorContactIDs)
+  Teuchos::RCP<Epetra_Vector> rebalancedBlockIds = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
+  rebalancedBlockIds->Import(*contactBlockIDs, *oneDimensionalMapImporter, Insert);
+  Teuchos::RCP<Epetra_Vector> rebalancedIntactBondFraction;
+  if(surfaceOnlySearch){
+    rebalancedIntactBondFraction = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
+    rebalancedIntactBondFraction->Import(*contactIntactBondFraction, *oneDimensionalMapImporter, Insert);
+  }
+  contactSearch(rebalancedOneDimensionalMap, rebalancedBondMap, rebalancedNeighborGlobalIDs, rebalancedBlockIds, blockSearchRadius,
+                rebalancedDecomp, contactNeighborGlobalIDs, offProcessorContactIDs, rebalancedIntactBondFraction);
+
+  // with owner computes, the current-configuration partitioning is used for the search only
+  // the contact pairs are handed to the processors that own the points in the mechanical partitioning, which
+  // leaves the contact data aligned with the mothership vectors so that no data changes hands at each step
+  if(ownerComputes){
+    Teuchos::RCP< map<int, vector<int> > > ownerContactNeighborGlobalIDs = Teuchos::rcp(new map<int, vector<int> >());
+    for(int i=0 ; i<oneDimensionalContactMap->NumMyElements() ; ++i)
+      (*ownerContactNeighborGlobalIDs)[oneDimensionalContactMap->GID(i)];
+    Teuchos::RCP<const Epetra_Import> searchToOwnerImporter = Teuchos::rcp(new Epetra_Import(*oneDimensionalContactMap, *rebalancedOneDimensionalMap));
+    migrateContactNeighborGlobalIDs(rebalancedOneDimensionalMap, oneDimensionalContactMap, searchToOwnerImporter, *contactNeighborGlobalIDs, *ownerContactNeighborGlobalIDs);
+    contactNeighborGlobalIDs = ownerContactNeighborGlobalIDs;
+
+    rebalancedOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(*oneDimensionalContactMap));
+    oneDimensionalMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedOneDimensionalMap, *oneDimensionalContactMap));
+    rebalancedThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(*threeDimensionalContactMap));
+    threeDimensionalMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedThreeDimensionalMap, *threeDimensionalContactMap));
+    rebalancedBondMap = Teuchos::rcp(new Epetra_BlockMap(*bondContactMap));
+    bondMapImporter = Teuchos::rcp(new Epetra_Import(*rebalancedBondMap, *bondContactMap));
+    rebalancedNeighborGlobalIDs = createRebalancedNeighborGlobalIDList(rebalancedBondMap, bondMapImporter);
+
+    offProcessorContactIDs->clear();
+    for(map<int, vector<int> >::const_iterator it=contactNeighborGlobalIDs->begin() ; it!=contactNeighborGlobalIDs->end() ; ++it){
+      for(unsigned int j=0 ; j<it->second.size() ; ++j){
+        if(rebalancedOneDimensionalMap->LID(it->second[j]) == -1)
+          offProcessorContactIDs->insert(it->second[j]);
+      }
+    }
+  }
+
+  // report the share of contact pairs with both points on the same processor, the remainder require ghosting
+  if(verbose){
+    int localNumPairs[2] = {0, 0};
+    for(map<int, vector<int> >::const_iterator it=contactNeighborGlobalIDs->begin() ; it!=contactNeighborGlobalIDs->end() ; ++it){
+      localNumPairs[0] += it->second.size();
+      for(unsigned int j=0 ; j<it->second.size() ; ++j){
+        if(rebalancedOneDimensionalMap->LID(it->second[j]) == -1)
+          localNumPairs[1] += 1;
+      }
+    }
+    int globalNumPairs[2] = {0, 0};
+    comm.SumAll(localNumPairs, globalNumPairs, 2);
+    if(myPID == 0 && globalNumPairs[0] > 0)
+      cout << "-- Contact search at step " << step << ": " << globalNumPairs[0] << " candidate pairs, "
+           << 100.0*(globalNumPairs[0] - globalNumPairs[1])/globalNumPairs[0] << "% on processor\n" << endl;
+  }
+
   // create a list of all the off-processor IDs that will need to be ghosted
   set<int> offProcessorIDs;
   for(int i=0 ; i<rebalancedNeighborGlobalIDs->MyLength() ; ++i){
@@ -531,14 +799,6 @@ void PeridigmNS::ContactManager::rebalance(int step)
       offProcessorIDs.insert(globalID);
   }
 
-  // this function does three things:
-  // 1) fills the neighborhood information in rebalancedDecomp based on the contact search
-  // 2) creates a list of global IDs for each locally-owned point that will need to be searched for contact (contactNeighborGlobalIDs)
-  // 3) keeps track of the additional off-processor IDs that need to be ghosted as a result of the contact search (offProcessorContactIDs)
-  Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs = Teuchos::rcp(new map<int, vector<int> >());
-  Teuchos::RCP< set<int> > offProcessorContactIDs = Teuchos::rcp(new set<int>());
-  contactSearch(rebalancedOneDimensionalMap, rebalancedBondMap, rebalancedNeighborGlobalIDs, rebalancedDecomp, contactNeighborGlobalIDs, offProcessorContactIDs);
-
   // add the off-processor IDs required for contact to the list of points that will be ghosted
   for(set<int>::const_iterator it=offProcessorContactIDs->begin() ; it!=offProcessorContactIDs->end() ; it++){
     offProcessorIDs.insert(*it);
@@ -582,6 +842,7 @@ void PeridigmNS::ContactManager::rebalance(int step)
   oneDimensionalContactMothership = rebalancedOneDimensionalMothership;
   contactBlockIDs = Teuchos::rcp((*oneDimensionalContactMothership)(0), false);         // block ID
   contactVolume = Teuchos::rcp((*oneDimensionalContactMothership)(1), false);           // cell volume
+  contactIntactBondFraction = Teuchos::rcp((*oneDimensionalContactMothership)(2), false);   // intact bond fraction
 
   Teuchos::RCP<Epetra_MultiVector> rebalancedThreeDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedThreeDimensionalMap, threeDimensionalContactMothership->NumVectors()));
   rebalancedThreeDimensionalMothership->Import(*threeDimensionalContactMothership, *threeDimensionalMapImporter, Insert);
@@ -591,6 +852,16 @@ void PeridigmNS::ContactManager::rebalance(int step)
   contactContactForce = Teuchos::rcp((*threeDimensionalContactMothership)(2), false);  // contact force
   contactScratch = Teuchos::rcp((*threeDimensionalContactMothership)(3), false);       // scratch
 
+  // store each contact pair within a block only once, the contact models apply the force to both points
+  contactNeighborhoodData = createHalfContactNeighborhoodData(contactNeighborhoodData,
+                                                              rebalancedOneDimensionalMap,
+                                                              rebalancedOneDimensionalOverlapMap,
+                                                              rebalancedThreeDimensionalMap,
+                                                              rebalancedThreeDimensionalOverlapMap,
+                                                              contactBlockIDs,
+                                                              contactY,
+                                                              step);
+
   // rebalance the contact blocks
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++)
     contactBlockIt->rebalance(rebalancedOneDimensionalMap,
@@ -609,6 +880,7 @@ void PeridigmNS::ContactManager::rebalance(int step)
     contactBlockIt->importData(*contactVolume, volumeFieldId, PeridigmField::STEP_NONE, Insert);
     contactBlockIt->importData(*contactY, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
     contactBlockIt->importData(*contactV, velocityFieldId, PeridigmField::STEP_NP1, Insert);
+    contactBlockIt->createContactModelNeighborhoods(blockIdFieldId);
   }
 
   // set all the pointers to the new maps
@@ -622,6 +894,14 @@ void PeridigmNS::ContactManager::rebalance(int step)
   // Reset the importers for passing data between the mothership and contact mothership vectors
   oneDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*oneDimensionalContactMap, *oneDimensionalMap));
   threeDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*threeDimensionalContactMap, *threeDimensionalMap));
+
+  // The surface contact force is defined on the contact map, and node-to-facet contact gathers the facet owners from it
+  if(!contactSurfaceForce.is_null())
+    contactSurfaceForce = Teuchos::rcp(new Epetra_Vector(*threeDimensionalContactMap));
+  if(!nodeToFacetContact.is_null())
+    nodeToFacetContact->setContactMap(*threeDimensionalContactMap);
+
+  Memstat::Instance()->addPeakRSSStat("Contact Rebalance");
 }
 
 QUICKGRID::Data PeridigmNS::ContactManager::currentConfigurationDecomp() {
@@ -710,6 +990,126 @@ Teuchos::RCP<Epetra_BlockMap> PeridigmNS::ContactManager::createRebalancedBondMa
   return rebalancedBondMap;
 }
 
+void PeridigmNS::ContactManager::retainContactPairs(int step,
+                                                    Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                                                    Teuchos::RCP<const Epetra_Import> oneDimensionalMapToRebalancedOneDimensionalMapImporter,
+                                                    Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs,
+                                                    Teuchos::RCP< set<int> > offProcessorContactIDs)
+{
+  // nothing to retain if every interaction is searched at this step
+  bool allPairsSearched = true;
+  for(map< pair<int, int>, int >::const_iterator it=pairSearchFrequency.begin() ; it!=pairSearchFrequency.end() ; ++it){
+    if(!isPairSearchStep(it->first, step))
+      allPairsSearched = false;
+  }
+  if(allPairsSearched)
+    return;
+
+  // block ids for the ghosted points in the current contact partitioning
+  Epetra_Import overlapImporter(*oneDimensionalOverlapContactMap, *oneDimensionalContactMap);
+  Epetra_Vector overlapBlockIds(*oneDimensionalOverlapContactMap);
+  overlapBlockIds.Import(*contactBlockIDs, overlapImporter, Insert);
+
+  // collect the global IDs of the current contact neighbors that belong to interactions not searched at this step
+  map<int, vector<int> > retainedNeighborGlobalIDs;
+  const int* ownedIDs = contactNeighborhoodData->OwnedIDs();
+  const int* neighborhoodList = contactNeighborhoodData->NeighborhoodList();
+  int neighborhoodListIndex = 0;
+  for(int iID=0 ; iID<contactNeighborhoodData->NumOwnedPoints() ; ++iID){
+    int localID = ownedIDs[iID];
+    int globalID = oneDimensionalOverlapContactMap->GID(localID);
+    int blockId = static_cast<int>(overlapBlockIds[localID]);
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      int neighborLocalID = neighborhoodList[neighborhoodListIndex++];
+      int neighborBlockId = static_cast<int>(overlapBlockIds[neighborLocalID]);
+      pair<int, int> blockPair(min(blockId, neighborBlockId), max(blockId, neighborBlockId));
+      if(pairSearchFrequency.find(blockPair) != pairSearchFrequency.end() && !isPairSearchStep(blockPair, step))
+        retainedNeighborGlobalIDs[globalID].push_back( oneDimensionalOverlapContactMap->GID(neighborLocalID) );
+    }
+  }
+
+  // redistribute the retained pairs to the rebalanced partitioning
+  map<int, vector<int> > rebalancedRetainedNeighborGlobalIDs;
+  migrateContactNeighborGlobalIDs(oneDimensionalContactMap,
+                                  rebalancedOneDimensionalMap,
+                                  oneDimensionalMapToRebalancedOneDimensionalMapImporter,
+                                  retainedNeighborGlobalIDs,
+                                  rebalancedRetainedNeighborGlobalIDs);
+
+  for(map<int, vector<int> >::const_iterator it=rebalancedRetainedNeighborGlobalIDs.begin() ; it!=rebalancedRetainedNeighborGlobalIDs.end() ; ++it){
+    vector<int>& contactNeighborGlobalIDList = (*contactNeighborGlobalIDs)[it->first];
+    for(unsigned int j=0 ; j<it->second.size() ; ++j){
+      int globalNeighborID = it->second[j];
+      contactNeighborGlobalIDList.push_back(globalNeighborID);
+      if(rebalancedOneDimensionalMap->LID(globalNeighborID) == -1)
+        offProcessorContactIDs->insert(globalNeighborID);
+    }
+  }
+}
+
+void PeridigmNS::ContactManager::migrateContactNeighborGlobalIDs(Teuchos::RCP<const Epetra_BlockMap> sourceOneDimensionalMap,
+                                                                 Teuchos::RCP<const Epetra_BlockMap> targetOneDimensionalMap,
+                                                                 Teuchos::RCP<const Epetra_Import> sourceToTargetImporter,
+                                                                 const map<int, vector<int> >& sourceNeighborGlobalIDs,
+                                                                 map<int, vector<int> >& targetNeighborGlobalIDs)
+{
+  const Epetra_Comm& comm = sourceOneDimensionalMap->Comm();
+
+  // communicate the number of neighbors for each point so that space can be allocated in the target partitioning
+  // care must be taken because you cannot have an element with zero length
+  Epetra_Vector numberOfNeighbors(*sourceOneDimensionalMap);
+  vector<int> sourcePointGlobalIDs;
+  vector<int> sourcePointNumNeighbors;
+  vector<double> sourceNeighbors;
+  for(map<int, vector<int> >::const_iterator it=sourceNeighborGlobalIDs.begin() ; it!=sourceNeighborGlobalIDs.end() ; ++it){
+    int localID = sourceOneDimensionalMap->LID(it->first);
+    if(localID == -1 || it->second.size() == 0)
+      continue;
+    numberOfNeighbors[localID] = it->second.size();
+    sourcePointGlobalIDs.push_back(it->first);
+    sourcePointNumNeighbors.push_back(it->second.size());
+    sourceNeighbors.insert(sourceNeighbors.end(), it->second.begin(), it->second.end());
+  }
+  Epetra_Vector targetNumberOfNeighbors(*targetOneDimensionalMap);
+  targetNumberOfNeighbors.Import(numberOfNeighbors, *sourceToTargetImporter, Insert);
+  vector<int> targetPointGlobalIDs;
+  vector<int> targetPointNumNeighbors;
+  for(int i=0 ; i<targetOneDimensionalMap->NumMyElements() ; ++i){
+    int numNeighbors = static_cast<int>(targetNumberOfNeighbors[i]);
+    if(numNeighbors > 0){
+      targetPointGlobalIDs.push_back(targetOneDimensionalMap->GID(i));
+      targetPointNumNeighbors.push_back(numNeighbors);
+    }
+  }
+
+  Epetra_BlockMap sourceNeighborMap(-1,
+                                    sourcePointGlobalIDs.size(),
+                                    sourcePointGlobalIDs.size() > 0 ? &sourcePointGlobalIDs[0] : 0,
+                                    sourcePointNumNeighbors.size() > 0 ? &sourcePointNumNeighbors[0] : 0,
+                                    0,
+                                    comm);
+  Epetra_BlockMap targetNeighborMap(-1,
+                                    targetPointGlobalIDs.size(),
+                                    targetPointGlobalIDs.size() > 0 ? &targetPointGlobalIDs[0] : 0,
+                                    targetPointNumNeighbors.size() > 0 ? &targetPointNumNeighbors[0] : 0,
+                                    0,
+                                    comm);
+
+  // redistribute the neighbor global IDs
+  Epetra_Vector sourceNeighborVector(View, sourceNeighborMap, sourceNeighbors.size() > 0 ? &sourceNeighbors[0] : 0);
+  Epetra_Vector targetNeighborVector(targetNeighborMap);
+  Epetra_Import neighborImporter(targetNeighborMap, sourceNeighborMap);
+  targetNeighborVector.Import(sourceNeighborVector, neighborImporter, Insert);
+
+  const int* firstPointInElementList = targetNeighborMap.FirstPointInElementList();
+  for(int i=0 ; i<targetNeighborMap.NumMyElements() ; ++i){
+    vector<int>& neighborGlobalIDList = targetNeighborGlobalIDs[targetNeighborMap.GID(i)];
+    for(int j=0 ; j<targetNeighborMap.ElementSize(i) ; ++j)
+      neighborGlobalIDList.push_back( static_cast<int>(targetNeighborVector[firstPointInElementList[i] + j]) );
+  }
+}
+
 template<class T>
 struct NonDeleter{
 	void operator()(T* d) {}
@@ -718,41 +1118,76 @@ struct NonDeleter{
 void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap, 
                                                Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                                                Teuchos::RCP<const Epetra_Vector> rebalancedNeighborGlobalIDs,
+                                               Teuchos::RCP<const Epetra_Vector> rebalancedBlockIds,
+                                               const map<int, double>& blockSearchRadius,
                                                QUICKGRID::Data& rebalancedDecomp,
                                                Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs,
-                                               Teuchos::RCP< set<int> > offProcessorContactIDs)
+                                               Teuchos::RCP< set<int> > offProcessorContactIDs,
+                                               Teuchos::RCP<const Epetra_Vector> rebalancedIntactBondFraction)
 {
   const Epetra_Comm& comm = oneDimensionalMap->Comm();
 
   std::shared_ptr<const Epetra_Comm> comm_shared_ptr(&comm,NonDeleter<const Epetra_Comm>());
   QUICKGRID::Data d = rebalancedDecomp;
 
-  // TEMPORARY PLACEHOLDER FOR PER-NODE SEARCH RADII
-  Teuchos::RCP<Epetra_Vector> contactSearchRadii = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
-  contactSearchRadii->PutScalar(contactSearchRadius);
+  // every locally-owned point requires an entry in contactNeighborGlobalIDs, even if it is not searched
+  for(size_t iPt=0 ; iPt<rebalancedDecomp.numPoints ; ++iPt)
+    (*contactNeighborGlobalIDs)[rebalancedDecomp.myGlobalIDs.get()[iPt]];
+
+  // restrict the search to points in blocks with an interaction that is searched at this step and,
+  // for the surface-only search, to exposed points, interior points are shielded from contact by their neighbors
+  const double exposedThreshold = 1.0 - surfaceDetectionTolerance;
+  UTILITIES::Array<int> searchGlobalIDArray(d.numPoints);
+  UTILITIES::Array<double> searchXArray(3*d.numPoints);
+  vector<double> searchRadii;
+  searchRadii.reserve(d.numPoints);
+  const int* globalIDs = d.myGlobalIDs.get();
+  const double* x = d.myX.get();
+  size_t numSearchPoints = 0;
+  for(size_t iPt=0 ; iPt<d.numPoints ; ++iPt){
+    int localID = rebalancedOneDimensionalMap->LID(globalIDs[iPt]);
+    map<int, double>::const_iterator radiusIt = blockSearchRadius.find( static_cast<int>((*rebalancedBlockIds)[localID]) );
+    if(radiusIt == blockSearchRadius.end())
+      continue;
+    if(!rebalancedIntactBondFraction.is_null() && (*rebalancedIntactBondFraction)[localID] >= exposedThreshold)
+      continue;
+    searchGlobalIDArray.get()[numSearchPoints] = globalIDs[iPt];
+    for(int dof=0 ; dof<3 ; ++dof)
+      searchXArray.get()[3*numSearchPoints+dof] = x[3*iPt+dof];
+    searchRadii.push_back(radiusIt->second);
+    numSearchPoints++;
+  }
+  std::shared_ptr<int> searchPointGlobalIDs = searchGlobalIDArray.get_shared_ptr();
+  std::shared_ptr<double> searchPointX = searchXArray.get_shared_ptr();
 
-  PDNEIGH::NeighborhoodList neighList(comm_shared_ptr,d.zoltanPtr.get(),d.numPoints,d.myGlobalIDs,d.myX,contactSearchRadii);
+  // per-point search radii, taken from the interactions of each point's block
+  Epetra_BlockMap searchPointMap(-1, numSearchPoints, searchPointGlobalIDs.get(), 1, 0, comm);
+  Teuchos::RCP<Epetra_Vector> contactSearchRadii = Teuchos::rcp(new Epetra_Vector(searchPointMap));
+  for(size_t iPt=0 ; iPt<numSearchPoints ; ++iPt)
+    (*contactSearchRadii)[iPt] = searchRadii[iPt];
+
+  PDNEIGH::NeighborhoodList neighList(comm_shared_ptr,d.zoltanPtr.get(),numSearchPoints,searchPointGlobalIDs,searchPointX,contactSearchRadii);
 
   int* searchNeighborhood = neighList.get_neighborhood().get();
 
   int* searchGlobalIDs = neighList.get_owned_gids().get();
   int searchListIndex = 0;
-  for(size_t iPt=0 ; iPt<rebalancedDecomp.numPoints ; ++iPt){
+  vector<int> bondedNeighbors;
+  for(size_t iPt=0 ; iPt<numSearchPoints ; ++iPt){
 
     int globalID = searchGlobalIDs[iPt];
     vector<int>& contactNeighborGlobalIDList = (*contactNeighborGlobalIDs)[globalID];
 
-    // create a list of global IDs that this point is bonded to
-    set<int> bondedNeighbors;
+    // create a sorted list of global IDs that this point is bonded to
+    bondedNeighbors.clear();
     int tempLocalID = rebalancedBondMap->LID(globalID);
     // if there is no entry in rebalancedBondMap, then there are no bonded neighbors for this point
     if(tempLocalID != -1){
       int firstNeighbor = rebalancedBondMap->FirstPointInElementList()[tempLocalID];
       int numNeighbors = rebalancedBondMap->ElementSize(tempLocalID);
-      for(int i=0 ; i<numNeighbors ; ++i){
-        int neighborGlobalID = (int)( (*rebalancedNeighborGlobalIDs)[firstNeighbor + i] );
-        bondedNeighbors.insert(neighborGlobalID);
-      }
+      for(int i=0 ; i<numNeighbors ; ++i)
+        bondedNeighbors.push_back( (int)( (*rebalancedNeighborGlobalIDs)[firstNeighbor + i] ) );
+      std::sort(bondedNeighbors.begin(), bondedNeighbors.end());
     }
 
     // loop over the neighbors found by the contact search
@@ -760,14 +1195,19 @@ void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMa
     int searchNumNeighbors = searchNeighborhood[searchListIndex++];
     for(int iNeighbor=0 ; iNeighbor<searchNumNeighbors ; ++iNeighbor){
       int globalNeighborID = searchNeighborhood[searchListIndex++];
-      set<int>::iterator it = bondedNeighbors.find(globalNeighborID);  // \todo Don't consider broken bonds here
-      if(it == bondedNeighbors.end()){
+      if(!std::binary_search(bondedNeighbors.begin(), bondedNeighbors.end(), globalNeighborID)){  // \todo Don't consider broken bonds here
         contactNeighborGlobalIDList.push_back(globalNeighborID);
         if(rebalancedOneDimensionalMap->LID(globalNeighborID) == -1)
           offProcessorContactIDs->insert(globalNeighborID);
       }
     }
   }
+
+  // a pair may have been both retained from the previous search and found by this one
+  for(map<int, vector<int> >::iterator it=contactNeighborGlobalIDs->begin() ; it!=contactNeighborGlobalIDs->end() ; ++it){
+    std::sort(it->second.begin(), it->second.end());
+    it->second.erase(std::unique(it->second.begin(), it->second.end()), it->second.end());
+  }
 }
 
 Teuchos::RCP<Epetra_Vector> PeridigmNS::ContactManager::createRebalancedNeighborGlobalIDList(Teuchos::RCP<Epetra_BlockMap> rebalancedBondMap,
@@ -887,24 +1327,175 @@ Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::ContactManager::createReb
 	return rebalancedContactNeighborhoodData;
 }
 
+Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::ContactManager::createHalfContactNeighborhoodData(Teuchos::RCP<const PeridigmNS::NeighborhoodData> fullContactNeighborhoodData,
+                                                                                                         Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                                                                                                         Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalOverlapMap,
+                                                                                                         Teuchos::RCP<const Epetra_BlockMap> rebalancedThreeDimensionalMap,
+                                                                                                         Teuchos::RCP<const Epetra_BlockMap> rebalancedThreeDimensionalOverlapMap,
+                                                                                                         Teuchos::RCP<const Epetra_Vector> rebalancedBlockIds,
+                                                                                                         Teuchos::RCP<const Epetra_Vector> rebalancedY,
+                                                                                                         int step)
+{
+  // block ids and current positions for the ghosted points
+  Epetra_Import overlapImporter(*rebalancedOneDimensionalOverlapMap, *rebalancedOneDimensionalMap);
+  Epetra_Vector overlapBlockIds(*rebalancedOneDimensionalOverlapMap);
+  overlapBlockIds.Import(*rebalancedBlockIds, overlapImporter, Insert);
+  Epetra_Import threeDimensionalOverlapImporter(*rebalancedThreeDimensionalOverlapMap, *rebalancedThreeDimensionalMap);
+  Epetra_Vector overlapY(*rebalancedThreeDimensionalOverlapMap);
+  overlapY.Import(*rebalancedY, threeDimensionalOverlapImporter, Insert);
+
+  // the contact search is symmetric, so a pair within a block is retained only by the point with the lower global ID
+  // pairs that cross blocks are retained on both sides, each side applies the force of the pair's contact model
+  // the search is carried out with the largest radius of each block, pairs searched at this step are trimmed to the radius of their interaction
+  const int numOwnedPoints = fullContactNeighborhoodData->NumOwnedPoints();
+  const int* fullOwnedIDs = fullContactNeighborhoodData->OwnedIDs();
+  const int* fullNeighborhoodList = fullContactNeighborhoodData->NeighborhoodList();
+  vector<int> neighborhoodList;
+  neighborhoodList.reserve(fullContactNeighborhoodData->NeighborhoodListSize());
+  vector<int> neighborhoodPtr(numOwnedPoints);
+  int fullIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int localID = fullOwnedIDs[iID];
+    int globalID = rebalancedOneDimensionalOverlapMap->GID(localID);
+    double blockId = overlapBlockIds[localID];
+    neighborhoodPtr[iID] = neighborhoodList.size();
+    int numNeighborsIndex = neighborhoodList.size();
+    neighborhoodList.push_back(0);
+    int numNeighbors = fullNeighborhoodList[fullIndex++];
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      int neighborLocalID = fullNeighborhoodList[fullIndex++];
+      double neighborBlockId = overlapBlockIds[neighborLocalID];
+      if(neighborBlockId == blockId && rebalancedOneDimensionalOverlapMap->GID(neighborLocalID) < globalID)
+        continue;
+      pair<int, int> blockPair(static_cast<int>(min(blockId, neighborBlockId)), static_cast<int>(max(blockId, neighborBlockId)));
+      map< pair<int, int>, double >::const_iterator radiusIt = pairSearchRadius.find(blockPair);
+      if(radiusIt == pairSearchRadius.end())
+        continue;
+      if(isPairSearchStep(blockPair, step)){
+        double dx = overlapY[3*neighborLocalID]   - overlapY[3*localID];
+        double dy = overlapY[3*neighborLocalID+1] - overlapY[3*localID+1];
+        double dz = overlapY[3*neighborLocalID+2] - overlapY[3*localID+2];
+        if(dx*dx + dy*dy + dz*dz > radiusIt->second*radiusIt->second)
+          continue;
+      }
+      neighborhoodList.push_back(neighborLocalID);
+      neighborhoodList[numNeighborsIndex] += 1;
+    }
+  }
+
+  Teuchos::RCP<PeridigmNS::NeighborhoodData> halfContactNeighborhoodData = Teuchos::rcp(new PeridigmNS::NeighborhoodData);
+  halfContactNeighborhoodData->SetNumOwned(numOwnedPoints);
+  if(numOwnedPoints > 0){
+    memcpy(halfContactNeighborhoodData->OwnedIDs(), fullOwnedIDs, numOwnedPoints*sizeof(int));
+    memcpy(halfContactNeighborhoodData->NeighborhoodPtr(), &neighborhoodPtr[0], numOwnedPoints*sizeof(int));
+  }
+  halfContactNeighborhoodData->SetNeighborhoodListSize(neighborhoodList.size());
+  if(neighborhoodList.size() > 0)
+    memcpy(halfContactNeighborhoodData->NeighborhoodList(), &neighborhoodList[0], neighborhoodList.size()*sizeof(int));
+
+  return halfContactNeighborhoodData;
+}
+
 void PeridigmNS::ContactManager::evaluateContactForce(double dt)
 {
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
 
-    Teuchos::RCP<PeridigmNS::NeighborhoodData> nData = contactBlockIt->getNeighborhoodData();
-    const int numOwnedPoints = nData->NumOwnedPoints();
-    const int* ownedIDs = nData->OwnedIDs();
-    const int* neighborhoodList = nData->NeighborhoodList();
-    Teuchos::RCP<PeridigmNS::DataManager> dataManager = contactBlockIt->getDataManager();
-    Teuchos::RCP<const PeridigmNS::ContactModel> contactModel = contactBlockIt->getContactModel();
+    // Complete the halo exchange posted by importData()
+    contactBlockIt->completeImports();
 
-    if(!contactModel.is_null())
+    Teuchos::RCP<PeridigmNS::DataManager> dataManager = contactBlockIt->getDataManager();
+    const vector< pair< Teuchos::RCP<const PeridigmNS::ContactModel>, Teuchos::RCP<PeridigmNS::NeighborhoodData> > >& contactModelNeighborhoods =
+      contactBlockIt->getContactModelNeighborhoods();
+
+    // Each contact model overwrites the contact force, blocks with several models sum the contributions
+    Teuchos::RCP<Epetra_Vector> blockContactForce = dataManager->getData(contactForceDensityFieldId, PeridigmField::STEP_NP1);
+    Teuchos::RCP<Epetra_Vector> summedContactForce;
+    if(contactModelNeighborhoods.size() > 1)
+      summedContactForce = Teuchos::rcp(new Epetra_Vector(blockContactForce->Map()));
+    else if(contactModelNeighborhoods.size() == 0)
+      blockContactForce->PutScalar(0.0);
+
+    for(unsigned int i=0 ; i<contactModelNeighborhoods.size() ; ++i){
+      Teuchos::RCP<const PeridigmNS::ContactModel> contactModel = contactModelNeighborhoods[i].first;
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> nData = contactModelNeighborhoods[i].second;
       contactModel->computeForce(dt, 
-                                 numOwnedPoints,
-                                 ownedIDs,
-                                 neighborhoodList,
+                                 nData->NumOwnedPoints(),
+                                 nData->OwnedIDs(),
+                                 nData->NeighborhoodList(),
                                  *dataManager);
+      if(!summedContactForce.is_null())
+        summedContactForce->Update(1.0, *blockContactForce, 1.0);
+    }
+    if(!summedContactForce.is_null())
+      *blockContactForce = *summedContactForce;
+  }
+
+  // Node-to-facet and rigid contactor contact operate directly on the contact mothership vectors
+  if(!contactSurfaceForce.is_null())
+    contactSurfaceForce->PutScalar(0.0);
+  if(!nodeToFacetContact.is_null())
+    nodeToFacetContact->computeForce(*contactBlockIDs, *contactVolume, *contactY, *contactV, *contactSurfaceForce);
+  for(unsigned int i=0 ; i<rigidContactors.size() ; ++i)
+    rigidContactors[i]->computeForce(*contactBlockIDs, *contactVolume, *contactY, *contactV, *contactSurfaceForce);
+}
+
+void PeridigmNS::ContactManager::updateRigidContactors(double dt)
+{
+  for(unsigned int i=0 ; i<rigidContactors.size() ; ++i)
+    rigidContactors[i]->updateMotion(dt);
+}
+
+Teuchos::RCP<const PeridigmNS::RigidContactor> PeridigmNS::ContactManager::getRigidContactor(const std::string& name) const
+{
+  for(unsigned int i=0 ; i<rigidContactors.size() ; ++i){
+    if(rigidContactors[i]->Name() == name)
+      return rigidContactors[i];
   }
+  return Teuchos::null;
+}
+
+void PeridigmNS::ContactManager::accumulateMemoryUsage(std::map<std::string, double>& bytesPerCategory)
+{
+  double neighborListBytes(0.0), dataBytes(0.0);
+
+  if(!neighborhoodData.is_null())
+    neighborListBytes += neighborhoodData->memorySizeInBytes();
+  if(!contactNeighborhoodData.is_null())
+    neighborListBytes += contactNeighborhoodData->memorySizeInBytes();
+
+  if(!oneDimensionalContactMothership.is_null())
+    dataBytes += static_cast<double>(oneDimensionalContactMothership->MyLength())*oneDimensionalContactMothership->NumVectors()*sizeof(double);
+  if(!threeDimensionalContactMothership.is_null())
+    dataBytes += static_cast<double>(threeDimensionalContactMothership->MyLength())*threeDimensionalContactMothership->NumVectors()*sizeof(double);
+  if(!contactSurfaceForce.is_null())
+    dataBytes += static_cast<double>(contactSurfaceForce->MyLength())*sizeof(double);
+  if(!nodeToFacetContact.is_null())
+    nodeToFacetContact->accumulateMemoryUsage(bytesPerCategory);
+
+  if(!contactBlocks.is_null()){
+    for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> blockNeighborhoodData = contactBlockIt->getNeighborhoodData();
+      if(!blockNeighborhoodData.is_null())
+        neighborListBytes += blockNeighborhoodData->memorySizeInBytes();
+      // with more than one contact model the block neighborhood is split into separate lists
+      const vector< pair< Teuchos::RCP<const PeridigmNS::ContactModel>, Teuchos::RCP<PeridigmNS::NeighborhoodData> > >& contactModelNeighborhoods =
+        contactBlockIt->getContactModelNeighborhoods();
+      for(unsigned int i=0 ; i<contactModelNeighborhoods.size() ; ++i){
+        if(contactModelNeighborhoods[i].second != blockNeighborhoodData)
+          neighborListBytes += contactModelNeighborhoods[i].second->memorySizeInBytes();
+      }
+      Teuchos::RCP<PeridigmNS::DataManager> dataManager = contactBlockIt->getDataManager();
+      if(!dataManager.is_null()){
+        std::map<int, double> bytesPerFieldId;
+        dataManager->accumulateMemoryUsage(bytesPerFieldId);
+        for(std::map<int, double>::const_iterator it = bytesPerFieldId.begin() ; it != bytesPerFieldId.end() ; ++it)
+          dataBytes += it->second;
+      }
+    }
+  }
+
+  bytesPerCategory["Contact Neighbor Lists"] += neighborListBytes;
+  bytesPerCategory["Contact Data"] += dataBytes;
 }
 
 void PeridigmNS::ContactManager::createBondOverlapMapAndOverlapNeighborsList()
@@ -56,7 +56,10 @@
 #include <Epetra_Vector.h>
 #include <Epetra_Import.h>
 #include "Peridigm_ContactBlock.hpp"
+#include "Peridigm_Block.hpp"
 #include "Peridigm_ContactModel.hpp"
+#include "Peridigm_NodeToFacetContact.hpp"
+#include "Peridigm_RigidContactor.hpp"
 #include "QuickGridData.h"
 
 // \todo These includes are temporary, remove them.
@@ -84,6 +87,9 @@ namespace PeridigmNS {
     void createContactInteractionsList(const Teuchos::ParameterList& contactParams,
                                        Teuchos::RCP<Discretization> disc);
 
+    //! Return true if the contact search is carried out for at least one interaction at the given step.
+    bool isContactSearchStep(int step) const;
+
     //! Initialization routine to allocate and initialize data structures.
     void initialize(Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap_,
                     Teuchos::RCP<const Epetra_BlockMap> threeDimensionalMap_,
@@ -117,10 +123,28 @@ namespace PeridigmNS {
 
     Teuchos::RCP< std::vector<PeridigmNS::ContactBlock> > getContactBlocks(){ return contactBlocks; };
 
+    /*! \brief Update the set of exposed points used by the surface-only contact search.
+     *
+     *  A point is exposed when its intact bond count, computed from the bond damage in the material blocks,
+     *  falls below the fully-bonded interior count of its block by more than the surface detection tolerance.
+     *  This covers both free surfaces in the reference configuration and fracture surfaces.  The update is
+     *  carried out only on contact search steps and only when "Surface Only Search" is enabled.
+     */
+    void updateSurfacePoints(int step, Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
+
     void rebalance(int step);
 
     void evaluateContactForce(double dt);
 
+    //! Advance the rigid contactors over one time step using the reactions from the last force evaluation.
+    void updateRigidContactors(double dt);
+
+    //! Return the rigid contactor with the given name, or null if there is no such contactor.
+    Teuchos::RCP<const PeridigmNS::RigidContactor> getRigidContactor(const std::string& name) const;
+
+    //! Adds the number of bytes owned by the contact neighbor lists and contact data to the given map.
+    void accumulateMemoryUsage(std::map<std::string, double>& bytesPerCategory);
+
     //! Destructor.
     ~ContactManager(){}
     
@@ -158,19 +182,61 @@ namespace PeridigmNS {
                                                                                 Teuchos::RCP<Epetra_BlockMap> rebalancedBondMap,
                                                                                 Teuchos::RCP<Epetra_Vector> rebalancedNeighborGlobalIDs);
 
+    //! Return true if the contact search for the given (ordered) block pair is carried out at the given step.
+    bool isPairSearchStep(const std::pair<int, int>& blockPair, int step) const;
+
+    /*! \brief Carry the current contact pairs of interactions that are not searched at this step over to the rebalanced partitioning.
+     *
+     *  The retained global IDs are appended to contactNeighborGlobalIDs and any that are off processor in the
+     *  rebalanced partitioning are added to offProcessorContactIDs.
+     */
+    void retainContactPairs(int step,
+                            Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                            Teuchos::RCP<const Epetra_Import> oneDimensionalMapToRebalancedOneDimensionalMapImporter,
+                            Teuchos::RCP< std::map<int, std::vector<int> > > contactNeighborGlobalIDs,
+                            Teuchos::RCP< std::set<int> > offProcessorContactIDs);
+
+    /*! \brief Move per-point lists of neighbor global IDs from one partitioning to another.
+     *
+     *  The list of each point in sourceNeighborGlobalIDs is appended to the list of the same point in targetNeighborGlobalIDs
+     *  on the processor that owns the point in the target partitioning.
+     */
+    void migrateContactNeighborGlobalIDs(Teuchos::RCP<const Epetra_BlockMap> sourceOneDimensionalMap,
+                                         Teuchos::RCP<const Epetra_BlockMap> targetOneDimensionalMap,
+                                         Teuchos::RCP<const Epetra_Import> sourceToTargetImporter,
+                                         const std::map<int, std::vector<int> >& sourceNeighborGlobalIDs,
+                                         std::map<int, std::vector<int> >& targetNeighborGlobalIDs);
+
     //! Fill the contact neighbor information in rebalancedDecomp and populate contactNeighborsGlobalIDs and offProcesorContactIDs
     void contactSearch(Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
                        Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                        Teuchos::RCP<const Epetra_Vector> rebalancedNeighborGlobalIDs,
+                       Teuchos::RCP<const Epetra_Vector> rebalancedBlockIds,
+                       const std::map<int, double>& blockSearchRadius,
                        QUICKGRID::Data& rebalancedDecomp,
                        Teuchos::RCP< std::map<int, std::vector<int> > > contactNeighborGlobalIDs,
-                       Teuchos::RCP< std::set<int> > offProcessorContactIDs);
+                       Teuchos::RCP< std::set<int> > offProcessorContactIDs,
+                       Teuchos::RCP<const Epetra_Vector> rebalancedIntactBondFraction = Teuchos::null);
 
     //! Create a rebalanced NeighborhoodData object for contact
     Teuchos::RCP<PeridigmNS::NeighborhoodData> createRebalancedContactNeighborhoodData(Teuchos::RCP<std::map<int, std::vector<int> > > contactNeighborGlobalIDs,
                                                                                        Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
                                                                                        Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalOverlapMap);
 
+    /*! \brief Create a contact NeighborhoodData object in which each contact pair within a block appears only once.
+     *
+     *  Pairs between blocks that do not interact are removed, as are pairs searched at this step that lie beyond
+     *  the search radius of their interaction.
+     */
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> createHalfContactNeighborhoodData(Teuchos::RCP<const PeridigmNS::NeighborhoodData> fullContactNeighborhoodData,
+                                                                                 Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalMap,
+                                                                                 Teuchos::RCP<const Epetra_BlockMap> rebalancedOneDimensionalOverlapMap,
+                                                                                 Teuchos::RCP<const Epetra_BlockMap> rebalancedThreeDimensionalMap,
+                                                                                 Teuchos::RCP<const Epetra_BlockMap> rebalancedThreeDimensionalOverlapMap,
+                                                                                 Teuchos::RCP<const Epetra_Vector> rebalancedBlockIds,
+                                                                                 Teuchos::RCP<const Epetra_Vector> rebalancedY,
+                                                                                 int step);
+
     //! Global (non-rebalanced) maps used by the Peridigm time integrator
     Teuchos::RCP<Epetra_BlockMap> oneDimensionalMap;
     Teuchos::RCP<Epetra_BlockMap> threeDimensionalMap;
@@ -213,12 +279,50 @@ namespace PeridigmNS {
     //! Contact search radius
     double contactSearchRadius;
 
+    //! Flag for restricting the contact search to exposed (surface and fractured) points
+    bool surfaceOnlySearch;
+
+    //! Fractional neighbor count deficit beyond which a point is considered exposed
+    double surfaceDetectionTolerance;
+
+    /*! \brief Flag for computing contact on the mechanical partitioning.
+     *
+     *  When set, the current-configuration partitioning is used only for the contact search and each contact pair is
+     *  evaluated by the processor that owns the point in the mechanical partitioning.  The contact data then stays
+     *  aligned with the mothership vectors and only the contact ghosts are communicated at each step.
+     */
+    bool ownerComputes;
+
+    //! Number of bonds of each point in the reference configuration, on the global (non-rebalanced) map
+    Teuchos::RCP<Epetra_Vector> originalNumNeighbors;
+
+    //! Fully-bonded interior neighbor count of the block containing each point, on the global (non-rebalanced) map
+    Teuchos::RCP<Epetra_Vector> referenceNumNeighbors;
+
+    //! Optional node-to-facet contact against the skin of the Exodus mesh
+    Teuchos::RCP<PeridigmNS::NodeToFacetContact> nodeToFacetContact;
+
+    //! Rigid contactors described by analytic or triangulated surfaces
+    std::vector< Teuchos::RCP<PeridigmNS::RigidContactor> > rigidContactors;
+
+    //! Global contact vector for the force density from node-to-facet and rigid contactor contact
+    Teuchos::RCP<Epetra_Vector> contactSurfaceForce;
+
     //! Contact models
     std::map< std::string, Teuchos::RCP<const PeridigmNS::ContactModel> > contactModels;
 
     //! List of contact interactions; each entry has the form (block_id, block_id, contact_model_name)
     std::vector< boost::tuple<int, int, std::string> > contactInteractions;
 
+    //! Interaction parameters for each interacting block pair, keyed by (smaller block_id, larger block_id)
+    std::map< std::pair<int, int>, Teuchos::ParameterList > pairInteractionParams;
+
+    //! Contact search radius for each interacting block pair
+    std::map< std::pair<int, int>, double > pairSearchRadius;
+
+    //! Contact search frequency for each interacting block pair
+    std::map< std::pair<int, int>, int > pairSearchFrequency;
+
     //! Contact blocks
     Teuchos::RCP< std::vector<PeridigmNS::ContactBlock> > contactBlocks;
 
@@ -231,6 +335,9 @@ namespace PeridigmNS {
     //! Global contact vector for volume
     Teuchos::RCP<Epetra_Vector> contactVolume;
 
+    //! Global contact vector for the intact bond count relative to the fully-bonded interior count
+    Teuchos::RCP<Epetra_Vector> contactIntactBondFraction;
+
     //! Global contact vector for current position
     Teuchos::RCP<Epetra_Vector> contactY;
 
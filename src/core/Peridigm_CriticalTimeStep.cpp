@@ -126,3 +126,60 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
 
   return globalMinCriticalTimeStep;
 }
+
+void PeridigmNS::ComputeBondStiffnessSum(PeridigmNS::Block& block, Epetra_Vector& bondStiffnessSum){
+
+  Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
+  const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+  const int* ownedIDs = neighborhoodData->OwnedIDs();
+  const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+  Teuchos::RCP<const PeridigmNS::Material> materialModel = block.getMaterialModel();
+  Teuchos::RCP<const Epetra_BlockMap> overlapScalarPointMap = block.getOverlapScalarPointMap();
+
+  double bulkModulus = materialModel()->BulkModulus();
+
+  double horizon(0.0);
+  string blockName = block.getName();
+  PeridigmNS::HorizonManager& horizonManager = PeridigmNS::HorizonManager::self();
+  bool blockHasConstantHorizon = horizonManager.blockHasConstantHorizon(blockName);
+  if(blockHasConstantHorizon)
+    horizon = horizonManager.getBlockConstantHorizonValue(blockName);
+
+  double *cellVolume, *x;
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  block.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE)->ExtractView(&x);
+
+  // Same micromodulus as used for the critical time step estimate
+  const double pi = boost::math::constants::pi<double>();
+  double springConstant(0.0);
+  if(blockHasConstantHorizon)
+    springConstant = 18.0*bulkModulus/(pi*horizon*horizon*horizon*horizon);
+
+  int neighborhoodListIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+
+    int nodeID = ownedIDs[iID];
+    double X[3] = { x[nodeID*3], x[nodeID*3+1], x[nodeID*3+2] };
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+
+    if(!blockHasConstantHorizon){
+      double delta = horizonManager.evaluateHorizon(blockName, X[0], X[1], X[2]);
+      springConstant = 18.0*bulkModulus/(pi*delta*delta*delta*delta);
+    }
+
+    double stiffnessSum = 0.0;
+    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+      int neighborID = neighborhoodList[neighborhoodListIndex++];
+      double initialDistance = sqrt( (X[0] - x[neighborID*3  ])*(X[0] - x[neighborID*3  ]) +
+                                     (X[1] - x[neighborID*3+1])*(X[1] - x[neighborID*3+1]) +
+                                     (X[2] - x[neighborID*3+2])*(X[2] - x[neighborID*3+2]) );
+      if(initialDistance > 1.0e-50)
+        stiffnessSum += cellVolume[neighborID]*springConstant/initialDistance;
+    }
+
+    int localID = bondStiffnessSum.Map().LID(overlapScalarPointMap->GID(nodeID));
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(localID == -1, "**** Error in ComputeBondStiffnessSum(), point not found in target vector map.\n");
+    bondStiffnessSum[localID] = stiffnessSum;
+  }
+}
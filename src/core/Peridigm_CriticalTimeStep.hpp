@@ -50,11 +50,15 @@
 
 #include "Peridigm_Block.hpp"
 #include <Epetra_Comm.h>
+#include <Epetra_Vector.h>
 
 namespace PeridigmNS {
 
 double ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block);
 
+//! Compute, for each point owned by the block, the sum of the bond stiffnesses (per unit volume) of its bonds, stored at the point's local ID in the given one-dimensional vector; this bounds the diagonal of the bond-based tangent only.
+void ComputeBondStiffnessSum(PeridigmNS::Block& block, Epetra_Vector& bondStiffnessSum);
+
 }
 
 #endif // PERIDIGM_CRITICALTIMESTEP_HPP
@@ -466,6 +466,16 @@ void PeridigmNS::DataManager::rebalance(Teuchos::RCP<const Epetra_BlockMap> reba
   overlapBondMap = rebalancedOverlapBondMap;
 }
 
+void PeridigmNS::DataManager::accumulateMemoryUsage(std::map<int, double>& bytesPerFieldId)
+{
+  if(!stateNONE.is_null())
+    stateNONE->accumulateMemoryUsage(bytesPerFieldId);
+  if(!stateN.is_null())
+    stateN->accumulateMemoryUsage(bytesPerFieldId);
+  if(!stateNP1.is_null())
+    stateNP1->accumulateMemoryUsage(bytesPerFieldId);
+}
+
 Teuchos::RCP<const Epetra_Comm> PeridigmNS::DataManager::getEpetraComm()
 {
   Teuchos::RCP<const Epetra_Comm> comm;
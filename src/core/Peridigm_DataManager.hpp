@@ -115,6 +115,9 @@ public:
                  Teuchos::RCP<const Epetra_BlockMap> rebalancedOwnedBondMap,
                  Teuchos::RCP<const Epetra_BlockMap> rebalancedOverlapBondMap);
 
+  //! Adds the number of bytes allocated in the State objects for each field id to the given map; global data is not included.
+  void accumulateMemoryUsage(std::map<int, double>& bytesPerFieldId);
+
   //! Returns the number of times rebalance has been called.
   int getRebalanceCount(){ return rebalanceCount; }
 
@@ -0,0 +1,120 @@
+/*! \file Peridigm_FiniteDifferenceJacobianOperator.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_FiniteDifferenceJacobianOperator.hpp"
+#include <Teuchos_Assert.hpp>
+#include <cmath>
+
+PeridigmNS::FiniteDifferenceJacobianOperator::FiniteDifferenceJacobianOperator(const Epetra_Map& map_,
+                                                                               const Epetra_BlockMap& stateMap,
+                                                                               Teuchos::RCP<const Epetra_Vector> freeDoFMask_,
+                                                                               double lambda_,
+                                                                               ResidualFunction residualFunction_,
+                                                                               const std::string& label_)
+  : map(map_), freeDoFMask(freeDoFMask_), lambda(lambda_), residualFunction(residualFunction_), label(label_),
+    numResidualEvaluations(0)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(lambda <= 0.0, "**** Error:  FiniteDifferenceJacobianOperator, the perturbation parameter must be positive.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(stateMap.NumMyPoints() != map.NumMyPoints(),
+                              "**** Error:  FiniteDifferenceJacobianOperator, the state map and the operator map have different local lengths.\n");
+  perturbedState = Teuchos::rcp(new Epetra_Vector(stateMap));
+  perturbedResidual = Teuchos::rcp(new Epetra_Vector(map));
+}
+
+void PeridigmNS::FiniteDifferenceJacobianOperator::setBasePoint(Teuchos::RCP<const Epetra_Vector> baseState_,
+                                                                Teuchos::RCP<const Epetra_Vector> baseResidual_)
+{
+  baseState = baseState_;
+  baseResidual = baseResidual_;
+}
+
+int PeridigmNS::FiniteDifferenceJacobianOperator::Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(baseState.is_null(), "**** Error:  FiniteDifferenceJacobianOperator::Apply() called before setBasePoint().\n");
+
+  const int length = X.MyLength();
+  const double* mask = freeDoFMask->Values();
+
+  double baseStateNorm;
+  baseState->Norm2(&baseStateNorm);
+
+  for(int col=0 ; col<X.NumVectors() ; ++col){
+
+    const double* x = X[col];
+    double* y = Y[col];
+
+    // Only the unconstrained entries of the direction perturb the residual
+    double localDirectionNormSquared(0.0), directionNormSquared(0.0);
+    for(int i=0 ; i<length ; ++i)
+      localDirectionNormSquared += mask[i]*x[i]*x[i];
+    map.Comm().SumAll(&localDirectionNormSquared, &directionNormSquared, 1);
+
+    if(directionNormSquared == 0.0){
+      for(int i=0 ; i<length ; ++i)
+        y[i] = (1.0 - mask[i])*x[i];
+      continue;
+    }
+
+    // Perturbation scaled with the size of the solution, as in NOX::Epetra::MatrixFree
+    double eta = lambda*(lambda + baseStateNorm/sqrt(directionNormSquared));
+
+    const double* s0 = baseState->Values();
+    double* s = perturbedState->Values();
+    for(int i=0 ; i<length ; ++i)
+      s[i] = s0[i] + eta*mask[i]*x[i];
+
+    residualFunction(perturbedState, perturbedResidual);
+    numResidualEvaluations++;
+
+    const double* r = perturbedResidual->Values();
+    const double* r0 = baseResidual->Values();
+    for(int i=0 ; i<length ; ++i)
+      y[i] = mask[i]*(r[i] - r0[i])/eta + (1.0 - mask[i])*x[i];
+  }
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+/*! \file Peridigm_FiniteDifferenceJacobianOperator.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_FINITEDIFFERENCEJACOBIANOPERATOR_HPP
+#define PERIDIGM_FINITEDIFFERENCEJACOBIANOPERATOR_HPP
+
+#include <string>
+#include <functional>
+#include <Teuchos_RCP.hpp>
+#include <Epetra_Operator.h>
+#include <Epetra_BlockMap.h>
+#include <Epetra_Map.h>
+#include <Epetra_Vector.h>
+#include <Epetra_MultiVector.h>
+
+namespace PeridigmNS {
+
+/*! \brief Jacobian-free operator for a nonlinear residual R(s).
+ *
+ *  Apply() approximates the product of the Jacobian of the residual with a vector by a forward-difference
+ *  directional derivative, J*x = (R(s + eta*x) - R(s))/eta, so the Jacobian does not have to be stored.  Rows and
+ *  columns corresponding to constrained degrees of freedom are replaced by the identity, consistent with an assembled
+ *  tangent.  The residual is supplied as a callback, which is used for both the implicit mechanical and the implicit
+ *  thermal solves.  The base point (state and residual) must be set before each linear solve.
+ */
+class FiniteDifferenceJacobianOperator : public Epetra_Operator {
+
+public:
+
+  //! Evaluates the residual for a given state; the residual is stored on the operator map.
+  typedef std::function<void(Teuchos::RCP<const Epetra_Vector> state, Teuchos::RCP<Epetra_Vector> residual)> ResidualFunction;
+
+  /*! \brief Constructor.
+   *
+   *  The state is stored on stateMap, which must have the same local layout as the point map of the operator.
+   *  freeDoFMask is one for unconstrained degrees of freedom and zero for constrained degrees of freedom.
+   */
+  FiniteDifferenceJacobianOperator(const Epetra_Map& map,
+                                   const Epetra_BlockMap& stateMap,
+                                   Teuchos::RCP<const Epetra_Vector> freeDoFMask,
+                                   double lambda,
+                                   ResidualFunction residualFunction,
+                                   const std::string& label);
+
+  //! Destructor.
+  virtual ~FiniteDifferenceJacobianOperator(){}
+
+  //! Set the point about which the residual is linearized.
+  void setBasePoint(Teuchos::RCP<const Epetra_Vector> baseState,
+                    Teuchos::RCP<const Epetra_Vector> baseResidual);
+
+  //! Number of residual evaluations performed by Apply() since construction.
+  int getNumResidualEvaluations() const { return numResidualEvaluations; }
+
+  //! Apply the finite-difference Jacobian to X.
+  virtual int Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const;
+
+  //! Not supported.
+  virtual int ApplyInverse(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const { return -1; }
+
+  //! Not supported.
+  virtual int SetUseTranspose(bool useTranspose) { return -1; }
+
+  virtual double NormInf() const { return 0.0; }
+
+  virtual const char* Label() const { return label.c_str(); }
+
+  virtual bool UseTranspose() const { return false; }
+
+  virtual bool HasNormInf() const { return false; }
+
+  virtual const Epetra_Comm& Comm() const { return map.Comm(); }
+
+  virtual const Epetra_Map& OperatorDomainMap() const { return map; }
+
+  virtual const Epetra_Map& OperatorRangeMap() const { return map; }
+
+private:
+
+  //! Private to prohibit copying
+  FiniteDifferenceJacobianOperator(const FiniteDifferenceJacobianOperator&);
+
+  //! Private to prohibit copying
+  FiniteDifferenceJacobianOperator& operator=(const FiniteDifferenceJacobianOperator&);
+
+  Epetra_Map map;
+  Teuchos::RCP<const Epetra_Vector> freeDoFMask;
+  double lambda;
+  ResidualFunction residualFunction;
+  std::string label;
+
+  Teuchos::RCP<const Epetra_Vector> baseState;
+  Teuchos::RCP<const Epetra_Vector> baseResidual;
+
+  //! Work vectors for the perturbed state and residual
+  Teuchos::RCP<Epetra_Vector> perturbedState;
+  Teuchos::RCP<Epetra_Vector> perturbedResidual;
+
+  mutable int numResidualEvaluations;
+};
+
+}
+
+#endif // PERIDIGM_FINITEDIFFERENCEJACOBIANOPERATOR_HPP
@@ -119,7 +119,10 @@ PeridigmNS::InterfaceData::Initialize(std::vector<int> leftElements, std::vector
 }
 
 void
-PeridigmNS::InterfaceData::InitializeExodusOutput(Teuchos::RCP<Epetra_Vector> exodusMeshElementConnectivity, Teuchos::RCP<Epetra_Vector> exodusMeshNodePositions){
+PeridigmNS::InterfaceData::InitializeExodusOutput(Teuchos::RCP<Epetra_Vector> exodusMeshElementConnectivity, Teuchos::RCP<Epetra_Vector> exodusMeshNodePositions, int bufferSteps){
+
+  TEUCHOS_TEST_FOR_EXCEPTION(bufferSteps < 1,std::invalid_argument,"the number of buffered interface output steps must be at least one");
+  outputBufferSteps = bufferSteps;
 
   if(comm->NumProc()>1){
     filename << "Interfaces.e." << comm->NumProc() << "." << comm->MyPID();
@@ -144,9 +147,20 @@ PeridigmNS::InterfaceData::InitializeExodusOutput(Teuchos::RCP<Epetra_Vector> ex
   // scan the connectivity to see if there are quads and tets:
   numQuads = 0;
   numTris = 0;
+  quadIDs.clear();
+  triIDs.clear();
   for(int i=0;i<numOwnedPoints;++i){
-    if(interfaceNodesMap->ElementSize(i)==4) numQuads++;
-    if(interfaceNodesMap->ElementSize(i)==3) numTris++;
+    if(interfaceNodesMap->ElementSize(i)==4){
+      numQuads++;
+      quadIDs.push_back(i);
+    }
+    else if(interfaceNodesMap->ElementSize(i)==3){
+      numTris++;
+      triIDs.push_back(i);
+    }
+    else{
+      TEUCHOS_TEST_FOR_EXCEPTION(true,std::invalid_argument,"size of this element is not recognized: " << interfaceNodesMap->ElementSize(i));
+    }
   }
   TEUCHOS_TEST_FOR_EXCEPTION(numQuads+numTris!=numShells,std::logic_error,"numQuads " << numQuads << "  + numTris " << numTris << " should sum up to numShells " << numShells);
 
@@ -263,74 +277,42 @@ PeridigmNS::InterfaceData::InitializeExodusOutput(Teuchos::RCP<Epetra_Vector> ex
   error_int = ex_put_elem_var_tab (exoid, numBlocks, numVariables, truth_tab);
   delete [] truth_tab;
 
+  // The file is kept open for the output steps; it is closed by FinalizeExodusOutput()
   error_int = ex_update(exoid);
-  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Exodus file close failed.");
-  error_int = ex_close(exoid);
-  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Exodus file close failed.");
+  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"ex_update(): Failure");
+  exodusFileOpen = true;
 
+  bufferedTimeSteps.reserve(outputBufferSteps);
+  bufferedTimeValues.reserve(outputBufferSteps);
+  bufferedQuadValues.reserve(outputBufferSteps*numQuads);
+  bufferedTriValues.reserve(outputBufferSteps*numTris);
 }
 
 void
 PeridigmNS::InterfaceData::WriteExodusOutput(int timeStep, const float & timeValue, Teuchos::RCP<Epetra_Vector> x, Teuchos::RCP<Epetra_Vector> y){
 
-  int error_int = 0;
-
-  int CPU_word_size = 0;
-  int IO_word_size = 0;
-  float version = 0;
-  std::string outputFileNameStr = filename.str();
-  std::vector<char> writable(outputFileNameStr.size() + 1);
-  std::copy(outputFileNameStr.begin(), outputFileNameStr.end(), writable.begin());
-
-  exoid = ex_open(&writable[0], EX_WRITE, &CPU_word_size, &IO_word_size, &version);
-
-  error_int = ex_put_time(exoid, timeStep, &timeValue);
-  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error, "ex_put_time(): Failure");
-
-  float * quadValues = new float[numQuads];
-  float * triValues = new float[numTris];
-
-  // populate the quad values
-  int quadIndex = 0;
-  int triIndex = 0;
-  for(int i=0;i<numOwnedPoints;++i){
-    if(interfaceNodesMap->ElementSize(i)==4){
-      quadValues[quadIndex] = (*interfaceAperture)[i];
-      quadIndex++;
-    }
-    else if(interfaceNodesMap->ElementSize(i)==3){
-      triValues[triIndex] = (*interfaceAperture)[i];
-      triIndex++;
-    }
-    else{
-      TEUCHOS_TEST_FOR_EXCEPTION(true,std::invalid_argument,"size of this element is not recognized: " << interfaceNodesMap->ElementSize(i));
-    }
-  }
+  TEUCHOS_TEST_FOR_EXCEPTION(!exodusFileOpen,std::logic_error,"WriteExodusOutput() called before InitializeExodusOutput()");
 
-  int blockIndex = 0;
-  const int varIndex = 1;
-  blockIndex++;
-  if(numQuads > 0){
-    error_int = ex_put_elem_var(exoid, timeStep, varIndex, blockIndex, numQuads, &quadValues[0]);
-    TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Failure ex_put_elem_var(): ");
-  }
-  blockIndex++;
-  if(numTris > 0){
-    error_int = ex_put_elem_var(exoid, timeStep, varIndex, blockIndex, numTris, &triValues[0]);
-    TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Failure ex_put_elem_var(): ");
-  }
+  // buffer the values for this step
+  bufferedTimeSteps.push_back(timeStep);
+  bufferedTimeValues.push_back(timeValue);
+  for(unsigned int i=0;i<quadIDs.size();++i)
+    bufferedQuadValues.push_back( (*interfaceAperture)[quadIDs[i]] );
+  for(unsigned int i=0;i<triIDs.size();++i)
+    bufferedTriValues.push_back( (*interfaceAperture)[triIDs[i]] );
 
-  delete [] quadValues;
-  delete [] triValues;
+  if(static_cast<int>(bufferedTimeSteps.size()) >= outputBufferSteps)
+    FlushExodusOutput();
 
   // update the apertures...
   // import the mothership vectors x and y to the overlap epetra vectors
-  Teuchos::RCP<const Epetra_Import> importer = Teuchos::rcp(new Epetra_Import(*elemOverlapMap, x->Map()));
-
-  Teuchos::RCP<Epetra_Vector> xOverlap = Teuchos::rcp(new Epetra_Vector(*elemOverlapMap,true));
-  xOverlap->Import(*x,*importer,Insert);
-  Teuchos::RCP<Epetra_Vector> yOverlap = Teuchos::rcp(new Epetra_Vector(*elemOverlapMap,true));
-  yOverlap->Import(*y,*importer,Insert);
+  if(elemOverlapImporter.is_null() || !elemOverlapImporter->SourceMap().SameAs(x->Map())){
+    elemOverlapImporter = Teuchos::rcp(new Epetra_Import(*elemOverlapMap, x->Map()));
+    xOverlap = Teuchos::rcp(new Epetra_Vector(*elemOverlapMap,true));
+    yOverlap = Teuchos::rcp(new Epetra_Vector(*elemOverlapMap,true));
+  }
+  xOverlap->Import(*x,*elemOverlapImporter,Insert);
+  yOverlap->Import(*y,*elemOverlapImporter,Insert);
 
   double *xValues;
   xOverlap->ExtractView( &xValues );
@@ -377,9 +359,48 @@ PeridigmNS::InterfaceData::WriteExodusOutput(int timeStep, const float & timeVal
 
     interfaceAperture->ReplaceMyValue(i,0,Y-X);
   }
+}
+
+void
+PeridigmNS::InterfaceData::FlushExodusOutput(){
+
+  if(!exodusFileOpen || bufferedTimeSteps.empty())
+    return;
+
+  int error_int = 0;
+  const int varIndex = 1;
+  for(unsigned int step=0;step<bufferedTimeSteps.size();++step){
+    error_int = ex_put_time(exoid, bufferedTimeSteps[step], &bufferedTimeValues[step]);
+    TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error, "ex_put_time(): Failure");
+    int blockIndex = 0;
+    blockIndex++;
+    if(numQuads > 0){
+      error_int = ex_put_elem_var(exoid, bufferedTimeSteps[step], varIndex, blockIndex, numQuads, &bufferedQuadValues[step*numQuads]);
+      TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Failure ex_put_elem_var(): ");
+    }
+    blockIndex++;
+    if(numTris > 0){
+      error_int = ex_put_elem_var(exoid, bufferedTimeSteps[step], varIndex, blockIndex, numTris, &bufferedTriValues[step*numTris]);
+      TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Failure ex_put_elem_var(): ");
+    }
+  }
   error_int = ex_update(exoid);
-  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Exodus file close failed.");
-  error_int = ex_close(exoid);
-  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Exodus file close failed.");
+  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"ex_update(): Failure");
 
+  bufferedTimeSteps.clear();
+  bufferedTimeValues.clear();
+  bufferedQuadValues.clear();
+  bufferedTriValues.clear();
+}
+
+void
+PeridigmNS::InterfaceData::FinalizeExodusOutput(){
+
+  if(!exodusFileOpen)
+    return;
+
+  FlushExodusOutput();
+  exodusFileOpen = false;
+  int error_int = ex_close(exoid);
+  TEUCHOS_TEST_FOR_EXCEPTION(error_int,std::logic_error,"Exodus file close failed.");
 }
@@ -53,6 +53,7 @@
 #include <Epetra_Comm.h>
 #include <Epetra_Vector.h>
 #include <Epetra_BlockMap.h>
+#include <Epetra_Import.h>
 
 namespace PeridigmNS {
 
@@ -60,9 +61,15 @@ class InterfaceData {
 
 public:
 
-  InterfaceData(): numOwnedPoints(0), ownedIDs(0), elementLeft(0), elementRight(0), numNodes(0), exoid(0), numQuads(0), numTris(0){}
+  InterfaceData(): numOwnedPoints(0), ownedIDs(0), elementLeft(0), elementRight(0), numNodes(0), exoid(0), numQuads(0), numTris(0),
+    exodusFileOpen(false), outputBufferSteps(1){}
 
   ~InterfaceData(){
+    // Write any buffered output steps; errors cannot be reported from the destructor
+    try{
+      FinalizeExodusOutput();
+    }
+    catch(...){}
     if(ownedIDs != 0)
       delete[] ownedIDs;
     if(elementLeft != 0)
@@ -76,10 +83,18 @@ public:
   void Initialize(std::vector<int> leftElements, std::vector<int> rightElements, std::vector<int> numNodesPerElem,
     std::vector<std::vector<int> > interfaceNodesVec, const Teuchos::RCP<const Epetra_Comm> & Comm);
 
-  void InitializeExodusOutput(Teuchos::RCP<Epetra_Vector> exodusMeshElementConnectivity, Teuchos::RCP<Epetra_Vector> exodusMeshNodePositions);
+  //! Create the interface Exodus file; the file is kept open and up to bufferSteps output steps are held in memory between writes to disk.
+  void InitializeExodusOutput(Teuchos::RCP<Epetra_Vector> exodusMeshElementConnectivity, Teuchos::RCP<Epetra_Vector> exodusMeshNodePositions, int bufferSteps = 1);
 
+  //! Buffer the interface data for an output step, and write the buffered steps to disk when the buffer is full.
   void WriteExodusOutput(int timeStep, const float & timeValue, Teuchos::RCP<Epetra_Vector> x, Teuchos::RCP<Epetra_Vector> y);
 
+  //! Write the buffered output steps to disk.
+  void FlushExodusOutput();
+
+  //! Write the buffered output steps to disk and close the interface Exodus file.
+  void FinalizeExodusOutput();
+
   int NumOwnedPoints() const{
   return numOwnedPoints;
   }
@@ -117,6 +132,23 @@ protected:
   Teuchos::RCP<Epetra_Vector> interfaceAperture;
   Teuchos::RCP<Epetra_Vector> interfaceNodes;
 
+  //! True while the interface Exodus file is open
+  bool exodusFileOpen;
+  //! Number of output steps buffered in memory before they are written to disk
+  int outputBufferSteps;
+  //! Local IDs of the quad and tri interfaces, in the order they are written to the Exodus element blocks
+  std::vector<int> quadIDs;
+  std::vector<int> triIDs;
+  //! Buffered output steps
+  std::vector<int> bufferedTimeSteps;
+  std::vector<float> bufferedTimeValues;
+  std::vector<float> bufferedQuadValues;
+  std::vector<float> bufferedTriValues;
+  //! Importer and overlap vectors for the positions of the elements adjacent to the interfaces
+  Teuchos::RCP<const Epetra_Import> elemOverlapImporter;
+  Teuchos::RCP<Epetra_Vector> xOverlap;
+  Teuchos::RCP<Epetra_Vector> yOverlap;
+
 };
 
 }
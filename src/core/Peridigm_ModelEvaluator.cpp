@@ -62,10 +62,53 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
   const double dt = workset->timeStep;
   std::vector<PeridigmNS::Block>::iterator blockIt;
 
-  // ---- Evaluate Damage ---
+  // ---- Evaluate Damage and Internal Force at interior points ----
+
+  // If a block has a split-phase import in progress (see BlockBase::startImports()), the points that
+  // have no ghosted neighbors are evaluated while the halo exchange completes.  Blocks whose material
+  // or damage model does not support a split evaluation evaluate all points after the exchange.
 
+  std::vector<bool> splitEvaluation;
   for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
 
+    Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
+    splitEvaluation.push_back(blockIt->importsPending() &&
+                              blockIt->getMaterialModel()->supportsSplitEvaluation() &&
+                              (damageModel.is_null() || damageModel->supportsSplitEvaluation()));
+    if(!splitEvaluation.back())
+      continue;
+
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
+    const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
+    const int* ownedIDs = neighborhoodData->OwnedIDs();
+    const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+    const int* isBoundaryPoint = numOwnedPoints > 0 ? &blockIt->getBoundaryPointFlags()[0] : 0;
+    Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+
+    if(!damageModel.is_null())
+      damageModel->computeInteriorDamage(dt,
+                                         numOwnedPoints,
+                                         ownedIDs,
+                                         neighborhoodList,
+                                         isBoundaryPoint,
+                                         *dataManager);
+
+    blockIt->getMaterialModel()->computeInteriorForce(dt,
+                                                      numOwnedPoints,
+                                                      ownedIDs,
+                                                      neighborhoodList,
+                                                      isBoundaryPoint,
+                                                      *dataManager);
+  }
+
+  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++)
+    blockIt->completeImports();
+
+  // ---- Evaluate Damage ---
+
+  int blockIndex = 0;
+  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
+
     Teuchos::RCP<const PeridigmNS::DamageModel> damageModel = blockIt->getDamageModel();
     if(!damageModel.is_null()){
       Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
@@ -73,17 +116,26 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
       const int* ownedIDs = neighborhoodData->OwnedIDs();
       const int* neighborhoodList = neighborhoodData->NeighborhoodList();
       Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
-      damageModel->computeDamage(dt,
-                                 numOwnedPoints,
-                                 ownedIDs,
-                                 neighborhoodList,
-                                 *dataManager);
+      if(splitEvaluation[blockIndex])
+        damageModel->computeBoundaryDamage(dt,
+                                           numOwnedPoints,
+                                           ownedIDs,
+                                           neighborhoodList,
+                                           numOwnedPoints > 0 ? &blockIt->getBoundaryPointFlags()[0] : 0,
+                                           *dataManager);
+      else
+        damageModel->computeDamage(dt,
+                                   numOwnedPoints,
+                                   ownedIDs,
+                                   neighborhoodList,
+                                   *dataManager);
     }
   }
 
   // ---- Evaluate Internal Force ----
 
-  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
+  blockIndex = 0;
+  for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++, blockIndex++){
 
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = blockIt->getNeighborhoodData();
     const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
@@ -92,11 +144,19 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
 
-    materialModel->computeForce(dt,
-                                numOwnedPoints,
-                                ownedIDs,
-                                neighborhoodList,
-                                *dataManager);
+    if(splitEvaluation[blockIndex])
+      materialModel->computeBoundaryForce(dt,
+                                          numOwnedPoints,
+                                          ownedIDs,
+                                          neighborhoodList,
+                                          numOwnedPoints > 0 ? &blockIt->getBoundaryPointFlags()[0] : 0,
+                                          *dataManager);
+    else
+      materialModel->computeForce(dt,
+                                  numOwnedPoints,
+                                  ownedIDs,
+                                  neighborhoodList,
+                                  *dataManager);
   }
 
   // ---- Evaluate Contact ----
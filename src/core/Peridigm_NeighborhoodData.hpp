@@ -185,12 +185,26 @@ public:
   }
 
   double memorySize() const{
-    int sizeInBytes =
-      (numOwnedPoints + 2*neighborhoodListSize + overlapNeighborhoodListSize + 2 )*sizeof(int) + 4*sizeof(int*);
-    double sizeInMegabytes = sizeInBytes/1048576.0;
+    double sizeInMegabytes = memorySizeInBytes()/1048576.0;
     return sizeInMegabytes;
   }
 
+  //! Number of bytes owned by the neighborhood arrays (arrays that have been released are not counted).
+  double memorySizeInBytes() const{
+    double sizeInBytes = 2.0*sizeof(int) + 5.0*sizeof(int*);
+    if(ownedIDs != 0)
+      sizeInBytes += (double)numOwnedPoints*sizeof(int);
+    if(neighborhoodPtr != 0)
+      sizeInBytes += (double)numOwnedPoints*sizeof(int);
+    if(neighborhoodList != 0)
+      sizeInBytes += (double)neighborhoodListSize*sizeof(int);
+    if(overlapNeighborhoodList != 0)
+      sizeInBytes += (double)overlapNeighborhoodListSize*sizeof(int);
+    if(specularBondPositions != 0)
+      sizeInBytes += (double)(neighborhoodListSize-numOwnedPoints)*sizeof(int);
+    return sizeInBytes;
+  }
+
 protected:
   int numOwnedPoints = 0;
   int numOverlapPoints;
@@ -46,6 +46,7 @@
 //@HEADER
 
 #include <vector>
+#include <algorithm>
 
 #include <Epetra_Import.h>
 #include <Epetra_SerialDenseMatrix.h>
@@ -57,7 +58,7 @@
 using namespace std;
 
 PeridigmNS::SerialMatrix::SerialMatrix(Teuchos::RCP<Epetra_FECrsMatrix> epetraFECrsMatrix)
-  : FECrsMatrix(epetraFECrsMatrix)
+  : FECrsMatrix(epetraFECrsMatrix), blockSize(0), reportFallback(false)
 {
 }
 
@@ -79,7 +80,201 @@ void PeridigmNS::SerialMatrix::addValue(int globalRow, int globalCol, double val
   delete[] data;
 }
 
+bool PeridigmNS::SerialMatrix::enableBlockAssembly(int blockSize_, const std::map< int, std::vector<int> >& offProcessorGraph, bool verbose)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!FECrsMatrix->Filled(), "**** PeridigmNS::SerialMatrix::enableBlockAssembly(), matrix must be filled.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(blockSize_ < 1, "**** PeridigmNS::SerialMatrix::enableBlockAssembly(), invalid block size.\n");
+
+  // The degrees of freedom of each node must be numbered consecutively in the column map,
+  // so that a node block occupies blockSize consecutive entries in the (sorted) local column list of each row
+  const Epetra_Map& colMap = FECrsMatrix->ColMap();
+  int numCols = colMap.NumMyElements();
+  for(int i=0 ; i<numCols ; ++i){
+    int globalCol = colMap.GID(i);
+    if(globalCol%blockSize_ == 0){
+      for(int d=1 ; d<blockSize_ ; ++d){
+        if(i+d >= numCols || colMap.GID(i+d) != globalCol+d){
+          blockSize = 0;
+          if(verbose)
+            cout << "PeridigmNS::SerialMatrix, processor " << FECrsMatrix->Comm().MyPID()
+                 << ": node degrees of freedom are not consecutive in the column map, assembling the tangent row by row." << endl;
+          return false;
+        }
+      }
+    }
+  }
+
+  // The rows of each node must be numbered consecutively, and each row must hold complete node blocks of columns,
+  // so that the column pattern can be recorded once per node with one entry per neighbor node
+  const Epetra_Map& rowMap = FECrsMatrix->RowMap();
+  int numRows = rowMap.NumMyElements();
+  bool validPattern = (numRows%blockSize_ == 0);
+  for(int i=0 ; i<numRows && validPattern ; ++i){
+    int firstRowOfNode = rowMap.GID(i - i%blockSize_);
+    validPattern = (firstRowOfNode%blockSize_ == 0 && rowMap.GID(i) == firstRowOfNode + i%blockSize_);
+  }
+  rowNodeColumnPtr.assign(1, 0);
+  rowNodeColumns.clear();
+  for(int iNode=0 ; iNode<numRows/blockSize_ && validPattern ; ++iNode){
+    int numEntries;
+    double* rowValues;
+    int* rowIndices;
+    int err = FECrsMatrix->ExtractMyRowView(iNode*blockSize_, numEntries, rowValues, rowIndices);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::enableBlockAssembly(), ExtractMyRowView() returned nonzero error code.\n");
+    validPattern = (numEntries%blockSize_ == 0);
+    for(int k=0 ; k<numEntries && validPattern ; k+=blockSize_){
+      for(int d=1 ; d<blockSize_ && validPattern ; ++d)
+        validPattern = (rowIndices[k+d] == rowIndices[k] + d);
+      rowNodeColumns.push_back(rowIndices[k]);
+    }
+    for(int d=1 ; d<blockSize_ && validPattern ; ++d){
+      int otherNumEntries;
+      double* otherRowValues;
+      int* otherRowIndices;
+      err = FECrsMatrix->ExtractMyRowView(iNode*blockSize_ + d, otherNumEntries, otherRowValues, otherRowIndices);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::enableBlockAssembly(), ExtractMyRowView() returned nonzero error code.\n");
+      validPattern = (otherNumEntries == numEntries && std::equal(rowIndices, rowIndices + numEntries, otherRowIndices));
+    }
+    rowNodeColumnPtr.push_back(static_cast<int>(rowNodeColumns.size()));
+  }
+  if(!validPattern){
+    blockSize = 0;
+    rowNodeColumnPtr.clear();
+    rowNodeColumns.clear();
+    if(verbose)
+      cout << "PeridigmNS::SerialMatrix, processor " << FECrsMatrix->Comm().MyPID()
+           << ": node rows do not share a column pattern, assembling the tangent row by row." << endl;
+    return false;
+  }
+
+  blockSize = blockSize_;
+  reportFallback = verbose;
+
+  offProcessorRowIndex.clear();
+  offProcessorRowPtr.assign(1, 0);
+  offProcessorColumns.clear();
+  for(std::map< int, std::vector<int> >::const_iterator it=offProcessorGraph.begin() ; it!=offProcessorGraph.end() ; ++it){
+    offProcessorRowIndex[it->first] = static_cast<int>(offProcessorRowPtr.size()) - 1;
+    offProcessorColumns.insert(offProcessorColumns.end(), it->second.begin(), it->second.end());
+    std::sort(offProcessorColumns.end() - it->second.size(), offProcessorColumns.end());
+    offProcessorRowPtr.push_back(static_cast<int>(offProcessorColumns.size()));
+  }
+  offProcessorValues.assign(offProcessorColumns.size(), 0.0);
+
+  return true;
+}
+
+int PeridigmNS::SerialMatrix::globalAssemble()
+{
+  // Pass each buffered off-processor row to the Epetra_FECrsMatrix once, then clear the buffer
+  for(std::map<int, int>::const_iterator it=offProcessorRowIndex.begin() ; it!=offProcessorRowIndex.end() ; ++it){
+    int begin = offProcessorRowPtr[it->second];
+    int numEntries = offProcessorRowPtr[it->second + 1] - begin;
+    int err = FECrsMatrix->SumIntoGlobalValues(it->first, numEntries, &offProcessorValues[begin], &offProcessorColumns[begin]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::globalAssemble(), SumIntoGlobalValues() returned nonzero error code.\n");
+  }
+  std::fill(offProcessorValues.begin(), offProcessorValues.end(), 0.0);
+
+  return FECrsMatrix->GlobalAssemble();
+}
+
 void PeridigmNS::SerialMatrix::addValues(int numIndices, const int* globalIndices, const double *const * values)
+{
+  if(blockSize == 0 || numIndices%blockSize != 0){
+    reportRowByRowFallback();
+    addValuesByRow(numIndices, globalIndices, values);
+    return;
+  }
+
+  // Local row and column index of the first degree of freedom of each node
+  int numBlocks = numIndices/blockSize;
+  if(static_cast<int>(blockLocalRows.size()) < numBlocks){
+    blockLocalRows.resize(numBlocks);
+    blockLocalCols.resize(numBlocks);
+    blockSlots.resize(numBlocks);
+  }
+  for(int iBlock=0 ; iBlock<numBlocks ; ++iBlock){
+    int globalIndex = globalIndices[iBlock*blockSize];
+    bool isNodeBlock = (globalIndex%blockSize == 0);
+    for(int d=1 ; d<blockSize && isNodeBlock ; ++d)
+      isNodeBlock = (globalIndices[iBlock*blockSize + d] == globalIndex + d);
+    if(!isNodeBlock){
+      reportRowByRowFallback();
+      addValuesByRow(numIndices, globalIndices, values);
+      return;
+    }
+    blockLocalRows[iBlock] = FECrsMatrix->LRID(globalIndex);
+    int localColIndex = FECrsMatrix->LCID(globalIndex);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(localColIndex == -1, "Error in PeridigmNS::SerialMatrix::addValues(), bad column index.");
+    blockLocalCols[iBlock] = localColIndex;
+  }
+
+  for(int iBlock=0 ; iBlock<numBlocks ; ++iBlock){
+
+    // Locally-owned rows, sum directly into the matrix storage
+    if(blockLocalRows[iBlock] != -1){
+      // All rows of a node share the same column pattern, so the slots are found once per node,
+      // in the node-level column list recorded by enableBlockAssembly()
+      int rowNode = blockLocalRows[iBlock]/blockSize;
+      const int* nodeColumns = &rowNodeColumns[0] + rowNodeColumnPtr[rowNode];
+      int numNodeColumns = rowNodeColumnPtr[rowNode + 1] - rowNodeColumnPtr[rowNode];
+      for(int jBlock=0 ; jBlock<numBlocks ; ++jBlock){
+        const int* nodeColumn = std::lower_bound(nodeColumns, nodeColumns + numNodeColumns, blockLocalCols[jBlock]);
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeColumn == nodeColumns + numNodeColumns || *nodeColumn != blockLocalCols[jBlock],
+                                    "**** PeridigmNS::SerialMatrix::addValues(), entry not found in matrix graph.\n");
+        blockSlots[jBlock] = static_cast<int>(nodeColumn - nodeColumns)*blockSize;
+      }
+      for(int d=0 ; d<blockSize ; ++d){
+        int numEntries;
+        double* rowValues;
+        int* rowIndices;
+        int err = FECrsMatrix->ExtractMyRowView(blockLocalRows[iBlock] + d, numEntries, rowValues, rowIndices);
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addValues(), ExtractMyRowView() returned nonzero error code.\n");
+        const double* rowData = values[iBlock*blockSize + d];
+        for(int jBlock=0 ; jBlock<numBlocks ; ++jBlock){
+          int slot = blockSlots[jBlock];
+          for(int e=0 ; e<blockSize ; ++e)
+            rowValues[slot + e] += rowData[jBlock*blockSize + e];
+        }
+      }
+    }
+    // Off-processor rows, sum into the buffer that is passed to the matrix in globalAssemble()
+    else{
+      int globalRow = globalIndices[iBlock*blockSize];
+      for(int d=0 ; d<blockSize ; ++d){
+        std::map<int, int>::const_iterator it = offProcessorRowIndex.find(globalRow + d);
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(it == offProcessorRowIndex.end(), "**** PeridigmNS::SerialMatrix::addValues(), off-processor row not found in matrix graph.\n");
+        int begin = offProcessorRowPtr[it->second];
+        int end = offProcessorRowPtr[it->second + 1];
+        const int* rowIndices = &offProcessorColumns[begin];
+        double* rowValues = &offProcessorValues[begin];
+        int numEntries = end - begin;
+        const double* rowData = values[iBlock*blockSize + d];
+        for(int jBlock=0 ; jBlock<numBlocks ; ++jBlock){
+          int globalCol = globalIndices[jBlock*blockSize];
+          if(d == 0)
+            blockSlots[jBlock] = static_cast<int>(std::lower_bound(rowIndices, rowIndices + numEntries, globalCol) - rowIndices);
+          int slot = blockSlots[jBlock];
+          TEUCHOS_TEST_FOR_EXCEPT_MSG(slot + blockSize > numEntries || rowIndices[slot] != globalCol,
+                                      "**** PeridigmNS::SerialMatrix::addValues(), entry not found in matrix graph.\n");
+          for(int e=0 ; e<blockSize ; ++e)
+            rowValues[slot + e] += rowData[jBlock*blockSize + e];
+        }
+      }
+    }
+  }
+}
+
+void PeridigmNS::SerialMatrix::reportRowByRowFallback()
+{
+  if(reportFallback){
+    cout << "PeridigmNS::SerialMatrix, processor " << FECrsMatrix->Comm().MyPID()
+         << ": addValues() received indices that are not complete node blocks, summing them into the tangent row by row." << endl;
+    reportFallback = false;
+  }
+}
+
+void PeridigmNS::SerialMatrix::addValuesByRow(int numIndices, const int* globalIndices, const double *const * values)
 {
   vector<int> localRowIndices(numIndices);
   vector<int> localColIndices(numIndices);
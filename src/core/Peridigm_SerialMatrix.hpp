@@ -84,6 +84,24 @@ public:
   //! Set all entries to given scalar
   void putScalar(double value);
 
+  /*! \brief Enable direct block assembly into the (filled) matrix.
+   *
+   *  Once enabled, addValues() sums the values directly into the matrix storage, rather than calling SumIntoMyValues()
+   *  row by row.  The column pattern of each locally-owned node row is recorded here with one entry per neighbor node,
+   *  and each blockSize x blockSize node block is located with a single search of that node-level list.  The slots are
+   *  not stored per (row, neighbor) pair, because the neighbor blocks passed to addValues() depend on the caller.
+   *  Block assembly is left disabled unless all degrees of freedom of a node share the same column pattern, as is the
+   *  case for the graph built in Peridigm::allocateJacobian().  Contributions to rows owned by other processors are buffered in a
+   *  local copy of the off-processor graph (global row id -> sorted global column ids) and are passed to the
+   *  Epetra_FECrsMatrix one row at a time by globalAssemble().  Returns true if block assembly was enabled.  If verbose is
+   *  set, a message is printed when the row-by-row fallback is taken, either here or for the first addValues() call whose
+   *  indices are not complete node blocks.
+   */
+  bool enableBlockAssembly(int blockSize, const std::map< int, std::vector<int> >& offProcessorGraph, bool verbose = false);
+
+  //! Sum buffered off-processor values into the matrix and call Epetra_FECrsMatrix::GlobalAssemble().
+  int globalAssemble();
+
   //! Return ref-count pointer to the FECrsMatrix
   Teuchos::RCP<const Epetra_FECrsMatrix> getFECrsMatrix() { return FECrsMatrix; }
 
@@ -91,10 +109,37 @@ protected:
 
   Teuchos::RCP<Epetra_FECrsMatrix> FECrsMatrix;
 
+  //! Number of degrees of freedom per node for direct block assembly, zero if block assembly is disabled
+  int blockSize;
+
+  //! Report the row-by-row fallback of addValues(), cleared once the message is printed
+  bool reportFallback;
+
+  //! Off-processor rows in compressed row format (global indices)
+  std::map<int, int> offProcessorRowIndex;
+  std::vector<int> offProcessorRowPtr;
+  std::vector<int> offProcessorColumns;
+  std::vector<double> offProcessorValues;
+
+  //! Column pattern of the locally-owned node rows, as the local column index of the first degree of freedom of each neighbor node
+  std::vector<int> rowNodeColumnPtr;
+  std::vector<int> rowNodeColumns;
+
+  //! Scratch space for direct block assembly
+  std::vector<int> blockLocalRows;
+  std::vector<int> blockLocalCols;
+  std::vector<int> blockSlots;
+
+  //! Sum values into the matrix one row at a time, used when block assembly is disabled.
+  void addValuesByRow(int numIndicies, const int* globalIndices, const double *const * values);
+
+  //! Print the row-by-row fallback message of addValues() once, if requested in enableBlockAssembly().
+  void reportRowByRowFallback();
+
 private:
 
   //! Private to prohibit use.
-  SerialMatrix() {}
+  SerialMatrix() : blockSize(0), reportFallback(false) {}
   SerialMatrix(const SerialMatrix& serialMatrix){}
 };
 
@@ -0,0 +1,91 @@
+/*! \file Peridigm_SkinFacetData.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_SKINFACETDATA_HPP
+#define PERIDIGM_SKINFACETDATA_HPP
+
+#include <vector>
+
+namespace PeridigmNS {
+
+/*! \brief Triangulated outer skin of a hex/tet mesh.
+ *
+ *  Each facet is a triangle on an element face that is not shared with any other element.  The vertices
+ *  are stored in the reference configuration and are wound so that the facet normal points out of the
+ *  element.  Facets move rigidly with the peridynamic point that owns them.
+ */
+class SkinFacetData {
+
+public:
+
+  SkinFacetData() {}
+
+  //! Append a facet owned by the given element.
+  void addFacet(int elementGlobalId, int blockId, const double* vertex1, const double* vertex2, const double* vertex3){
+    elementGlobalIds.push_back(elementGlobalId);
+    blockIds.push_back(blockId);
+    for(int i=0 ; i<3 ; ++i) vertexCoordinates.push_back(vertex1[i]);
+    for(int i=0 ; i<3 ; ++i) vertexCoordinates.push_back(vertex2[i]);
+    for(int i=0 ; i<3 ; ++i) vertexCoordinates.push_back(vertex3[i]);
+  }
+
+  //! Number of locally-owned facets.
+  int NumFacets() const { return static_cast<int>(elementGlobalIds.size()); }
+
+  //! Global ID of the element (peridynamic point) that owns each facet.
+  std::vector<int> elementGlobalIds;
+
+  //! Block ID of the element that owns each facet.
+  std::vector<int> blockIds;
+
+  //! Reference coordinates of the three vertices of each facet, nine values per facet.
+  std::vector<double> vertexCoordinates;
+};
+
+}
+
+#endif // PERIDIGM_SKINFACETDATA_HPP
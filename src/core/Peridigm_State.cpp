@@ -129,6 +129,12 @@ Teuchos::RCP<Epetra_Vector> PeridigmNS::State::getData(int fieldId)
   return fieldIdToDataVector[fieldId];
 }
 
+void PeridigmNS::State::accumulateMemoryUsage(std::map<int, double>& bytesPerFieldId)
+{
+  for(std::map< int, Teuchos::RCP<Epetra_Vector> >::const_iterator it = fieldIdToDataMap.begin() ; it != fieldIdToDataMap.end() ; ++it)
+    bytesPerFieldId[it->first] += static_cast<double>(it->second->MyLength())*sizeof(double);
+}
+
 void PeridigmNS::State::copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::State> source)
 {
   // Make sure the source isn't a null ref-count pointer
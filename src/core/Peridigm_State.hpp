@@ -120,6 +120,9 @@ public:
   //! Provides access to an Epetra_Vector corresponding to the given field id.
   Teuchos::RCP<Epetra_Vector> getData(int fieldId);
 
+  //! Adds the number of bytes allocated for each field id to the given map.
+  void accumulateMemoryUsage(std::map<int, double>& bytesPerFieldId);
+
   //! Copies data from a different state object based on global IDs; functions only if all the local IDs in the target map exist in and are locally owned in the source map.
   void copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::State> source);
 
@@ -0,0 +1,177 @@
+/*! \file utPeridigm_Block_Import_Export.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Peridigm_Discretization.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_GlobalMPISession.hpp"
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include <Epetra_Import.h>
+#include <vector>
+#include "Peridigm.hpp"
+#include "Peridigm_Field.hpp"
+
+using namespace PeridigmNS;
+
+//! A 4x4x4 cube of points with a horizon that reaches the second nearest neighbors, so each processor holds ghosts.
+Teuchos::RCP<Peridigm> createCubeModel() {
+
+  Teuchos::RCP<Teuchos::ParameterList> peridigmParams = rcp(new Teuchos::ParameterList());
+
+  // material parameters
+  Teuchos::ParameterList& materialParams = peridigmParams->sublist("Materials");
+  Teuchos::ParameterList& linearElasticMaterialParams = materialParams.sublist("My Elastic Material");
+  linearElasticMaterialParams.set("Material Model", "Elastic");
+  linearElasticMaterialParams.set("Density", 7800.0);
+  linearElasticMaterialParams.set("Bulk Modulus", 130.0e9);
+  linearElasticMaterialParams.set("Shear Modulus", 78.0e9);
+
+  // blocks
+  Teuchos::ParameterList& blockParams = peridigmParams->sublist("Blocks");
+  Teuchos::ParameterList& blockOneParams = blockParams.sublist("My Group of Blocks");
+  blockOneParams.set("Block Names", "block_1");
+  blockOneParams.set("Material", "My Elastic Material");
+  blockOneParams.set("Horizon", 2.1);
+
+  // Set up discretization parameterlist
+  Teuchos::ParameterList& discretizationParams = peridigmParams->sublist("Discretization");
+  discretizationParams.set("Type", "PdQuickGrid");
+
+  // pdQuickGrid tensor product mesh generator parameters
+  Teuchos::ParameterList& pdQuickGridParams = discretizationParams.sublist("TensorProduct3DMeshGenerator");
+  pdQuickGridParams.set("Type", "PdQuickGrid");
+  pdQuickGridParams.set("X Origin",  0.0);
+  pdQuickGridParams.set("Y Origin",  0.0);
+  pdQuickGridParams.set("Z Origin",  0.0);
+  pdQuickGridParams.set("X Length",  4.0);
+  pdQuickGridParams.set("Y Length",  4.0);
+  pdQuickGridParams.set("Z Length",  4.0);
+  pdQuickGridParams.set("Number Points X", 4);
+  pdQuickGridParams.set("Number Points Y", 4);
+  pdQuickGridParams.set("Number Points Z", 4);
+
+  // create the Peridigm object
+  Teuchos::RCP<Discretization> nullDiscretization;
+  Teuchos::RCP<Peridigm> peridigm = Teuchos::rcp(new Peridigm(MPI_COMM_WORLD, peridigmParams, nullDiscretization));
+
+  return peridigm;
+}
+
+TEUCHOS_UNIT_TEST(Block_Import_Export, ScalarAndVectorPointData) {
+
+  Teuchos::RCP<Peridigm> peridigm = createCubeModel();
+
+  FieldManager& fieldManager = FieldManager::self();
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int displacementFieldId = fieldManager.getFieldId("Displacement");
+
+  Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap = peridigm->getOneDimensionalMap();
+  Teuchos::RCP<const Epetra_BlockMap> threeDimensionalMap = peridigm->getThreeDimensionalMap();
+
+  // Owned values that identify the global ID and the component
+  Epetra_Vector scalarSource(*oneDimensionalMap);
+  for(int i=0 ; i<scalarSource.MyLength() ; ++i)
+    scalarSource[i] = 1.0 + oneDimensionalMap->GID(i);
+  Epetra_Vector vectorSource(*threeDimensionalMap);
+  for(int i=0 ; i<threeDimensionalMap->NumMyElements() ; ++i){
+    for(int j=0 ; j<3 ; ++j)
+      vectorSource[3*i+j] = 10.0*threeDimensionalMap->GID(i) + j;
+  }
+
+  Teuchos::RCP< std::vector<Block> > blocks = peridigm->getBlocks();
+  for(std::vector<Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+
+    Teuchos::RCP<const Epetra_BlockMap> overlapScalarPointMap = blockIt->getOverlapScalarPointMap();
+    Teuchos::RCP<Epetra_Vector> volume = blockIt->getData(volumeFieldId, PeridigmField::STEP_NONE);
+    Teuchos::RCP<Epetra_Vector> displacement = blockIt->getData(displacementFieldId, PeridigmField::STEP_NP1);
+
+    // Every owned and ghosted entry of the overlap vectors receives the value of its owner
+    blockIt->importData(scalarSource, volumeFieldId, PeridigmField::STEP_NONE, Insert);
+    blockIt->importData(vectorSource, displacementFieldId, PeridigmField::STEP_NP1, Insert);
+    for(int i=0 ; i<overlapScalarPointMap->NumMyElements() ; ++i){
+      int globalID = overlapScalarPointMap->GID(i);
+      TEST_EQUALITY((*volume)[i], 1.0 + globalID);
+      for(int j=0 ; j<3 ; ++j)
+        TEST_EQUALITY((*displacement)[3*i+j], 10.0*globalID + j);
+    }
+
+    // Exports must match Epetra's reverse import, in which each ghost is combined into its owner
+    for(int i=0 ; i<overlapScalarPointMap->NumMyElements() ; ++i){
+      (*volume)[i] = 1.0 + i;
+      for(int j=0 ; j<3 ; ++j)
+        (*displacement)[3*i+j] = 1.0 + 3*i + j;
+    }
+    Epetra_Import scalarImporter(*overlapScalarPointMap, *oneDimensionalMap);
+    Epetra_Import vectorImporter(*blockIt->getOverlapVectorPointMap(), *threeDimensionalMap);
+
+    Epetra_CombineMode combineModes[2] = {Add, Insert};
+    for(int iMode=0 ; iMode<2 ; ++iMode){
+      Epetra_Vector scalarTarget(*oneDimensionalMap), scalarExpected(*oneDimensionalMap);
+      scalarTarget.PutScalar(0.5);
+      scalarExpected.PutScalar(0.5);
+      blockIt->exportData(scalarTarget, volumeFieldId, PeridigmField::STEP_NONE, combineModes[iMode]);
+      scalarExpected.Export(*volume, scalarImporter, combineModes[iMode]);
+      for(int i=0 ; i<scalarTarget.MyLength() ; ++i)
+        TEST_FLOATING_EQUALITY(scalarTarget[i], scalarExpected[i], 1.0e-15);
+
+      Epetra_Vector vectorTarget(*threeDimensionalMap), vectorExpected(*threeDimensionalMap);
+      vectorTarget.PutScalar(0.5);
+      vectorExpected.PutScalar(0.5);
+      blockIt->exportData(vectorTarget, displacementFieldId, PeridigmField::STEP_NP1, combineModes[iMode]);
+      vectorExpected.Export(*displacement, vectorImporter, combineModes[iMode]);
+      for(int i=0 ; i<vectorTarget.MyLength() ; ++i)
+        TEST_FLOATING_EQUALITY(vectorTarget[i], vectorExpected[i], 1.0e-15);
+    }
+  }
+}
+
+int main (int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
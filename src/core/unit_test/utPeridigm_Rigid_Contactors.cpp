@@ -0,0 +1,300 @@
+/*! \file utPeridigm_Rigid_Contactors.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Peridigm_Discretization.hpp>
+#include <Peridigm_ContactManager.hpp>
+#include <Peridigm_RigidContactor.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_GlobalMPISession.hpp"
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+#include <vector>
+#include <string>
+#include <fstream>
+#include <stdint.h>
+#include "Peridigm.hpp"
+
+using namespace PeridigmNS;
+
+//! Vertices of the twelve facets of the unit cube, wound counterclockwise when viewed from outside.
+static const double cubeFacets[12][9] = {
+  {0,0,0, 0,1,0, 1,1,0}, {0,0,0, 1,1,0, 1,0,0},   // z = 0
+  {0,0,1, 1,0,1, 1,1,1}, {0,0,1, 1,1,1, 0,1,1},   // z = 1
+  {0,0,0, 1,0,0, 1,0,1}, {0,0,0, 1,0,1, 0,0,1},   // y = 0
+  {0,1,0, 0,1,1, 1,1,1}, {0,1,0, 1,1,1, 1,1,0},   // y = 1
+  {0,0,0, 0,0,1, 0,1,1}, {0,0,0, 0,1,1, 0,1,0},   // x = 0
+  {1,0,0, 1,1,0, 1,1,1}, {1,0,0, 1,1,1, 1,0,1}    // x = 1
+};
+
+//! Write the unit cube as an ASCII STL file.
+void writeAsciiCube(const std::string& fileName) {
+  std::ofstream file(fileName.c_str());
+  file << "solid cube\n";
+  for(int iFacet=0 ; iFacet<12 ; ++iFacet){
+    file << "  facet normal 0 0 0\n    outer loop\n";
+    for(int i=0 ; i<3 ; ++i)
+      file << "      vertex " << cubeFacets[iFacet][3*i] << " " << cubeFacets[iFacet][3*i+1] << " " << cubeFacets[iFacet][3*i+2] << "\n";
+    file << "    endloop\n  endfacet\n";
+  }
+  file << "endsolid cube\n";
+}
+
+//! Write the unit cube as a binary STL file, the header begins with "solid" as some exporters do.
+void writeBinaryCube(const std::string& fileName) {
+  std::ofstream file(fileName.c_str(), std::ios::out | std::ios::binary);
+  char header[80] = "solid binary unit cube";
+  file.write(header, 80);
+  uint32_t numFacets = 12;
+  file.write(reinterpret_cast<const char*>(&numFacets), 4);
+  for(int iFacet=0 ; iFacet<12 ; ++iFacet){
+    float values[12] = {0.0f, 0.0f, 0.0f};
+    for(int i=0 ; i<9 ; ++i)
+      values[3+i] = static_cast<float>(cubeFacets[iFacet][i]);
+    file.write(reinterpret_cast<const char*>(values), 12*sizeof(float));
+    uint16_t attributeByteCount = 0;
+    file.write(reinterpret_cast<const char*>(&attributeByteCount), 2);
+  }
+}
+
+//! Write an ASCII STL file with a vertex that cannot be parsed.
+void writeInvalidAsciiFile(const std::string& fileName) {
+  std::ofstream file(fileName.c_str());
+  file << "solid broken\n  facet normal 0 0 1\n    outer loop\n";
+  file << "      vertex 0 0 0\n      vertex 1 zero 0\n      vertex 1 1 0\n";
+  file << "    endloop\n  endfacet\nendsolid broken\n";
+}
+
+//! Two points and the given rigid contactors, which are evaluated directly through RigidContactor::signedDistance().
+Teuchos::RCP<Peridigm> createModelWithRigidContactors(const Teuchos::ParameterList& rigidContactorParams) {
+
+  Teuchos::RCP<Teuchos::ParameterList> peridigmParams = rcp(new Teuchos::ParameterList());
+
+  // material parameters
+  Teuchos::ParameterList& materialParams = peridigmParams->sublist("Materials");
+  Teuchos::ParameterList& linearElasticMaterialParams = materialParams.sublist("My Elastic Material");
+  linearElasticMaterialParams.set("Material Model", "Elastic");
+  linearElasticMaterialParams.set("Density", 7800.0);
+  linearElasticMaterialParams.set("Bulk Modulus", 130.0e9);
+  linearElasticMaterialParams.set("Shear Modulus", 78.0e9);
+
+  // blocks
+  Teuchos::ParameterList& blockParams = peridigmParams->sublist("Blocks");
+  Teuchos::ParameterList& blockOneParams = blockParams.sublist("My Group of Blocks");
+  blockOneParams.set("Block Names", "block_1");
+  blockOneParams.set("Material", "My Elastic Material");
+  blockOneParams.set("Horizon", 5.0);
+
+  // discretization, the points are at x = 10.75 and 12.25, away from the contactors
+  Teuchos::ParameterList& discretizationParams = peridigmParams->sublist("Discretization");
+  discretizationParams.set("Type", "PdQuickGrid");
+  Teuchos::ParameterList& pdQuickGridParams = discretizationParams.sublist("TensorProduct3DMeshGenerator");
+  pdQuickGridParams.set("Type", "PdQuickGrid");
+  pdQuickGridParams.set("X Origin", 10.0);
+  pdQuickGridParams.set("Y Origin",  0.0);
+  pdQuickGridParams.set("Z Origin",  0.0);
+  pdQuickGridParams.set("X Length",  3.0);
+  pdQuickGridParams.set("Y Length",  1.0);
+  pdQuickGridParams.set("Z Length",  1.0);
+  pdQuickGridParams.set("Number Points X", 2);
+  pdQuickGridParams.set("Number Points Y", 1);
+  pdQuickGridParams.set("Number Points Z", 1);
+
+  // contact parameters
+  Teuchos::ParameterList& contactParams = peridigmParams->sublist("Contact");
+  contactParams.set("Search Radius", 2.0);
+  contactParams.set("Search Frequency", 1);
+  Teuchos::ParameterList& contactModelParams = contactParams.sublist("Models").sublist("My Contact Model");
+  contactModelParams.set("Contact Model", "Short Range Force");
+  contactModelParams.set("Contact Radius", 0.1);
+  contactModelParams.set("Spring Constant", 1.0);
+  contactParams.sublist("Rigid Contactors") = rigidContactorParams;
+
+  // create the Peridigm object
+  Teuchos::RCP<Discretization> nullDiscretization;
+  Teuchos::RCP<Peridigm> peridigm = Teuchos::rcp(new Peridigm(MPI_COMM_WORLD, peridigmParams, nullDiscretization));
+
+  return peridigm;
+}
+
+//! STL contactor parameters for the given file, scaled to a cube of side two.
+Teuchos::ParameterList stlContactorParams(const std::string& fileName) {
+  Teuchos::ParameterList params;
+  params.set("Type", "STL");
+  params.set("File Name", fileName);
+  params.set("Scale", 2.0);
+  params.set("Contact Distance", 1.0);
+  params.set("Penalty Stiffness", 100.0);
+  return params;
+}
+
+Teuchos::RCP<Epetra_Comm> createComm() {
+  Teuchos::RCP<Epetra_Comm> comm;
+  #ifdef HAVE_MPI
+    comm = Teuchos::rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = Teuchos::rcp(new Epetra_SerialComm);
+  #endif
+  return comm;
+}
+
+//! Signed distance and outward normal of the scaled cube read from ASCII and binary STL files.
+
+TEUCHOS_UNIT_TEST(Rigid_Contactors, STLCube) {
+
+  Teuchos::RCP<Epetra_Comm> comm = createComm();
+  if(comm->MyPID() == 0){
+    writeAsciiCube("utPeridigm_Rigid_Contactors_ascii.stl");
+    writeBinaryCube("utPeridigm_Rigid_Contactors_binary.stl");
+  }
+  comm->Barrier();
+
+  Teuchos::ParameterList rigidContactorParams;
+  rigidContactorParams.sublist("Ascii Cube") = stlContactorParams("utPeridigm_Rigid_Contactors_ascii.stl");
+  rigidContactorParams.sublist("Binary Cube") = stlContactorParams("utPeridigm_Rigid_Contactors_binary.stl");
+  Teuchos::RCP<Peridigm> peridigm = createModelWithRigidContactors(rigidContactorParams);
+  Teuchos::RCP<ContactManager> contactManager = peridigm->getContactManager();
+
+  // outside a face, inside a face, outside an edge (closest point on the edge), and beyond the contact distance
+  const int numPoints = 4;
+  const double x[numPoints][3] = {{1.0, 1.0, 2.3}, {1.0, 1.0, 1.9}, {2.3, 1.0, 2.4}, {1.0, 1.0, 5.0}};
+  const bool expectedFound[numPoints] = {true, true, true, false};
+  const double expectedDistance[numPoints] = {0.3, -0.1, 0.5, 0.0};
+  const double expectedNormal[numPoints][3] = {{0.0, 0.0, 1.0}, {0.0, 0.0, 1.0}, {0.6, 0.0, 0.8}, {0.0, 0.0, 0.0}};
+
+  const std::string names[2] = {"Ascii Cube", "Binary Cube"};
+  for(int iContactor=0 ; iContactor<2 ; ++iContactor){
+    Teuchos::RCP<const RigidContactor> contactor = contactManager->getRigidContactor(names[iContactor]);
+    TEST_ASSERT(!contactor.is_null());
+    if(contactor.is_null())
+      continue;
+    TEST_EQUALITY(contactor->Type(), std::string("STL"));
+    for(int iPoint=0 ; iPoint<numPoints ; ++iPoint){
+      double distance(0.0), normal[3] = {0.0, 0.0, 0.0};
+      bool found = contactor->signedDistance(x[iPoint], 1.0, distance, normal);
+      TEST_EQUALITY(found, expectedFound[iPoint]);
+      if(!found || !expectedFound[iPoint])
+        continue;
+      TEST_FLOATING_EQUALITY(distance + 1.0, expectedDistance[iPoint] + 1.0, 1.0e-12);
+      for(int dof=0 ; dof<3 ; ++dof)
+        TEST_FLOATING_EQUALITY(normal[dof] + 1.0, expectedNormal[iPoint][dof] + 1.0, 1.0e-12);
+    }
+  }
+}
+
+//! Signed distance and outward normal of a capped cylinder.
+
+TEUCHOS_UNIT_TEST(Rigid_Contactors, Cylinder) {
+
+  Teuchos::ParameterList rigidContactorParams;
+  Teuchos::ParameterList& cylinderParams = rigidContactorParams.sublist("Cylinder");
+  cylinderParams.set("Type", "Cylinder");
+  cylinderParams.set("Center X", 0.0);
+  cylinderParams.set("Center Y", 0.0);
+  cylinderParams.set("Center Z", 0.0);
+  cylinderParams.set("Axis X", 0.0);
+  cylinderParams.set("Axis Y", 0.0);
+  cylinderParams.set("Axis Z", 2.0);
+  cylinderParams.set("Radius", 1.0);
+  cylinderParams.set("Length", 2.0);
+  cylinderParams.set("Contact Distance", 1.0);
+  cylinderParams.set("Penalty Stiffness", 100.0);
+  Teuchos::RCP<Peridigm> peridigm = createModelWithRigidContactors(rigidContactorParams);
+
+  Teuchos::RCP<const RigidContactor> contactor = peridigm->getContactManager()->getRigidContactor("Cylinder");
+  TEST_ASSERT(!contactor.is_null());
+  if(contactor.is_null())
+    return;
+  TEST_EQUALITY(contactor->Type(), std::string("Cylinder"));
+
+  // outside the side, inside near the side, outside each end cap, outside the rim, and beyond the contact distance
+  const int numPoints = 6;
+  const double x[numPoints][3] = {{1.2, 0.0, 0.0}, {0.0, 0.9, 0.5}, {0.0, 0.0, 1.3}, {0.0, -0.2, -1.1}, {1.3, 0.0, 1.4}, {3.0, 0.0, 0.0}};
+  const bool expectedFound[numPoints] = {true, true, true, true, true, false};
+  const double expectedDistance[numPoints] = {0.2, -0.1, 0.3, 0.1, 0.5, 0.0};
+  const double expectedNormal[numPoints][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 0.0, -1.0}, {0.6, 0.0, 0.8}, {0.0, 0.0, 0.0}};
+
+  for(int iPoint=0 ; iPoint<numPoints ; ++iPoint){
+    double distance(0.0), normal[3] = {0.0, 0.0, 0.0};
+    bool found = contactor->signedDistance(x[iPoint], 1.0, distance, normal);
+    TEST_EQUALITY(found, expectedFound[iPoint]);
+    if(!found || !expectedFound[iPoint])
+      continue;
+    TEST_FLOATING_EQUALITY(distance + 1.0, expectedDistance[iPoint] + 1.0, 1.0e-12);
+    for(int dof=0 ; dof<3 ; ++dof)
+      TEST_FLOATING_EQUALITY(normal[dof] + 1.0, expectedNormal[iPoint][dof] + 1.0, 1.0e-12);
+  }
+}
+
+//! A missing or unparsable STL file must throw on every processor, rather than only on the reading processor.
+
+TEUCHOS_UNIT_TEST(Rigid_Contactors, STLReadErrors) {
+
+  Teuchos::RCP<Epetra_Comm> comm = createComm();
+  if(comm->MyPID() == 0)
+    writeInvalidAsciiFile("utPeridigm_Rigid_Contactors_invalid.stl");
+  comm->Barrier();
+
+  Teuchos::ParameterList missingFileParams;
+  missingFileParams.sublist("Missing") = stlContactorParams("utPeridigm_Rigid_Contactors_missing.stl");
+  TEST_THROW(createModelWithRigidContactors(missingFileParams), std::exception);
+
+  Teuchos::ParameterList invalidFileParams;
+  invalidFileParams.sublist("Invalid") = stlContactorParams("utPeridigm_Rigid_Contactors_invalid.stl");
+  TEST_THROW(createModelWithRigidContactors(invalidFileParams), std::exception);
+}
+
+int main (int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,209 @@
+/*! \file utPeridigm_SerialMatrix.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include <Epetra_Map.h>
+#include <Epetra_FECrsMatrix.h>
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+#include <vector>
+#include <map>
+#include <set>
+#include <cmath>
+#include <algorithm>
+#include "Peridigm_SerialMatrix.hpp"
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Number of nodes in the chain, three degrees of freedom per node.
+static const int numNodes = 12;
+static const int numDoFs = 3;
+
+//! Global degrees of freedom of the element starting at the given node, which couples it to the next two nodes.
+vector<int> elementIndices(int firstNode)
+{
+  vector<int> indices;
+  for(int node=firstNode ; node<firstNode+3 ; ++node)
+    for(int dof=0 ; dof<numDoFs ; ++dof)
+      indices.push_back(numDoFs*node + dof);
+  return indices;
+}
+
+//! Dense element matrix with distinct, nonzero entries.
+vector< vector<double> > elementMatrix(int firstNode)
+{
+  int n = numDoFs*3;
+  vector< vector<double> > values(n, vector<double>(n));
+  for(int i=0 ; i<n ; ++i)
+    for(int j=0 ; j<n ; ++j)
+      values[i][j] = 1.0 + 0.1*firstNode + 0.01*i + 0.001*j + (i == j ? 10.0 : 0.0);
+  return values;
+}
+
+/*! \brief Create a tangent matrix with the graph of the element chain, as in Peridigm::allocateJacobian().
+ *
+ *  Each processor owns the elements that start at its nodes, so elements near the processor boundary contribute to
+ *  rows owned by the neighboring processor.  The graph of those off-processor rows is returned for block assembly.
+ */
+RCP<Epetra_FECrsMatrix> createTangent(const Epetra_Map& nodeMap, const Epetra_Map& tangentMap, map< int, vector<int> >& offProcessorGraph)
+{
+  int numEntriesPerRow = 0;
+  bool ignoreNonLocalEntries = false;
+  RCP<Epetra_FECrsMatrix> tangent = rcp(new Epetra_FECrsMatrix(Copy, tangentMap, numEntriesPerRow, ignoreNonLocalEntries));
+
+  map< int, set<int> > rowEntries;
+  for(int i=0 ; i<nodeMap.NumMyElements() ; ++i){
+    int firstNode = nodeMap.GID(i);
+    if(firstNode + 2 >= numNodes)
+      continue;
+    vector<int> indices = elementIndices(firstNode);
+    for(unsigned int r=0 ; r<indices.size() ; ++r)
+      rowEntries[indices[r]].insert(indices.begin(), indices.end());
+  }
+
+  offProcessorGraph.clear();
+  for(map< int, set<int> >::iterator it=rowEntries.begin() ; it!=rowEntries.end() ; ++it){
+    vector<int> indices(it->second.begin(), it->second.end());
+    vector<double> zeros(indices.size(), 0.0);
+    int err = tangent->InsertGlobalValues(it->first, static_cast<int>(indices.size()), &zeros[0], &indices[0]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** createTangent(), InsertGlobalValues() returned negative error code.\n");
+    if(!tangentMap.MyGID(it->first))
+      offProcessorGraph[it->first] = indices;
+  }
+  int err = tangent->GlobalAssemble();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** createTangent(), GlobalAssemble() returned nonzero error code.\n");
+
+  return tangent;
+}
+
+//! Assemble the same element matrices with direct block assembly and row by row, and compare the results.
+
+TEUCHOS_UNIT_TEST(SerialMatrix, BlockAssemblyMatchesRowByRow) {
+
+  RCP<Epetra_Comm> comm;
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+
+  // nodes are split into contiguous ranges, one per processor
+  Epetra_Map nodeMap(numNodes, 0, *comm);
+  vector<int> myGlobalElements;
+  for(int i=0 ; i<nodeMap.NumMyElements() ; ++i)
+    for(int dof=0 ; dof<numDoFs ; ++dof)
+      myGlobalElements.push_back(numDoFs*nodeMap.GID(i) + dof);
+  Epetra_Map tangentMap(numDoFs*numNodes, static_cast<int>(myGlobalElements.size()), &myGlobalElements[0], 0, *comm);
+
+  map< int, vector<int> > offProcessorGraph;
+  RCP<Epetra_FECrsMatrix> blockTangent = createTangent(nodeMap, tangentMap, offProcessorGraph);
+  RCP<Epetra_FECrsMatrix> rowTangent = createTangent(nodeMap, tangentMap, offProcessorGraph);
+  if(comm->NumProc() > 1)
+    TEST_ASSERT(!offProcessorGraph.empty());
+
+  SerialMatrix blockMatrix(blockTangent);
+  SerialMatrix rowMatrix(rowTangent);
+  TEST_ASSERT(blockMatrix.enableBlockAssembly(numDoFs, offProcessorGraph));
+
+  // assemble twice to check that the off-processor buffer is cleared by globalAssemble()
+  for(int pass=0 ; pass<2 ; ++pass){
+    blockMatrix.putScalar(0.0);
+    rowMatrix.putScalar(0.0);
+    for(int i=0 ; i<nodeMap.NumMyElements() ; ++i){
+      int firstNode = nodeMap.GID(i);
+      if(firstNode + 2 >= numNodes)
+        continue;
+      vector<int> indices = elementIndices(firstNode);
+      vector< vector<double> > values = elementMatrix(firstNode);
+      vector<const double*> rows(values.size());
+      for(unsigned int r=0 ; r<values.size() ; ++r)
+        rows[r] = &values[r][0];
+      blockMatrix.addValues(static_cast<int>(indices.size()), &indices[0], &rows[0]);
+      rowMatrix.addValues(static_cast<int>(indices.size()), &indices[0], &rows[0]);
+
+      // indices that are not ordered node blocks take the row-by-row fallback
+      int permutedIndices[3] = {indices[1], indices[0], indices[2]};
+      double permutedValues[3][3] = {{2.0, 0.5, 0.25}, {0.5, 3.0, 0.125}, {0.25, 0.125, 4.0}};
+      const double* permutedRows[3] = {permutedValues[0], permutedValues[1], permutedValues[2]};
+      blockMatrix.addValues(3, permutedIndices, permutedRows);
+      rowMatrix.addValues(3, permutedIndices, permutedRows);
+    }
+    TEST_EQUALITY(blockMatrix.globalAssemble(), 0);
+    TEST_EQUALITY(rowMatrix.globalAssemble(), 0);
+  }
+
+  // both matrices share the same graph, so the entries can be compared in storage order
+  const double relTolerance = 1.0e-14;
+  for(int row=0 ; row<blockTangent->NumMyRows() ; ++row){
+    int blockNumEntries, rowNumEntries;
+    double *blockValues, *rowValues;
+    int *blockIndices, *rowIndices;
+    TEST_EQUALITY(blockTangent->ExtractMyRowView(row, blockNumEntries, blockValues, blockIndices), 0);
+    TEST_EQUALITY(rowTangent->ExtractMyRowView(row, rowNumEntries, rowValues, rowIndices), 0);
+    TEST_EQUALITY(blockNumEntries, rowNumEntries);
+    for(int k=0 ; k<std::min(blockNumEntries, rowNumEntries) ; ++k){
+      TEST_EQUALITY(blockTangent->GCID(blockIndices[k]), rowTangent->GCID(rowIndices[k]));
+      TEST_COMPARE(rowValues[k], !=, 0.0);
+      TEST_COMPARE(std::fabs(blockValues[k] - rowValues[k]), <=, relTolerance*std::fabs(rowValues[k]));
+    }
+  }
+}
+
+int main (int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
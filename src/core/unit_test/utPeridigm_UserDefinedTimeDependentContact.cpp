@@ -0,0 +1,129 @@
+/*! \file utPeridigm_UserDefinedTimeDependentContact.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Peridigm_UserDefinedTimeDependentShortRangeForceContactModel.hpp"
+#include <string>
+
+using namespace PeridigmNS;
+
+Teuchos::RCP<UserDefinedTimeDependentShortRangeForceContactModel> createContactModel(const std::string& frictionCoefficient)
+{
+  Teuchos::ParameterList params;
+  params.set("Contact Model", "Time-Dependent Short-Range Force");
+  params.set("Contact Radius", 0.1);
+  params.set("Spring Constant", 1.0);
+  params.set("Horizon", 0.5);
+  params.set("Friction Coefficient", frictionCoefficient);
+  return Teuchos::rcp(new UserDefinedTimeDependentShortRangeForceContactModel(params));
+}
+
+//! The friction coefficient is evaluated at the first call, even when it is made at time zero.
+
+TEUCHOS_UNIT_TEST(UserDefinedTimeDependentContact, FirstEvaluation) {
+
+  Teuchos::RCP<UserDefinedTimeDependentShortRangeForceContactModel> contactModel = createContactModel("0.1 + 0.2*t");
+
+  double currentValue(-1.0), previousValue(-1.0);
+  contactModel->evaluateParserFriction(currentValue, previousValue, 0.0, 0.0);
+  TEST_FLOATING_EQUALITY(currentValue, 0.1, 1.0e-14);
+  TEST_FLOATING_EQUALITY(previousValue, 0.1, 1.0e-14);
+}
+
+//! Repeated calls at the same time return the tabulated values, a call at a new time evaluates the expression again.
+
+TEUCHOS_UNIT_TEST(UserDefinedTimeDependentContact, TabulationOverTime) {
+
+  Teuchos::RCP<UserDefinedTimeDependentShortRangeForceContactModel> contactModel = createContactModel("0.1 + 0.2*t");
+
+  double currentValue(0.0), previousValue(0.0);
+  contactModel->evaluateParserFriction(currentValue, previousValue, 1.0, 0.5);
+  TEST_FLOATING_EQUALITY(currentValue, 0.3, 1.0e-14);
+  TEST_FLOATING_EQUALITY(previousValue, 0.2, 1.0e-14);
+
+  currentValue = previousValue = 0.0;
+  contactModel->evaluateParserFriction(currentValue, previousValue, 1.0, 0.5);
+  TEST_FLOATING_EQUALITY(currentValue, 0.3, 1.0e-14);
+  TEST_FLOATING_EQUALITY(previousValue, 0.2, 1.0e-14);
+
+  currentValue = previousValue = 0.0;
+  contactModel->evaluateParserFriction(currentValue, previousValue, 2.0, 1.0);
+  TEST_FLOATING_EQUALITY(currentValue, 0.5, 1.0e-14);
+  TEST_FLOATING_EQUALITY(previousValue, 0.3, 1.0e-14);
+
+  // stepping back to an earlier time is not served from the tabulated values
+  contactModel->evaluateParserFriction(currentValue, previousValue, 1.0, 0.5);
+  TEST_FLOATING_EQUALITY(currentValue, 0.3, 1.0e-14);
+  TEST_FLOATING_EQUALITY(previousValue, 0.2, 1.0e-14);
+}
+
+//! An expression that assigns to value is compiled as given, otherwise it is prefixed with "value = ".
+
+TEUCHOS_UNIT_TEST(UserDefinedTimeDependentContact, ExpressionForms) {
+
+  Teuchos::RCP<UserDefinedTimeDependentShortRangeForceContactModel> expressionModel = createContactModel("0.5*t*t");
+  Teuchos::RCP<UserDefinedTimeDependentShortRangeForceContactModel> assignmentModel = createContactModel("value = 0.5*t*t");
+
+  double times[3] = {0.0, 0.25, 3.0};
+  for(int i=1 ; i<3 ; ++i){
+    double expressionCurrent, expressionPrevious, assignmentCurrent, assignmentPrevious;
+    expressionModel->evaluateParserFriction(expressionCurrent, expressionPrevious, times[i], times[i-1]);
+    assignmentModel->evaluateParserFriction(assignmentCurrent, assignmentPrevious, times[i], times[i-1]);
+    TEST_FLOATING_EQUALITY(expressionCurrent + 1.0, 0.5*times[i]*times[i] + 1.0, 1.0e-14);
+    TEST_FLOATING_EQUALITY(expressionPrevious + 1.0, 0.5*times[i-1]*times[i-1] + 1.0, 1.0e-14);
+    TEST_FLOATING_EQUALITY(assignmentCurrent, expressionCurrent, 1.0e-14);
+    TEST_FLOATING_EQUALITY(assignmentPrevious + 1.0, expressionPrevious + 1.0, 1.0e-14);
+  }
+}
+
+int main (int argc, char* argv[])
+{
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -142,6 +142,39 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
                                                       const int* ownedIDs,
                                                       const int* neighborhoodList,
                                                       PeridigmNS::DataManager& dataManager) const
+{
+  evaluateDamage(numOwnedPoints, ownedIDs, neighborhoodList, 0, 0, dataManager);
+}
+
+void
+PeridigmNS::CriticalStretchDamageModel::computeInteriorDamage(const double dt,
+                                                              const int numOwnedPoints,
+                                                              const int* ownedIDs,
+                                                              const int* neighborhoodList,
+                                                              const int* isBoundaryPoint,
+                                                              PeridigmNS::DataManager& dataManager) const
+{
+  evaluateDamage(numOwnedPoints, ownedIDs, neighborhoodList, isBoundaryPoint, 0, dataManager);
+}
+
+void
+PeridigmNS::CriticalStretchDamageModel::computeBoundaryDamage(const double dt,
+                                                              const int numOwnedPoints,
+                                                              const int* ownedIDs,
+                                                              const int* neighborhoodList,
+                                                              const int* isBoundaryPoint,
+                                                              PeridigmNS::DataManager& dataManager) const
+{
+  evaluateDamage(numOwnedPoints, ownedIDs, neighborhoodList, isBoundaryPoint, 1, dataManager);
+}
+
+void
+PeridigmNS::CriticalStretchDamageModel::evaluateDamage(const int numOwnedPoints,
+                                                       const int* ownedIDs,
+                                                       const int* neighborhoodList,
+                                                       const int* pointFlags,
+                                                       int evaluateFlag,
+                                                       PeridigmNS::DataManager& dataManager) const
 {
   double *x, *y, *damage, *bondDamageN, *bondDamageNP1, *deltaTemperature;
   dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
@@ -158,8 +191,7 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
   int nodeId, numNeighbors, neighborID, iID, iNID;
   double nodeInitialX[3], nodeCurrentX[3], initialDistance, currentDistance, relativeExtension, totalDamage;
 
-  // Set the bond damage to the previous value
-  *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)) = *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N));
+  // STEP_N bond damage is carried forward bond by bond, and broken bonds skip the stretch check
 
   // Update the bond damage
   // Break bonds if the extension is greater than the critical extension
@@ -173,9 +205,21 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
 	nodeCurrentX[1] = y[nodeId*3+1];
 	nodeCurrentX[2] = y[nodeId*3+2];
 	numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    if(pointFlags != 0 && pointFlags[iID] != evaluateFlag){
+      neighborhoodListIndex += numNeighbors;
+      bondIndex += numNeighbors;
+      continue;
+    }
 //     *BondsLeftNP1 = numNeighbors;
+	totalDamage = 0.0;
 	for(iNID=0 ; iNID<numNeighbors ; ++iNID){
 	  neighborID = neighborhoodList[neighborhoodListIndex++];
+      bondDamageNP1[bondIndex] = bondDamageN[bondIndex];
+      if(bondDamageNP1[bondIndex] >= 1.0){
+        totalDamage += bondDamageNP1[bondIndex];
+        bondIndex += 1;
+        continue;
+      }
       initialDistance = 
         distance(nodeInitialX[0], nodeInitialX[1], nodeInitialX[2],
                  x[neighborID*3], x[neighborID*3+1], x[neighborID*3+2]);
@@ -190,26 +234,11 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
         trialDamage = 1.0;
       if(trialDamage > bondDamageNP1[bondIndex])
         bondDamageNP1[bondIndex] = trialDamage;
+      totalDamage += bondDamageNP1[bondIndex];
       bondIndex += 1;
     }
-  }
-
-  //  Update the element damage (percent of bonds broken)
-
-  neighborhoodListIndex = 0;
-  bondIndex = 0;
-  for(iID=0 ; iID<numOwnedPoints ; ++iID){
-	nodeId = ownedIDs[iID];
-	numNeighbors = neighborhoodList[neighborhoodListIndex++];
-    neighborhoodListIndex += numNeighbors;
-	totalDamage = 0.0;
-	for(iNID=0 ; iNID<numNeighbors ; ++iNID){
-	  totalDamage += bondDamageNP1[bondIndex++];
-	}
 	if(numNeighbors > 0)
 	  totalDamage /= numNeighbors;
-	else
-	  totalDamage = 0.0;
  	damage[nodeId] = totalDamage;
   }
 }
@@ -89,8 +89,38 @@ namespace PeridigmNS {
                   const int* neighborhoodList,
                   PeridigmNS::DataManager& dataManager) const ;
 
+    //! Bond damage depends only on the bond end points, so interior points can be evaluated separately.
+    virtual bool supportsSplitEvaluation() const { return true; }
+
+    //! Evaluate the damage at interior points
+    virtual void
+    computeInteriorDamage(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          const int* isBoundaryPoint,
+                          PeridigmNS::DataManager& dataManager) const ;
+
+    //! Evaluate the damage at boundary points
+    virtual void
+    computeBoundaryDamage(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          const int* isBoundaryPoint,
+                          PeridigmNS::DataManager& dataManager) const ;
+
   protected:
 
+    //! Evaluate the damage at the owned points for which pointFlags equals evaluateFlag, or at all owned points if pointFlags is null.
+    void
+    evaluateDamage(const int numOwnedPoints,
+                   const int* ownedIDs,
+                   const int* neighborhoodList,
+                   const int* pointFlags,
+                   int evaluateFlag,
+                   PeridigmNS::DataManager& dataManager) const ;
+
 	//! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
 	inline double distance(double a1, double a2, double a3,
 						   double b1, double b2, double b3) const
@@ -89,6 +89,33 @@ namespace PeridigmNS {
                   const int* neighborhoodList,
                   PeridigmNS::DataManager& dataManager) const = 0;
 
+	//! Returns true if the damage model implements computeInteriorDamage() and computeBoundaryDamage().
+	virtual bool supportsSplitEvaluation() const { return false; }
+
+	/*! \brief Evaluate the damage at interior points while the halo exchange is in progress.
+	 *
+	 *  Interior points are the owned points for which isBoundaryPoint is zero.  A damage model that overrides this
+	 *  function must also override computeBoundaryDamage().  The default implementation does nothing.
+	 */
+	virtual void
+	computeInteriorDamage(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          const int* isBoundaryPoint,
+                          PeridigmNS::DataManager& dataManager) const {}
+
+	//! Evaluate the damage at boundary points once the halo exchange is complete; the default implementation calls computeDamage().
+	virtual void
+	computeBoundaryDamage(const double dt,
+                          const int numOwnedPoints,
+                          const int* ownedIDs,
+                          const int* neighborhoodList,
+                          const int* isBoundaryPoint,
+                          PeridigmNS::DataManager& dataManager) const {
+      computeDamage(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager);
+    }
+
   private:
 	
 	//! Default constructor with no arguments, private to prevent use.
@@ -188,9 +188,7 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::computeDamage(co
   int nodeId, numNeighbors, neighborID, iID, iNID;
   double nodeInitialX[3], nodeCurrentX[3], initialDistance, currentDistance, relativeExtension, totalDamage;
 
-  // Set the bond damage to the previous value
-  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1) =
-    dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N);
+  // Previous bond damage is copied as each bond is visited, the element damage is summed in the same pass
 
   // Update the bond damage
   // Break bonds if the extension is greater than the critical extension
@@ -205,8 +203,15 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::computeDamage(co
 	nodeCurrentX[2] = y[nodeId*3+2];
 	numNeighbors = neighborhoodList[neighborhoodListIndex++];
 //     *BondsLeftNP1 = numNeighbors;
+	totalDamage = 0.0;
 	for(iNID=0 ; iNID<numNeighbors ; ++iNID){
 	  neighborID = neighborhoodList[neighborhoodListIndex++];
+      bondDamageNP1[bondIndex] = bondDamageN[bondIndex];
+      if(bondDamageNP1[bondIndex] >= 1.0){
+        totalDamage += bondDamageNP1[bondIndex];
+        bondIndex += 1;
+        continue;
+      }
       initialDistance = 
         distance(nodeInitialX[0], nodeInitialX[1], nodeInitialX[2],
                  x[neighborID*3], x[neighborID*3+1], x[neighborID*3+2]);
@@ -223,26 +228,11 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::computeDamage(co
         bondDamageNP1[bondIndex] = trialDamage;
 //       if(bondDamageNP1[bondIndex]==1.)
 //         *BondsLeftNP1-=1;
+      totalDamage += bondDamageNP1[bondIndex];
       bondIndex += 1;
     }
-  }
-
-  //  Update the element damage (percent of bonds broken)
-
-  neighborhoodListIndex = 0;
-  bondIndex = 0;
-  for(iID=0 ; iID<numOwnedPoints ; ++iID){
-	nodeId = ownedIDs[iID];
-	numNeighbors = neighborhoodList[neighborhoodListIndex++];
-    neighborhoodListIndex += numNeighbors;
-	totalDamage = 0.0;
-	for(iNID=0 ; iNID<numNeighbors ; ++iNID){
-	  totalDamage += bondDamageNP1[bondIndex++];
-	}
 	if(numNeighbors > 0)
 	  totalDamage /= numNeighbors;
-	else
-	  totalDamage = 0.0;
  	damage[nodeId] = totalDamage;
   }
 }
@@ -0,0 +1,227 @@
+/*! \file utPeridigm_CriticalStretchDamageModel.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_CriticalStretchDamageModel.hpp"
+#include "Peridigm_UserDefinedTimeDependentCriticalStretchDamageModel.hpp"
+#include "Peridigm_DataManager.hpp"
+#include "Peridigm_Field.hpp"
+#include <Epetra_SerialComm.h>
+#include <Epetra_Map.h>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Six points along a line, each bonded to the points within two spacings.
+class DamageChain {
+
+public:
+
+  DamageChain() : numPoints(6), comm(), nodeMap(6, 0, comm), unknownMap(18, 0, comm), bondMap(18, 0, comm) {
+    for(int i=0 ; i<numPoints ; ++i){
+      ownedIDs.push_back(i);
+      int numNeighbors = 0;
+      for(int j=0 ; j<numPoints ; ++j)
+        numNeighbors += (j != i && abs(j-i) <= 2) ? 1 : 0;
+      neighborhoodList.push_back(numNeighbors);
+      for(int j=0 ; j<numPoints ; ++j){
+        if(j != i && abs(j-i) <= 2)
+          neighborhoodList.push_back(j);
+      }
+    }
+  }
+
+  //! Allocate the fields of the damage model, with the points at x = i and bond damage at STEP_N of 0, 0.5 or 1.
+  void allocate(const DamageModel& damageModel) {
+    dataManager.setMaps(rcp(&nodeMap, false),
+                        rcp(&nodeMap, false),
+                        rcp(&unknownMap, false),
+                        rcp(&unknownMap, false),
+                        rcp(&bondMap, false),
+                        rcp(&bondMap, false));
+    dataManager.allocateData(damageModel.FieldIds());
+    FieldManager& fieldManager = FieldManager::self();
+    modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+    coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+    damageFieldId = fieldManager.getFieldId("Damage");
+    bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    x.PutScalar(0.0);
+    for(int i=0 ; i<numPoints ; ++i)
+      x[3*i] = static_cast<double>(i);
+    Epetra_Vector& bondDamageN = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_N);
+    for(int b=0 ; b<bondDamageN.MyLength() ; ++b)
+      bondDamageN[b] = (b%5 == 0) ? 1.0 : ((b%5 == 2) ? 0.5 : 0.0);
+  }
+
+  //! Set the current positions along the line and put stale values in the STEP_NP1 bond damage, as left by the state update.
+  void deform(const double* positions) {
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    y.PutScalar(0.0);
+    for(int i=0 ; i<numPoints ; ++i)
+      y[3*i] = positions[i];
+    dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1)->PutScalar(0.75);
+  }
+
+  /*! \brief Bond and element damage as evaluated before the single-pass update.
+   *
+   *  The full STEP_N bond damage is copied to STEP_NP1, every bond is checked against the critical stretch, and the
+   *  element damage is summed in a second sweep over the bonds.
+   */
+  void referenceDamage(double criticalStretch, vector<double>& bondDamage, vector<double>& damage) {
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& bondDamageN = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_N);
+    bondDamage.assign(&bondDamageN[0], &bondDamageN[0] + bondDamageN.MyLength());
+    int neighborhoodListIndex(0), bondIndex(0);
+    for(int iID=0 ; iID<numPoints ; ++iID){
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+        int neighborID = neighborhoodList[neighborhoodListIndex++];
+        double initialDistance = fabs(x[3*neighborID] - x[3*iID]);
+        double currentDistance = fabs(y[3*neighborID] - y[3*iID]);
+        double trialDamage = (currentDistance - initialDistance)/initialDistance > criticalStretch ? 1.0 : 0.0;
+        if(trialDamage > bondDamage[bondIndex])
+          bondDamage[bondIndex] = trialDamage;
+        bondIndex += 1;
+      }
+    }
+    damage.assign(numPoints, 0.0);
+    neighborhoodListIndex = 0;
+    bondIndex = 0;
+    for(int iID=0 ; iID<numPoints ; ++iID){
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      neighborhoodListIndex += numNeighbors;
+      double totalDamage = 0.0;
+      for(int iNID=0 ; iNID<numNeighbors ; ++iNID)
+        totalDamage += bondDamage[bondIndex++];
+      if(numNeighbors > 0)
+        totalDamage /= numNeighbors;
+      damage[iID] = totalDamage;
+    }
+  }
+
+  int numPoints;
+  vector<int> ownedIDs;
+  vector<int> neighborhoodList;
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap;
+  Epetra_Map unknownMap;
+  Epetra_Map bondMap;
+  DataManager dataManager;
+  int modelCoordinatesFieldId, coordinatesFieldId, damageFieldId, bondDamageFieldId;
+};
+
+//! Evaluate the damage model over two steps and compare the bond and element damage with the reference.
+void checkAgainstReference(DamageModel& damageModel, double criticalStretch, Teuchos::FancyOStream& out, bool& success)
+{
+  DamageChain chain;
+  chain.allocate(damageModel);
+
+  // Bond stretches between 0.02 and 0.2 against a critical stretch of 0.1, then a further stretch on the second step
+  const double positions[2][6] = {{0.0, 1.05, 2.25, 3.3, 4.5, 5.52},
+                                  {0.0, 1.12, 2.25, 3.3, 4.5, 5.65}};
+  for(int step=0 ; step<2 ; ++step){
+    chain.deform(positions[step]);
+    vector<double> expectedBondDamage, expectedDamage;
+    chain.referenceDamage(criticalStretch, expectedBondDamage, expectedDamage);
+
+    damageModel.computeDamage(1.0, chain.numPoints, &chain.ownedIDs[0], &chain.neighborhoodList[0], chain.dataManager);
+
+    Epetra_Vector& bondDamage = *chain.dataManager.getData(chain.bondDamageFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& damage = *chain.dataManager.getData(chain.damageFieldId, PeridigmField::STEP_NP1);
+    TEST_EQUALITY(bondDamage.MyLength(), static_cast<int>(expectedBondDamage.size()));
+    for(int b=0 ; b<bondDamage.MyLength() ; ++b)
+      TEST_EQUALITY(bondDamage[b], expectedBondDamage[b]);
+    for(int i=0 ; i<chain.numPoints ; ++i)
+      TEST_EQUALITY(damage[i], expectedDamage[i]);
+
+    chain.dataManager.updateState();
+  }
+}
+
+//! Bond damage carried forward bond by bond matches the copy of the full STEP_N vector.
+
+TEUCHOS_UNIT_TEST(CriticalStretchDamageModel, BondDamageUpdate) {
+
+  ParameterList params;
+  params.set("Damage Model", "Critical Stretch");
+  params.set("Critical Stretch", 0.1);
+  CriticalStretchDamageModel damageModel(params);
+
+  checkAgainstReference(damageModel, 0.1, out, success);
+}
+
+//! Same check for the time-dependent critical stretch, with the critical stretch tabulated by the parser.
+
+TEUCHOS_UNIT_TEST(UserDefinedTimeDependentCriticalStretchDamageModel, BondDamageUpdate) {
+
+  ParameterList params;
+  params.set("Damage Model", "Time Dependent Critical Stretch");
+  params.set("Time Dependent Critical Stretch", "if(t <= 0.5){ value = 50.0; } else{ value = 0.1; }");
+  UserDefinedTimeDependentCriticalStretchDamageModel damageModel(params);
+
+  double currentValue, previousValue;
+  damageModel.evaluateParserDmg(currentValue, previousValue, 1.0, 0.0);
+  TEST_FLOATING_EQUALITY(currentValue, 0.1, 1.0e-15);
+  TEST_FLOATING_EQUALITY(previousValue, 50.0, 1.0e-15);
+
+  checkAgainstReference(damageModel, 0.1, out, success);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -75,6 +75,9 @@ namespace PeridigmNS {
     //! Write data to disk
     virtual void write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double, int) = 0;
 
+    //! Number of bytes held in temporary buffers used for writing output
+    virtual double memorySizeInBytes() const { return 0.0; }
+
   protected:
 
     //! Number of processors and processor ID
@@ -78,6 +78,15 @@ namespace PeridigmNS {
         (*it)->write(blocks, current_time, nsteps);
     }
 
+    //! Number of bytes held in temporary output buffers, summed over all output managers in container
+    double memorySizeInBytes() const {
+      double numBytes(0.0);
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::const_iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        numBytes += (*it)->memorySizeInBytes();
+      return numBytes;
+    }
+
   protected:
 
     //! Container for RCPs to individual output managers
@@ -67,7 +67,7 @@ using namespace std;
 PeridigmNS::OutputManager_ExodusII::OutputManager_ExodusII(const Teuchos::RCP<Teuchos::ParameterList>& params, 
                                                            PeridigmNS::Peridigm *peridigm_,
                                                            Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) 
-  : peridigm(peridigm_) {
+  : peridigm(peridigm_), outputBufferBytes(0.0) {
   
   // No input to validate; no output requested
   iWrite = true;
@@ -291,6 +291,10 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
   double *globals = &globals_vec[0];
   unsigned int globalsIndex = 0;
 
+  double bufferBytes = static_cast<double>(3*num_nodes + num_global_vars)*sizeof(double);
+  if(bufferBytes > outputBufferBytes)
+    outputBufferBytes = bufferBytes;
+
   if (haveData)
   for (Teuchos::ParameterList::ConstIterator it = outputVariables->begin(); it != outputVariables->end(); ++it) {
 
@@ -74,6 +74,9 @@ namespace PeridigmNS {
     //! Write data to disk
     virtual void write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double current_time, int nsteps);
 
+    //! Largest number of bytes allocated for temporary buffers in a call to write()
+    virtual double memorySizeInBytes() const { return outputBufferBytes; }
+
   private:
     
     //! Copy constructor.
@@ -146,6 +149,9 @@ namespace PeridigmNS {
 
     // First block to be cutoff from output
     int cutOffBlock;
+
+    //! Largest number of bytes allocated for temporary buffers in a call to write()
+    double outputBufferBytes;
 };
   
 }
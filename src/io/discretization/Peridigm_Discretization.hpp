@@ -54,6 +54,7 @@
 #include <Epetra_Vector.h>
 #include "Peridigm_NeighborhoodData.hpp"
 #include "Peridigm_InterfaceData.hpp"
+#include "Peridigm_SkinFacetData.hpp"
 #include "QuickGrid.h"
 #include "BondFilter.h"
 
@@ -153,6 +154,12 @@ namespace PeridigmNS {
       return;
     }
 
+    //! Get the triangulated outer skin of the original Exodus hex/tet mesh for the locally-owned elements.
+    virtual Teuchos::RCP<const PeridigmNS::SkinFacetData> getSkinFacets() const {
+      // The default implementation returns a null pointer, skin facets are available only for hex/tet meshes.
+      return Teuchos::null;
+    }
+
     //! Get the owned (non-overlap) map.
     static Epetra_BlockMap getOwnedMap(const Epetra_Comm& comm, const QUICKGRID::Data& gridData, int ndf);
 
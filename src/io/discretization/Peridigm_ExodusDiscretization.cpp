@@ -49,9 +49,11 @@
 #include "Peridigm_ProximitySearch.hpp"
 #include "Peridigm_HorizonManager.hpp"
 #include "Peridigm_GeometryUtils.hpp"
+#include "PdZoltan.h"
 #include <Epetra_Map.h>
 #include <Epetra_BlockMap.h>
 #include <Epetra_Vector.h>
+#include <Epetra_MultiVector.h>
 #include <Epetra_Import.h>
 #include <Epetra_MpiComm.h>
 #include <Teuchos_CommHelpers.hpp>
@@ -60,6 +62,7 @@
 #include <Teuchos_RCP.hpp>
 #include <Ionit_Initializer.h>
 #include <sstream>
+#include <algorithm>
 #include <boost/math/constants/constants.hpp>
 #include <boost/algorithm/string.hpp>
 #include <exodusII.h>
@@ -74,7 +77,10 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
   minElementRadius(1.0e50),
   maxElementRadius(0.0),
   storeExodusMesh(false),
+  decomposeSerialMesh(false),
   constructInterfaces(false),
+  extractSkinFacets(false),
+  interfaceOutputBufferSteps(1),
   computeIntersections(false),
   maxElementDimension(0.0),
   numBonds(0),
@@ -107,12 +113,34 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
     constructInterfaces = params->get<bool>("Construct Interfaces");
     storeExodusMesh = constructInterfaces;
   }
+  // the outer skin of the mesh is needed for node-to-facet contact
+  if(params->isParameter("Extract Skin Facets")){
+    extractSkinFacets = params->get<bool>("Extract Skin Facets");
+    if(extractSkinFacets)
+      storeExodusMesh = true;
+  }
+  // Number of interface output steps held in memory between writes to the interface Exodus file
+  if(params->isParameter("Interface Output Buffer Steps")){
+    interfaceOutputBufferSteps = params->get<int>("Interface Output Buffer Steps");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(interfaceOutputBufferSteps < 1, "**** Error:  \"Interface Output Buffer Steps\" must be at least one.\n");
+  }
+
+  // Read a single serial mesh file on all processors and decompose it in code,
+  // as opposed to reading a set of files pre-decomposed with decomp or loadbal
+  if(params->isParameter("Decompose Serial Mesh")){
+    decomposeSerialMesh = params->get<bool>("Decompose Serial Mesh");
+  }
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(decomposeSerialMesh && numPID != 1 && storeExodusMesh,
+                              "**** Error:  \"Decompose Serial Mesh\" is not compatible with \"Store Exodus Mesh\", \"Compute Element-Horizon Intersections\", \"Construct Interfaces\", or \"Extract Skin Facets\".\n");
 
   // Set up bond filters
   createBondFilters(params);
 
   // Load data from mesh file
-  loadData(meshFileName);
+  if(decomposeSerialMesh && numPID != 1)
+    loadSerialData(meshFileName);
+  else
+    loadData(meshFileName);
   
   if(computeIntersections)
     maxElementDimension = computeMaxElementDimension();
@@ -169,6 +197,9 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
   if(constructInterfaces)
     constructInterfaceData();
 
+  if(extractSkinFacets)
+    extractSkinFacetData();
+
   // Create the three-dimensional overlap map based on the one-dimensional overlap map
   threeDimensionalOverlapMap = Teuchos::rcp(new Epetra_BlockMap(-1, 
                                                                 oneDimensionalOverlapMap->NumMyElements(),
@@ -617,6 +648,397 @@ void PeridigmNS::ExodusDiscretization::loadData(const string& meshFileName)
   if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadData()", "ex_close");
 }
 
+void PeridigmNS::ExodusDiscretization::loadSerialData(const string& meshFileName)
+{
+  // Open the genesis file (all processors open the same file)
+  int compWordSize = sizeof(double);
+  int ioWordSize = 0;
+  float exodusVersion;
+  int exodusFileId = ex_open(meshFileName.c_str(), EX_READ, &compWordSize, &ioWordSize, &exodusVersion);
+  if(exodusFileId < 0){
+    cout << "\n****Error on processor " << myPID << ": unable to open file " << meshFileName.c_str() << "\n" << endl;
+    reportExodusError(exodusFileId, "ExodusDiscretization::loadSerialData()", "ex_open");
+  }
+
+  // Read the initialization parameters
+  int numDim, numNodes, numElem, numElemBlocks, numNodeSets, numSideSets;
+  char title[MAX_LINE_LENGTH];
+  int retval = ex_get_init(exodusFileId, title, &numDim, &numNodes, &numElem, &numElemBlocks, &numNodeSets, &numSideSets);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_init");
+
+  // Each processor reads a contiguous range of elements, elements are numbered
+  // consecutively across the element blocks in the order they appear in the file
+  int numMyElem = numElem/numPID;
+  int remainder = numElem%numPID;
+  int myFirstElem = numMyElem*myPID + std::min(static_cast<int>(myPID), remainder);
+  if(static_cast<int>(myPID) < remainder)
+    numMyElem += 1;
+
+  // Global element numbering for the elements in this processor's range
+  vector<int> elemIdMap(numMyElem);
+  if(numMyElem > 0){
+    retval = ex_get_partial_id_map(exodusFileId, EX_ELEM_MAP, myFirstElem + 1, numMyElem, &elemIdMap[0]);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_partial_id_map");
+  }
+
+  // Use the original_global_id_map, if provided (see loadData())
+  int numNodeMaps, numElemMaps;
+  retval = ex_get_map_param(exodusFileId, &numNodeMaps, &numElemMaps);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_map_param");
+  if(numElemMaps > 0){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numElemMaps > 1,
+                                "**** Error in ExodusDiscretization::loadSerialData(), genesis file contains invalid number of auxiliary element maps (>1).\n");
+    char mapName[MAX_STR_LENGTH];
+    retval = ex_get_name(exodusFileId, EX_ELEM_MAP, 1, mapName);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_name");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(string(mapName) != string("original_global_id_map"),
+                                "**** Error in ExodusDiscretization::loadSerialData(), unknown exodus EX_ELEM_MAP: " + string(mapName) + ".\n");
+    if(numMyElem > 0){
+      retval = ex_get_partial_num_map(exodusFileId, EX_ELEM_MAP, 1, myFirstElem + 1, numMyElem, &elemIdMap[0]);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_partial_num_map");
+    }
+  }
+  for(int i=0 ; i<numMyElem ; ++i)
+    elemIdMap[i] -= 1; // Note the switch from 1-based indexing to 0-based indexing
+
+  // Process the element blocks, reading connectivity only for the elements in this processor's range
+  vector<int> elemBlockIds(numElemBlocks);
+  retval = ex_get_elem_blk_ids(exodusFileId, &elemBlockIds[0]);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_elem_blk_ids");
+
+  map<int, string> elemBlockNames;
+  vector<int> elemBlockFirstElem(numElemBlocks), elemBlockNumMyElem(numElemBlocks), elemBlockNumNodesPerElem(numElemBlocks), elemBlockNumAttributes(numElemBlocks);
+  vector<ExodusElementType> elemBlockTypes(numElemBlocks, UNKNOWN_ELEMENT);
+  vector< vector<int> > elemBlockConn(numElemBlocks);
+  vector< vector<double> > elemBlockAttributes(numElemBlocks);
+  vector<int> myNodeIds;
+  int blockOffset(0);
+  for(int iElemBlock=0 ; iElemBlock<numElemBlocks ; iElemBlock++){
+
+    int elemBlockId = elemBlockIds[iElemBlock];
+
+    // Get the block name, if there is one
+    char exodusElemBlockName[MAX_STR_LENGTH];
+    retval = ex_get_name(exodusFileId, EX_ELEM_BLOCK, elemBlockId, exodusElemBlockName);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_name");
+    string elemBlockName(exodusElemBlockName);
+    if(elemBlockName.size() == 0){
+      stringstream ss;
+      ss << "block_" << elemBlockId;
+      elemBlockName = ss.str();
+    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(elementBlocks->find(elemBlockName) != elementBlocks->end(), "**** Duplicate block found: " + elemBlockName + "\n");
+    // Every processor has an entry for every block, even if it owns no elements in that block
+    (*elementBlocks)[elemBlockName] = vector<int>();
+    elemBlockNames[elemBlockId] = elemBlockName;
+
+    char elemType[MAX_STR_LENGTH];
+    int numElemThisBlock, numNodesPerElem, numAttributes;
+    retval = ex_get_elem_block(exodusFileId, elemBlockId, elemType, &numElemThisBlock, &numNodesPerElem, &numAttributes);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_elem_block");
+    elemBlockNumNodesPerElem[iElemBlock] = numNodesPerElem;
+    elemBlockNumAttributes[iElemBlock] = numAttributes;
+
+    // Intersection of this block with this processor's element range
+    int first = std::max(blockOffset, myFirstElem);
+    int last = std::min(blockOffset + numElemThisBlock, myFirstElem + numMyElem);
+    elemBlockFirstElem[iElemBlock] = first - myFirstElem;
+    elemBlockNumMyElem[iElemBlock] = std::max(last - first, 0);
+    blockOffset += numElemThisBlock;
+
+    int numMyElemThisBlock = elemBlockNumMyElem[iElemBlock];
+    if(numMyElemThisBlock > 0){
+      string elemTypeString(elemType);
+      boost::to_upper(elemTypeString);
+      if(elemTypeString == string("SPHERE"))
+        elemBlockTypes[iElemBlock] = SPHERE_ELEMENT;
+      else if(elemTypeString == string("TET") || elemTypeString == string("TETRA") || elemTypeString == string("TET4") || elemTypeString == string("TET10"))
+        elemBlockTypes[iElemBlock] = TET_ELEMENT;
+      else if(elemTypeString == string("HEX") || elemTypeString == string("HEX8") || elemTypeString == string("HEX20"))
+        elemBlockTypes[iElemBlock] = HEX_ELEMENT;
+      else{
+        string msg = "\n**** Error in loadSerialData(), unknown element type " + elemTypeString + ".\n";
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(true, msg);
+      }
+      int startInBlock = first - (blockOffset - numElemThisBlock) + 1; // 1-based
+      vector<int>& conn = elemBlockConn[iElemBlock];
+      conn.resize(numMyElemThisBlock*numNodesPerElem);
+      retval = ex_get_partial_conn(exodusFileId, EX_ELEM_BLOCK, elemBlockId, startInBlock, numMyElemThisBlock, &conn[0], NULL, NULL);
+      if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_partial_conn");
+      for(unsigned int i=0 ; i<conn.size() ; ++i){
+        conn[i] -= 1; // Note the switch from 1-based indexing to 0-based indexing
+        myNodeIds.push_back(conn[i]);
+      }
+      if(elemBlockTypes[iElemBlock] == SPHERE_ELEMENT){
+        vector<double>& attributes = elemBlockAttributes[iElemBlock];
+        attributes.resize(numMyElemThisBlock*numAttributes);
+        retval = ex_get_partial_attr(exodusFileId, EX_ELEM_BLOCK, elemBlockId, startInBlock, numMyElemThisBlock, &attributes[0]);
+        if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_partial_attr");
+      }
+    }
+  }
+
+  // The nodes referenced by this processor's elements, the connectivity is converted to indices into this list
+  std::sort(myNodeIds.begin(), myNodeIds.end());
+  myNodeIds.erase(std::unique(myNodeIds.begin(), myNodeIds.end()), myNodeIds.end());
+  int numMyNodes = static_cast<int>(myNodeIds.size());
+  for(int iElemBlock=0 ; iElemBlock<numElemBlocks ; iElemBlock++){
+    vector<int>& conn = elemBlockConn[iElemBlock];
+    for(unsigned int i=0 ; i<conn.size() ; ++i)
+      conn[i] = static_cast<int>(std::lower_bound(myNodeIds.begin(), myNodeIds.end(), conn[i]) - myNodeIds.begin());
+  }
+
+  // Node coordinates for the referenced nodes, read in chunks of consecutive node ids
+  // Chunks separated by fewer than maxNodeIdGap unreferenced nodes are merged to limit the number of reads
+  const int maxNodeIdGap = 256;
+  vector<double> exodusNodeCoordX(numMyNodes), exodusNodeCoordY(numMyNodes), exodusNodeCoordZ(numMyNodes);
+  vector<double> chunkX, chunkY, chunkZ;
+  int chunkBegin(0);
+  while(chunkBegin < numMyNodes){
+    int chunkEnd = chunkBegin + 1;
+    while(chunkEnd < numMyNodes && myNodeIds[chunkEnd] - myNodeIds[chunkEnd-1] <= maxNodeIdGap)
+      chunkEnd++;
+    int firstNodeId = myNodeIds[chunkBegin];
+    int numChunkNodes = myNodeIds[chunkEnd-1] - firstNodeId + 1;
+    chunkX.resize(numChunkNodes);
+    chunkY.resize(numChunkNodes);
+    chunkZ.resize(numChunkNodes);
+    retval = ex_get_partial_coord(exodusFileId, firstNodeId + 1, numChunkNodes, &chunkX[0], &chunkY[0], &chunkZ[0]);
+    if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_get_partial_coord");
+    for(int i=chunkBegin ; i<chunkEnd ; ++i){
+      int chunkIndex = myNodeIds[i] - firstNodeId;
+      exodusNodeCoordX[i] = chunkX[chunkIndex];
+      exodusNodeCoordY[i] = chunkY[chunkIndex];
+      exodusNodeCoordZ[i] = chunkZ[chunkIndex];
+    }
+    chunkBegin = chunkEnd;
+  }
+  vector<double>().swap(chunkX);
+  vector<double>().swap(chunkY);
+  vector<double>().swap(chunkZ);
+
+  // Convert elements to spheres in the initial (file-order) decomposition
+  int dimension = 3;
+  QUICKGRID::Data decomp = QUICKGRID::allocatePdGridData(numMyElem, dimension);
+  int numGlobalElements(0);
+  comm->SumAll(&numMyElem, &numGlobalElements, 1);
+  decomp.globalNumPoints = numGlobalElements;
+  int* decompGlobalIds = decomp.myGlobalIDs.get();
+  double* decompX = decomp.myX.get();
+  double* decompVolume = decomp.cellVolume.get();
+  for(int i=0 ; i<numMyElem ; ++i)
+    decompGlobalIds[i] = elemIdMap[i];
+
+  Epetra_BlockMap tempOneDimensionalMap(-1, numMyElem, numMyElem > 0 ? &elemIdMap[0] : 0, 1, 0, *comm);
+  Epetra_Vector tempBlockID(tempOneDimensionalMap);
+
+  bool tenNodedTetWarningGiven(false), twentyNodedHexWarningGiven(false);
+  for(int iElemBlock=0 ; iElemBlock<numElemBlocks ; iElemBlock++){
+    int numNodesPerElem = elemBlockNumNodesPerElem[iElemBlock];
+    int numAttributes = elemBlockNumAttributes[iElemBlock];
+    ExodusElementType exodusElementType = elemBlockTypes[iElemBlock];
+    const vector<int>& conn = elemBlockConn[iElemBlock];
+    const vector<double>& attributes = elemBlockAttributes[iElemBlock];
+    if(exodusElementType == TET_ELEMENT && numNodesPerElem == 10 && !tenNodedTetWarningGiven){
+      cout << "**** Warning on processor " << myPID
+           << ", side nodes being discarded for 10-node tetrahedron element, will be treated as 4-node tetrahedron element." << endl;
+      tenNodedTetWarningGiven = true;
+    }
+    if(exodusElementType == HEX_ELEMENT && numNodesPerElem == 20 && !twentyNodedHexWarningGiven){
+      cout << "**** Warning on processor " << myPID
+           << ", side nodes being discarded for 20-node hexahedron element, will be treated as 8-node hexahedron element." << endl;
+      twentyNodedHexWarningGiven = true;
+    }
+    vector<double> nodeCoordinates(3*numNodesPerElem);
+    for(int iElem=0 ; iElem<elemBlockNumMyElem[iElemBlock] ; iElem++){
+      for(int i=0 ; i<numNodesPerElem ; ++i){
+        int nodeId = conn[iElem*numNodesPerElem + i];
+        nodeCoordinates[3*i] = exodusNodeCoordX[nodeId];
+        nodeCoordinates[3*i+1] = exodusNodeCoordY[nodeId];
+        nodeCoordinates[3*i+2] = exodusNodeCoordZ[nodeId];
+      }
+      double volume(0.0);
+      vector<double> coord(3);
+      if(exodusElementType == SPHERE_ELEMENT){
+        coord[0] = nodeCoordinates[0];
+        coord[1] = nodeCoordinates[1];
+        coord[2] = nodeCoordinates[2];
+        volume = attributes[iElem*numAttributes + 1];
+      }
+      else if(exodusElementType == TET_ELEMENT)
+        tetCentroidAndVolume(&nodeCoordinates[0], &coord[0], &volume);
+      else if(exodusElementType == HEX_ELEMENT)
+        hexCentroidAndVolume(&nodeCoordinates[0], &coord[0], &volume);
+
+      int localElemId = elemBlockFirstElem[iElemBlock] + iElem;
+      tempBlockID[localElemId] = elemBlockIds[iElemBlock];
+      decompVolume[localElemId] = volume;
+      decompX[3*localElemId] = coord[0];
+      decompX[3*localElemId+1] = coord[1];
+      decompX[3*localElemId+2] = coord[2];
+    }
+  }
+
+  // Node sets are read on processor 0 and broadcast, each processor converts them to the sphere mesh in the
+  // initial decomposition and records them as flags so that they can be migrated along with the points
+  nodeSets = Teuchos::rcp< map<string, vector<int> > >(new map<string, vector<int> >() );
+  nodeSetIds = Teuchos::rcp< map<string, int> >(new map<string, int>() );
+  Teuchos::RCP<Epetra_MultiVector> tempNodeSetFlags;
+  if(numNodeSets > 0){
+
+    // The node sets are packed as (id, name length, name, number of nodes, 1-based node ids), and the header holds
+    // the exodus error code and failing call on processor 0, so that all processors report a read error
+    const char* nodeSetExodusCalls[] = {"ex_get_node_set_ids", "ex_get_name", "ex_get_node_set_param", "ex_get_node_set"};
+    int nodeSetHeader[3] = {0, 0, 0};
+    vector<int> nodeSetBuffer;
+    if(myPID == 0){
+      vector<int> exodusNodeSetIds(numNodeSets);
+      retval = ex_get_node_set_ids(exodusFileId, &exodusNodeSetIds[0]);
+      if(retval < 0){ nodeSetHeader[0] = retval; nodeSetHeader[1] = 0; }
+      else if(retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", nodeSetExodusCalls[0]);
+      for(int i=0 ; i<numNodeSets && nodeSetHeader[0] == 0 ; ++i){
+        int nodeSetId = exodusNodeSetIds[i];
+        char exodusNodeSetName[MAX_STR_LENGTH];
+        retval = ex_get_name(exodusFileId, EX_NODE_SET, nodeSetId, exodusNodeSetName);
+        if(retval < 0){ nodeSetHeader[0] = retval; nodeSetHeader[1] = 1; break; }
+        else if(retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", nodeSetExodusCalls[1]);
+        int numNodesInSet, numDistributionFactorsInSet;
+        retval = ex_get_node_set_param(exodusFileId, nodeSetId, &numNodesInSet, &numDistributionFactorsInSet);
+        if(retval < 0){ nodeSetHeader[0] = retval; nodeSetHeader[1] = 2; break; }
+        else if(retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", nodeSetExodusCalls[2]);
+        string nodeSetName(exodusNodeSetName);
+        nodeSetBuffer.push_back(nodeSetId);
+        nodeSetBuffer.push_back(static_cast<int>(nodeSetName.size()));
+        nodeSetBuffer.insert(nodeSetBuffer.end(), nodeSetName.begin(), nodeSetName.end());
+        nodeSetBuffer.push_back(numNodesInSet);
+        if(numNodesInSet > 0){
+          nodeSetBuffer.resize(nodeSetBuffer.size() + numNodesInSet);
+          retval = ex_get_node_set(exodusFileId, nodeSetId, &nodeSetBuffer[nodeSetBuffer.size() - numNodesInSet]);
+          if(retval < 0){ nodeSetHeader[0] = retval; nodeSetHeader[1] = 3; break; }
+          else if(retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", nodeSetExodusCalls[3]);
+        }
+      }
+      nodeSetHeader[2] = static_cast<int>(nodeSetBuffer.size());
+    }
+    comm->Broadcast(nodeSetHeader, 3, 0);
+    if(nodeSetHeader[0] != 0)
+      reportExodusError(nodeSetHeader[0], "ExodusDiscretization::loadSerialData()", nodeSetExodusCalls[nodeSetHeader[1]]);
+    nodeSetBuffer.resize(nodeSetHeader[2]);
+    if(nodeSetHeader[2] > 0)
+      comm->Broadcast(&nodeSetBuffer[0], nodeSetHeader[2], 0);
+
+    // Unpack the node sets, the node lists are kept as offsets into the buffer
+    map<string, int> nodeSetBufferOffsets;
+    unsigned int position(0);
+    for(int i=0 ; i<numNodeSets ; ++i){
+      int nodeSetId = nodeSetBuffer[position++];
+      int nameLength = nodeSetBuffer[position++];
+      string nodeSetName(nodeSetBuffer.begin() + position, nodeSetBuffer.begin() + position + nameLength);
+      position += nameLength;
+      if(nodeSetName.size() == 0){
+        stringstream ss;
+        ss << "nodelist_" << nodeSetId;
+        nodeSetName = ss.str();
+      }
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) != nodeSets->end(), "**** Duplicate node set found: " + nodeSetName + "\n");
+      (*nodeSets)[nodeSetName] = vector<int>();
+      (*nodeSetIds)[nodeSetName] = nodeSetId;
+      nodeSetBufferOffsets[nodeSetName] = position;
+      position += nodeSetBuffer[position] + 1;
+    }
+
+    // For each node referenced by this processor, record the local elements that it belongs to
+    vector< vector<int> > elementsThatNodeBelongsTo(numMyNodes);
+    for(int iElemBlock=0 ; iElemBlock<numElemBlocks ; ++iElemBlock){
+      int numNodesPerElem = elemBlockNumNodesPerElem[iElemBlock];
+      const vector<int>& conn = elemBlockConn[iElemBlock];
+      for(int iElem=0 ; iElem<elemBlockNumMyElem[iElemBlock] ; iElem++){
+        int localElemId = elemBlockFirstElem[iElemBlock] + iElem;
+        for(int i=0 ; i<numNodesPerElem ; i++)
+          elementsThatNodeBelongsTo[conn[iElem*numNodesPerElem + i]].push_back(localElemId);
+      }
+    }
+
+    tempNodeSetFlags = Teuchos::rcp(new Epetra_MultiVector(tempOneDimensionalMap, numNodeSets));
+    int column(0);
+    for(map<string, int>::iterator it = nodeSetIds->begin() ; it != nodeSetIds->end() ; it++, column++){
+      int offset = nodeSetBufferOffsets[it->first];
+      int numNodesInSet = nodeSetBuffer[offset];
+      const int* nodeSetNodeList = numNodesInSet > 0 ? &nodeSetBuffer[offset + 1] : 0;
+      double* flags = (*tempNodeSetFlags)[column];
+      for(int i=0 ; i<numNodesInSet ; ++i){
+        int exodusNodeId = nodeSetNodeList[i] - 1; // Note the switch from 1-based indexing to 0-based indexing
+        vector<int>::const_iterator nodeIt = std::lower_bound(myNodeIds.begin(), myNodeIds.end(), exodusNodeId);
+        if(nodeIt == myNodeIds.end() || *nodeIt != exodusNodeId)
+          continue;
+        const vector<int>& elements = elementsThatNodeBelongsTo[nodeIt - myNodeIds.begin()];
+        for(unsigned int j=0 ; j<elements.size() ; ++j)
+          flags[elements[j]] = 1.0;
+      }
+    }
+  }
+
+  if(verbose && myPID == 0){
+    stringstream ss;
+    ss << "\nGenesis file " << meshFileName << " (decomposed in code)" << endl;
+    ss << "  title " << title << endl;
+    ss << "  number of dimensions " << numDim << endl;
+    ss << "  number of nodes " << numNodes << endl;
+    ss << "  number of elements " << numElem << endl;
+    ss << "  number of blocks " << numElemBlocks << endl;
+    ss << "  number of node sets " << numNodeSets << endl;
+    ss << "  number of side sets (ignored) " << numSideSets << endl;
+    cout << ss.str() << endl;
+  }
+
+  // Close the genesis file
+  retval = ex_close(exodusFileId);
+  if (retval != 0) reportExodusError(retval, "ExodusDiscretization::loadSerialData()", "ex_close");
+
+  // Free the file-order data before load balancing
+  vector< vector<int> >().swap(elemBlockConn);
+  vector< vector<double> >().swap(elemBlockAttributes);
+  vector<double>().swap(exodusNodeCoordX);
+  vector<double>().swap(exodusNodeCoordY);
+  vector<double>().swap(exodusNodeCoordZ);
+
+  // Load balance the points with Zoltan RCB
+  decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+
+  // Create the owned maps in the rebalanced configuration
+  oneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(decomp.globalNumPoints, decomp.numPoints, decomp.myGlobalIDs.get(), 1, 0, *comm));
+  threeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(decomp.globalNumPoints, decomp.numPoints, decomp.myGlobalIDs.get(), 3, 0, *comm));
+
+  initialX = Teuchos::rcp(new Epetra_Vector(Copy, *threeDimensionalMap, decomp.myX.get()));
+  cellVolume = Teuchos::rcp(new Epetra_Vector(Copy, *oneDimensionalMap, decomp.cellVolume.get()));
+
+  // Migrate the block ids and node set flags to the rebalanced configuration
+  Epetra_Import rebalancedImporter(*oneDimensionalMap, tempOneDimensionalMap);
+  blockID = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+  blockID->Import(tempBlockID, rebalancedImporter, Insert);
+
+  for(int i=0 ; i<blockID->MyLength() ; ++i){
+    map<int, string>::const_iterator it = elemBlockNames.find(static_cast<int>((*blockID)[i]));
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(it == elemBlockNames.end(),
+                                "\n**** Error in ExodusDiscretization::loadSerialData(), invalid block id.\n");
+    (*elementBlocks)[it->second].push_back(oneDimensionalMap->GID(i));
+  }
+
+  if(numNodeSets > 0){
+    Epetra_MultiVector nodeSetFlags(*oneDimensionalMap, numNodeSets);
+    nodeSetFlags.Import(*tempNodeSetFlags, rebalancedImporter, Insert);
+    int column(0);
+    for(map<string, int>::iterator it = nodeSetIds->begin() ; it != nodeSetIds->end() ; it++, column++){
+      vector<int>& nodeSet = (*nodeSets)[it->first];
+      const double* flags = nodeSetFlags[column];
+      for(int i=0 ; i<nodeSetFlags.MyLength() ; ++i){
+        if(flags[i] != 0.0)
+          nodeSet.push_back(oneDimensionalMap->GID(i));
+      }
+    }
+  }
+}
+
 void
 PeridigmNS::ExodusDiscretization::constructInterfaceData()
 {
@@ -705,7 +1127,104 @@ PeridigmNS::ExodusDiscretization::constructInterfaceData()
   // now create the interface data and populate it
   interfaceData->Initialize(leftElements, rightElements, numNodes, interfaceNodesVec, comm);
   // generate an exodus file for output:
-  interfaceData->InitializeExodusOutput(exodusMeshElementConnectivity,exodusMeshNodePositions);
+  interfaceData->InitializeExodusOutput(exodusMeshElementConnectivity,exodusMeshNodePositions,interfaceOutputBufferSteps);
+}
+
+void
+PeridigmNS::ExodusDiscretization::extractSkinFacetData()
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(storeExodusMesh!=true,logic_error," Exodus mesh should have been stored if this is called.");
+
+  // faces of the hex and tet elements in exodus side ordering
+  const int hexFaces[6][4] = {{0,1,5,4},{1,2,6,5},{2,3,7,6},{0,4,7,3},{0,3,2,1},{4,5,6,7}};
+  const int tetFaces[4][3] = {{0,1,3},{1,2,3},{0,3,2},{0,2,1}};
+
+  const Epetra_BlockMap& connectivityMap = exodusMeshElementConnectivity->Map();
+  const Epetra_BlockMap& nodePositionsMap = exodusMeshNodePositions->Map();
+
+  // Count the elements attached to each face, keyed by the sorted node ids of the face
+  // The connectivity has been ghosted, so faces shared with off-processor elements within the horizon are detected
+  map<vector<int>, int> faceCount;
+  vector<int> faceNodes;
+  for(int elemIndex=0 ; elemIndex<connectivityMap.NumMyElements() ; ++elemIndex){
+    const int numNodesPerElem = connectivityMap.ElementSize(elemIndex);
+    const int firstIndex = connectivityMap.FirstPointInElement(elemIndex);
+    const int numFaces = (numNodesPerElem == 8) ? 6 : (numNodesPerElem == 4 ? 4 : 0);
+    const int numNodesPerFace = (numNodesPerElem == 8) ? 4 : 3;
+    for(int iFace=0 ; iFace<numFaces ; ++iFace){
+      faceNodes.resize(numNodesPerFace);
+      for(int n=0 ; n<numNodesPerFace ; ++n){
+        int localNode = (numNodesPerElem == 8) ? hexFaces[iFace][n] : tetFaces[iFace][n];
+        faceNodes[n] = static_cast<int>( (*exodusMeshElementConnectivity)[firstIndex + localNode] );
+      }
+      sort(faceNodes.begin(), faceNodes.end());
+      faceCount[faceNodes] += 1;
+    }
+  }
+
+  // Triangulate the unshared faces of the locally-owned elements, winding each triangle so that its normal points out of the element
+  skinFacetData = Teuchos::rcp(new PeridigmNS::SkinFacetData);
+  vector<double> positions;
+  for(int elemIndex=0 ; elemIndex<oneDimensionalMap->NumMyElements() ; ++elemIndex){
+    const int globalId = oneDimensionalMap->GID(elemIndex);
+    const int connectivityIndex = connectivityMap.LID(globalId);
+    const int numNodesPerElem = connectivityMap.ElementSize(connectivityIndex);
+    const int firstIndex = connectivityMap.FirstPointInElement(connectivityIndex);
+    const int numFaces = (numNodesPerElem == 8) ? 6 : (numNodesPerElem == 4 ? 4 : 0);
+    const int numNodesPerFace = (numNodesPerElem == 8) ? 4 : 3;
+    if(numFaces == 0)
+      continue;
+
+    // element node positions and centroid
+    positions.resize(3*numNodesPerElem);
+    double centroid[3] = {0.0, 0.0, 0.0};
+    for(int n=0 ; n<numNodesPerElem ; ++n){
+      int nodeLocalId = nodePositionsMap.LID( static_cast<int>( (*exodusMeshElementConnectivity)[firstIndex + n] ) );
+      for(int dof=0 ; dof<3 ; ++dof){
+        positions[3*n+dof] = (*exodusMeshNodePositions)[3*nodeLocalId+dof];
+        centroid[dof] += positions[3*n+dof]/numNodesPerElem;
+      }
+    }
+
+    for(int iFace=0 ; iFace<numFaces ; ++iFace){
+      int localNodes[4];
+      faceNodes.resize(numNodesPerFace);
+      for(int n=0 ; n<numNodesPerFace ; ++n){
+        localNodes[n] = (numNodesPerElem == 8) ? hexFaces[iFace][n] : tetFaces[iFace][n];
+        faceNodes[n] = static_cast<int>( (*exodusMeshElementConnectivity)[firstIndex + localNodes[n]] );
+      }
+      sort(faceNodes.begin(), faceNodes.end());
+      if(faceCount[faceNodes] != 1)
+        continue;
+
+      // quadrilateral faces are split into two triangles
+      const int numTriangles = numNodesPerFace - 2;
+      for(int iTri=0 ; iTri<numTriangles ; ++iTri){
+        const double* v1 = &positions[3*localNodes[0]];
+        const double* v2 = &positions[3*localNodes[iTri+1]];
+        const double* v3 = &positions[3*localNodes[iTri+2]];
+        double normal[3], outward[3];
+        normal[0] = (v2[1]-v1[1])*(v3[2]-v1[2]) - (v2[2]-v1[2])*(v3[1]-v1[1]);
+        normal[1] = (v2[2]-v1[2])*(v3[0]-v1[0]) - (v2[0]-v1[0])*(v3[2]-v1[2]);
+        normal[2] = (v2[0]-v1[0])*(v3[1]-v1[1]) - (v2[1]-v1[1])*(v3[0]-v1[0]);
+        for(int dof=0 ; dof<3 ; ++dof)
+          outward[dof] = (v1[dof] + v2[dof] + v3[dof])/3.0 - centroid[dof];
+        int blockId = static_cast<int>( (*blockID)[elemIndex] );
+        if(normal[0]*outward[0] + normal[1]*outward[1] + normal[2]*outward[2] >= 0.0)
+          skinFacetData->addFacet(globalId, blockId, v1, v2, v3);
+        else
+          skinFacetData->addFacet(globalId, blockId, v1, v3, v2);
+      }
+    }
+  }
+
+  if(verbose){
+    int localNumFacets = skinFacetData->NumFacets();
+    int globalNumFacets = 0;
+    comm->SumAll(&localNumFacets, &globalNumFacets, 1);
+    if(myPID == 0)
+      cout << "Extracted " << globalNumFacets << " skin facets from the Exodus mesh" << endl;
+  }
 }
 
 void
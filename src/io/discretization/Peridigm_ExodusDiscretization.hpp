@@ -104,6 +104,9 @@ namespace PeridigmNS {
     // ! determine if the interface data is available
     virtual bool InterfacesAreConstructed() const{ return constructInterfaces;}
 
+    //! Get the triangulated outer skin of the Exodus mesh for the locally-owned elements
+    virtual Teuchos::RCP<const PeridigmNS::SkinFacetData> getSkinFacets() const { return skinFacetData; }
+
     //! Get the number of bonds on this processor
     virtual unsigned int getNumBonds() const;
 
@@ -142,6 +145,9 @@ namespace PeridigmNS {
     //! Loads mesh data into Epetra_Vectors (initial positions, volumes, block ids) and stores original Exodus node locations and connectivity.
     void loadData(const std::string& meshFileName);
 
+    //! Reads a single (serial) mesh file in parallel, with each processor reading a disjoint range of elements, and then load balances the points with Zoltan RCB.
+    void loadSerialData(const std::string& meshFileName);
+
   protected:
 
     template<class T>
@@ -158,6 +164,9 @@ namespace PeridigmNS {
     //! Create Interfaces between elements
     void constructInterfaceData();
 
+    //! Extract the element faces that are not shared with any other element and triangulate them
+    void extractSkinFacetData();
+
     //! Filter bonds from neighborhood list
     Teuchos::RCP<PeridigmNS::NeighborhoodData> filterBonds(Teuchos::RCP<PeridigmNS::NeighborhoodData> unfilteredNeighborhoodData);
 
@@ -207,9 +216,18 @@ namespace PeridigmNS {
     //! Boolean flag for storing exodus mesh
     bool storeExodusMesh;
 
+    //! Boolean flag for decomposing a single serial mesh file in code (rather than reading pre-decomposed files)
+    bool decomposeSerialMesh;
+
     //! Boolean flag for constructing interfaces
     bool constructInterfaces;
 
+    //! Boolean flag for extracting the outer skin facets of the mesh (used by node-to-facet contact)
+    bool extractSkinFacets;
+
+    //! Number of interface output steps buffered in memory before they are written to disk
+    int interfaceOutputBufferSteps;
+
     //! Boolean flag indicating that element-horizon intersections should be computed
     bool computeIntersections;
 
@@ -228,6 +246,9 @@ namespace PeridigmNS {
     //! Struct containing the interface varaibles and right and left elements
     Teuchos::RCP<PeridigmNS::InterfaceData> interfaceData;
 
+    //! Triangulated outer skin of the mesh for the locally-owned elements
+    Teuchos::RCP<PeridigmNS::SkinFacetData> skinFacetData;
+
     //! Returns number of bonds on this processor
     unsigned int numBonds;
 
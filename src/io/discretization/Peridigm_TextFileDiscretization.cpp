@@ -63,8 +63,10 @@
 
 #include <sstream>
 #include <fstream>
-
-#include <boost/algorithm/string/trim.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
 
 using namespace std;
 
@@ -169,69 +171,120 @@ QUICKGRID::Data PeridigmNS::TextFileDiscretization::getDecomp(const string& text
   vector<double> volumes;
   vector<int> blockIds;
 
-  // Read the text file on the root processor
-  if(myPID == 0){
-    ifstream inFile(textFileName.c_str());
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!inFile.is_open(), "**** Error opening discretization text file.\n");
-    while(inFile.good()){
-      string str;
-      getline(inFile, str);
-      boost::trim(str);
-      // Ignore comment lines, otherwise parse
-      if( !(str[0] == '#' || str[0] == '/' || str[0] == '*' || str.size() == 0) ){
-        istringstream iss(str);
-        vector<double> data;
-        copy(istream_iterator<double>(iss),
-             istream_iterator<double>(),
-             back_inserter<vector<double> >(data));
-        // Check for obvious problems with the data
-        if(data.size() != 5){
-          string msg = "\n**** Error parsing text file, invalid line: " + str + "\n";
-          TEUCHOS_TEST_FOR_EXCEPT_MSG(data.size() != 5, msg);
-        }
-        // Store the coordinates, block id, and volumes
-        coordinates.push_back(data[0]);
-        coordinates.push_back(data[1]);
-        coordinates.push_back(data[2]);
-        blockIds.push_back(static_cast<int>(data[3]));
-        volumes.push_back(data[4]);
+  // Each processor reads a disjoint byte range of the text file and parses the lines that begin in that range.
+  // The points are load balanced with Zoltan afterwards, so no processor ever holds the full point cloud.
+  ifstream inFile(textFileName.c_str(), ios::in | ios::binary);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!inFile.is_open(), "**** Error opening discretization text file.\n");
+  inFile.seekg(0, ios::end);
+  const long long fileSize = static_cast<long long>(inFile.tellg());
+  const long long rangeBegin = (fileSize*myPID)/numPID;
+  const long long rangeEnd = (fileSize*(myPID+1))/numPID;
+
+  string buffer;
+  if(rangeEnd > rangeBegin){
+    buffer.resize(static_cast<size_t>(rangeEnd - rangeBegin));
+    inFile.seekg(static_cast<streamoff>(rangeBegin), ios::beg);
+    inFile.read(&buffer[0], static_cast<streamsize>(buffer.size()));
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(inFile.gcount() != static_cast<streamsize>(buffer.size()), "**** Error reading discretization text file.\n");
+    // Complete the last line, which may extend into the next processor's range
+    if(buffer[buffer.size()-1] != '\n'){
+      string remainder;
+      getline(inFile, remainder);
+      buffer += remainder;
+    }
+  }
+  // A line that begins in the previous processor's range is parsed by that processor
+  size_t position = 0;
+  if(rangeBegin > 0 && rangeEnd > rangeBegin){
+    char previousCharacter('\n');
+    inFile.clear();
+    inFile.seekg(static_cast<streamoff>(rangeBegin - 1), ios::beg);
+    inFile.get(previousCharacter);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!inFile, "**** Error reading discretization text file.\n");
+    if(previousCharacter != '\n'){
+      position = buffer.find('\n');
+      position = (position == string::npos) ? buffer.size() : position + 1;
+    }
+  }
+  inFile.close();
+
+  // Parse the lines, ignoring blank lines and comment lines
+  const char* const bufferEnd = buffer.data() + buffer.size();
+  const char* lineBegin = buffer.data() + position;
+  while(lineBegin < bufferEnd){
+    const char* lineEnd = static_cast<const char*>(memchr(lineBegin, '\n', bufferEnd - lineBegin));
+    if(lineEnd == 0)
+      lineEnd = bufferEnd;
+    const char* c = lineBegin;
+    while(c < lineEnd && isspace(static_cast<unsigned char>(*c)))
+      c++;
+    if( !(c == lineEnd || *c == '#' || *c == '/' || *c == '*') ){
+      // strtod() stops at the newline, so it never reads past the end of the line
+      double data[5];
+      int numValues = 0;
+      char* next;
+      while(numValues < 5){
+        data[numValues] = strtod(c, &next);
+        if(next == c || next > lineEnd)
+          break;
+        numValues++;
+        c = next;
+      }
+      while(c < lineEnd && isspace(static_cast<unsigned char>(*c)))
+        c++;
+      // Check for obvious problems with the data
+      if(numValues != 5 || c != lineEnd){
+        string msg = "\n**** Error parsing text file, invalid line: " + string(lineBegin, lineEnd) + "\n";
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(true, msg);
       }
+      // Store the coordinates, block id, and volumes
+      coordinates.push_back(data[0]);
+      coordinates.push_back(data[1]);
+      coordinates.push_back(data[2]);
+      blockIds.push_back(static_cast<int>(data[3]));
+      volumes.push_back(data[4]);
     }
-    inFile.close();
+    lineBegin = lineEnd + 1;
   }
+  string().swap(buffer);
 
   int numElements = static_cast<int>(blockIds.size());
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(myPID == 0 && numElements < 1, "**** Error reading discretization text file, no data found.\n");
 
-  // Record the block ids on the root processor
-  set<int> uniqueBlockIds;
-  if(myPID == 0){
-    for(unsigned int i=0 ; i<blockIds.size() ; ++i)
-      uniqueBlockIds.insert(blockIds[i]);
-  }
-
-  // Broadcast necessary data from root processor
   Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
   int numGlobalElements;
   reduceAll(*teuchosComm, Teuchos::REDUCE_SUM, 1, &numElements, &numGlobalElements);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numGlobalElements < 1, "**** Error reading discretization text file, no data found.\n");
+
+  // Global ids follow the order of the points in the file
+  int globalIdOffset;
+  scan(*teuchosComm, Teuchos::REDUCE_SUM, 1, &numElements, &globalIdOffset);
+  globalIdOffset -= numElements;
 
-  // Broadcast the unique block ids so that all processors are aware of the full block list
+  // Determine the full list of block ids so that all processors are aware of the full block list
   // This is necessary because if a processor does not have any elements for a given block, it will be unaware the
   // given block exists, which causes problems downstream
-  int numLocalUniqueBlockIds = static_cast<int>( uniqueBlockIds.size() );
-  int numGlobalUniqueBlockIds;
-  reduceAll(*teuchosComm, Teuchos::REDUCE_SUM, 1, &numLocalUniqueBlockIds, &numGlobalUniqueBlockIds);
-  vector<int> uniqueLocalBlockIds(numGlobalUniqueBlockIds, 0);
-  int index = 0;
-  for(set<int>::const_iterator it = uniqueBlockIds.begin() ; it != uniqueBlockIds.end() ; it++)
-    uniqueLocalBlockIds[index++] = *it;
-  vector<int> uniqueGlobalBlockIds(numGlobalUniqueBlockIds);  
-  reduceAll(*teuchosComm, Teuchos::REDUCE_SUM, numGlobalUniqueBlockIds, &uniqueLocalBlockIds[0], &uniqueGlobalBlockIds[0]);
+  // The sorted unique block ids of each processor are gathered, padded to the longest list
+  vector<int> localBlockIds(blockIds);
+  sort(localBlockIds.begin(), localBlockIds.end());
+  localBlockIds.erase(unique(localBlockIds.begin(), localBlockIds.end()), localBlockIds.end());
+  int numLocalBlockIds = static_cast<int>(localBlockIds.size());
+  vector<int> numBlockIdsPerProc(numPID);
+  gatherAll(*teuchosComm, 1, &numLocalBlockIds, numPID, &numBlockIdsPerProc[0]);
+  int maxNumBlockIds = *max_element(numBlockIdsPerProc.begin(), numBlockIdsPerProc.end());
+  localBlockIds.resize(maxNumBlockIds, 0);
+  vector<int> allBlockIds(numPID*maxNumBlockIds);
+  if(maxNumBlockIds > 0)
+    gatherAll(*teuchosComm, maxNumBlockIds, &localBlockIds[0], numPID*maxNumBlockIds, &allBlockIds[0]);
+  vector<int> uniqueGlobalBlockIds;
+  for(int proc=0 ; proc<numPID ; ++proc)
+    uniqueGlobalBlockIds.insert(uniqueGlobalBlockIds.end(), allBlockIds.begin() + proc*maxNumBlockIds, allBlockIds.begin() + proc*maxNumBlockIds + numBlockIdsPerProc[proc]);
+  sort(uniqueGlobalBlockIds.begin(), uniqueGlobalBlockIds.end());
+  uniqueGlobalBlockIds.erase(unique(uniqueGlobalBlockIds.begin(), uniqueGlobalBlockIds.end()), uniqueGlobalBlockIds.end());
 
   // Create list of global ids
   vector<int> globalIds(numElements);
   for(unsigned int i=0 ; i<globalIds.size() ; ++i)
-    globalIds[i] = i;
+    globalIds[i] = globalIdOffset + i;
 
   // Copy data into a decomp object
   int dimension = 3;
@@ -6,7 +6,9 @@
 #else
 #include <malloc.h>
 #endif
+#include <sys/resource.h>
 #include <iostream>
+#include <iomanip>
 #include <vector>
 
 #include <Teuchos_CommHelpers.hpp>
@@ -49,59 +51,105 @@ void PeridigmNS::Memstat::addStat(const std::string & description){
 //  size_t heap_size = (unsigned int) minfo.uordblks + (unsigned int) minfo.hblkhd;
 
   // if the descriptor already exists, update it if the memory use is higher
-  std::map<std::string, unsigned int>::iterator it = stats.find(description);
+  std::map<std::string, double>::iterator it = stats.find(description);
   if (it != stats.end()){
     if(heap_size > it->second)
       it->second = heap_size;
   }
   // otherwise create a new entry
   else
-    stats.insert(std::pair<std::string,unsigned int>(description,heap_size));
+    stats.insert(std::pair<std::string,double>(description,heap_size));
+}
+
+void PeridigmNS::Memstat::addAllocationStat(const std::string & description, double numBytes){
+
+  // if the descriptor already exists, update it if the memory use is higher
+  std::map<std::string, double>::iterator it = allocationStats.find(description);
+  if (it != allocationStats.end()){
+    if(numBytes > it->second)
+      it->second = numBytes;
+  }
+  // otherwise create a new entry
+  else
+    allocationStats.insert(std::pair<std::string,double>(description,numBytes));
+}
+
+void PeridigmNS::Memstat::addPeakRSSStat(const std::string & description){
+
+  double peak_rss = 0.0;
+
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) == 0){
+#if defined(__APPLE__)
+    // ru_maxrss is reported in bytes on OSX
+    peak_rss = (double)usage.ru_maxrss;
+#else
+    // ru_maxrss is reported in kilobytes on Linux
+    peak_rss = 1024.0*(double)usage.ru_maxrss;
+#endif
+  }
+
+  // the peak rss is monotonic, so the most recent sample is retained
+  peakRSSStats[description] = peak_rss;
 }
 
 void PeridigmNS::Memstat::printStats(){
 
+  printStatTable("Memory Usage (Heap Alloc MB):", stats);
+
+  if(allocationStats.size() > 0)
+    printStatTable("Memory Owned by Data Structures (MB):", allocationStats);
+
+  if(peakRSSStats.size() > 0)
+    printStatTable("Peak Resident Set Size (MB):", peakRSSStats);
+}
+
+void PeridigmNS::Memstat::printStatTable(const std::string & title, std::map<std::string, double> & table){
+
     if(myComm->NumProc()== 1){
       if(myComm->MyPID() == 0){
-      cout << "Memory Usage (Heap Alloc MB):\n";
-      //cout << "  " << left << setw(30) << "Checkpoint Description" << right << setw(12) << "Heap Alloc" << "\n";
-      for(std::map<std::string,unsigned int>::iterator it=stats.begin();it!=stats.end();++it){
+      cout << title << "\n";
+      for(std::map<std::string,double>::iterator it=table.begin();it!=table.end();++it){
         // if the name is long, trim it:
         std::string desc = it->first;
-        if(desc.length() > 25) desc.resize(25);
-        cout << "  " << left << setw(30) <<  desc << right << setw(12) << (double)it->second / (1024.0 * 1024.0) << "\n";
+        if(desc.length() > 35) desc.resize(35);
+        cout << "  " << left << setw(40) <<  desc << right << setw(12) << it->second / (1024.0 * 1024.0) << "\n";
       }
       cout << "\n";
       }
     }
     else{
-      int count = (int)( stats.size() );
+      // note that the stats are reduced by position, so every processor must record the same set of descriptions
+      int count = (int)( table.size() );
+      if(count == 0)
+        return;
       vector<std::string> names(count);
-      vector<double> times(count);
-      vector<double> minTimes(count);
-      vector<double> maxTimes(count);
-      vector<double> totalTimes(count);
+      vector<double> values(count);
+      vector<double> minValues(count);
+      vector<double> maxValues(count);
+      vector<double> totalValues(count);
       int i = 0;
-      for(map<std::string, unsigned int>::reverse_iterator it=stats.rbegin() ; it!=stats.rend() ; it++){
+      for(map<std::string, double>::reverse_iterator it=table.rbegin() ; it!=table.rend() ; it++){
         std::string desc = it->first; // truncate the name if its too long
-        if(desc.length() > 25) desc.resize(25);
+        if(desc.length() > 35) desc.resize(35);
         names[i] = desc;
-        times[i] = it->second;
+        values[i] = it->second;
         i++;
       }
       Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
-      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&times[0], &minTimes[0]);
-      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&times[0], &maxTimes[0]);
-      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&times[0], &totalTimes[0]);
+      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&values[0], &minValues[0]);
+      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&values[0], &maxValues[0]);
+      Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&values[0], &totalValues[0]);
       if(myComm->MyPID() == 0){
 
-      cout << "Memory Usage (Heap Alloc MB):\n";
+      cout << title << "\n";
 
-      cout << "  " << left << setw(30) << " " << right << setw(12) << "Min" << right << setw(15) << "Max" << right << setw(15) << "Ave" << endl;
+      cout << "  " << left << setw(40) << " " << right << setw(12) << "Min" << right << setw(15) << "Max" << right << setw(15) << "Ave" << right << setw(15) << "Total" << endl;
       for(unsigned int i=0 ; i<names.size() ; ++i){
-        cout << "  " << left << setw(30) << names[i] << right << setw(12) << minTimes[i] / (1024.0 * 1024.0)
-                                                     << right << setw(15) << maxTimes[i]/ (1024.0 * 1024.0)
-                                                     << right << setw(15) << (totalTimes[i]/myComm->NumProc()) / (1024.0 * 1024.0)<< "\n";
+        cout << "  " << left << setw(40) << names[i] << right << setw(12) << minValues[i] / (1024.0 * 1024.0)
+                                                     << right << setw(15) << maxValues[i]/ (1024.0 * 1024.0)
+                                                     << right << setw(15) << (totalValues[i]/myComm->NumProc()) / (1024.0 * 1024.0)
+                                                     << right << setw(15) << totalValues[i] / (1024.0 * 1024.0) << "\n";
       }
       cout << "\n";
       }
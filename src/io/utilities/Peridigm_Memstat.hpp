@@ -57,6 +57,10 @@
 // This is a very simple class that keeps track of memory use at selected
 // points in the code that are usually associated with large allocations
 // (i.e. allocating the jacobian, or performing the neighborhood search)
+// In addition to the heap statistics, the number of bytes owned by the
+// major data structures (DataManager fields, neighborhood lists, the tangent
+// matrix, contact data, output buffers) can be recorded, along with the peak
+// resident set size sampled at phase boundaries.
 // For more sophisticated profiling, the user should use a tool like valgrind.
 
 namespace PeridigmNS {
@@ -80,6 +84,12 @@ public:
   //! Add a memory stat and catagory to the list
   void addStat(const std::string & description);
 
+  //! Record the number of bytes owned by a data structure; the largest recorded value is retained
+  void addAllocationStat(const std::string & description, double numBytes);
+
+  //! Sample the peak resident set size of the process and associate it with the given phase
+  void addPeakRSSStat(const std::string & description);
+
   //! Print out the stats
   void printStats();
 
@@ -94,8 +104,17 @@ private:
   Memstat& operator=(const Memstat&);
   //@}  
 
+  //! Print a table of stats in megabytes, with min, max, and average across processors
+  void printStatTable(const std::string & title, std::map<std::string, double> & table);
+
   //! Map that associates a description with a stat
-  std::map<std::string, unsigned int> stats;
+  std::map<std::string, double> stats;
+
+  //! Map that associates a data structure with the number of bytes it owns
+  std::map<std::string, double> allocationStats;
+
+  //! Map that associates a phase with the peak resident set size at the end of that phase
+  std::map<std::string, double> peakRSSStats;
 
   static Memstat * myMemstatPtr;
   static Teuchos::RCP<const Epetra_Comm> myComm;
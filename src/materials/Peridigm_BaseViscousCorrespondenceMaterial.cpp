@@ -177,7 +177,6 @@ PeridigmNS::ViscousCorrespondenceMaterial::computeForce(const double dt,
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&forceDensity);
 
   double *delta = horizon;
-  double* stress = viscousCauchyStressNP1;
 
   double *defGrad, *shapeTensorInv;
   dataManager.getData(m_deformationGradientFieldId, PeridigmField::STEP_NONE)->ExtractView(&defGrad);
@@ -186,19 +185,28 @@ PeridigmNS::ViscousCorrespondenceMaterial::computeForce(const double dt,
   double *modelCoordinatesPtr, *neighborModelCoordinatesPtr,
   *forceDensityPtr, *neighborForceDensityPtr;
   double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
-  double TX, TY, TZ, omega, vol, neighborVol, jacobianDeterminant;
+  double TX, TY, TZ, omega, vol, neighborVol;
   int numNeighbors, neighborIndex;
   int bondIndex(0);
 
-  vector<double> defGradInvVector(9), piolaStressVector(9), tempVector(9);
-  double* defGradInv = &defGradInvVector[0];
-  double* piolaStress = &piolaStressVector[0];
-  double* temp = &tempVector[0];
+  // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T, followed by the inner product with the
+  // inverse of the shape tensor, evaluated for all points with the batched tensor kernels
+  m_jacobianDeterminantVector.resize(numOwnedPoints);
+  m_damageFactorVector.resize(numOwnedPoints);
+  m_defGradInvVector.resize(9*numOwnedPoints);
+  m_piolaStressVector.resize(9*numOwnedPoints);
+  m_forceStateTensorVector.resize(9*numOwnedPoints);
+  CORRESPONDENCE::Invert3by3MatrixBatch(defGrad, m_jacobianDeterminantVector.data(), m_defGradInvVector.data(), numOwnedPoints);
+  CORRESPONDENCE::MatrixMultiplyBatch(false, true, m_jacobianDeterminantVector.data(), viscousCauchyStressNP1, m_defGradInvVector.data(), m_piolaStressVector.data(), numOwnedPoints);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID)
+    m_damageFactorVector[iID] = 1.0 - damage[iID];
+  CORRESPONDENCE::MatrixMultiplyBatch(false, false, m_damageFactorVector.data(), m_piolaStressVector.data(), shapeTensorInv, m_forceStateTensorVector.data(), numOwnedPoints);
+  double* temp;
 
   // Loop over the material points and convert the Cauchy stress into pairwise peridynamic force densities
   const int *neighborListPtr = neighborhoodList;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID, 
-          ++delta, defGrad+=9, stress+=9, shapeTensorInv+=9, ++damage, ++singu){
+          ++delta, ++singu){
 
     numNeighbors = *neighborListPtr; neighborListPtr++;
     if ((m_singularityDetachment)&&(*singu==1.0)){
@@ -207,16 +215,7 @@ PeridigmNS::ViscousCorrespondenceMaterial::computeForce(const double dt,
         continue;
     }
 
-    // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T
-
-    // Invert the deformation gradient and store the determinant
-    CORRESPONDENCE::Invert3by3Matrix(defGrad, jacobianDeterminant, defGradInv);
-
-    //P = J * \sigma * F^(-T)
-    CORRESPONDENCE::MatrixMultiply(false, true, jacobianDeterminant, stress, defGradInv, piolaStress);
-
-    // Inner product of Piola stress and the inverse of the shape tensor
-    CORRESPONDENCE::MatrixMultiply(false, false, (1.0-*damage), piolaStress, shapeTensorInv, temp);
+    temp = m_forceStateTensorVector.data() + 9*iID;
 
     // Loop over the neighbors and compute contribution to force densities
     modelCoordinatesPtr = modelCoordinates + 3*iID;
@@ -118,6 +118,13 @@
 
         int m_singularityFieldId;
         bool m_singularityDetachment;
+
+        //! Scratch for the batched stress kernels in computeForce(), resized on demand and reused across time steps
+        mutable std::vector<double> m_jacobianDeterminantVector;
+        mutable std::vector<double> m_damageFactorVector;
+        mutable std::vector<double> m_defGradInvVector;
+        mutable std::vector<double> m_piolaStressVector;
+        mutable std::vector<double> m_forceStateTensorVector;
 	};
 }
 
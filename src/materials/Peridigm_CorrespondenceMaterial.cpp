@@ -73,10 +73,16 @@ PeridigmNS::CorrespondenceMaterial::CorrespondenceMaterial(const Teuchos::Parame
     m_specularBondPositionFieldId(-1),
     m_microPotentialFieldId(-1),
     m_deltaTemperatureFieldId(-1),
+    m_bondShapeTensorInverseXXFieldId(-1), m_bondShapeTensorInverseXYFieldId(-1),
+    m_bondShapeTensorInverseXZFieldId(-1), m_bondShapeTensorInverseYYFieldId(-1),
+    m_bondShapeTensorInverseYZFieldId(-1), m_bondShapeTensorInverseZZFieldId(-1),
+    m_bondAssociatedDamageSumFieldId(-1),
     m_singularityDetachment(true),
     m_useSpecularBondPositions(false),
     m_temperatureDependence(false),
     m_applyThermalStrains(false),
+    m_fusedKernel(true),
+    m_bondAssociated(false),
     m_CritJintegral(0.0)
 {
   //! \todo Add meaningful asserts on material properties.
@@ -87,7 +93,13 @@ PeridigmNS::CorrespondenceMaterial::CorrespondenceMaterial(const Teuchos::Parame
   //m_bulkModulus = calculateBulkModulus(params);
   //m_shearModulus = calculateShearModulus(params);
   m_density = params.get<double>("Density");
-  m_hourglassCoefficient = params.get<double>("Hourglass Coefficient");
+  if(params.isParameter("Bond Associated Correspondence"))
+    m_bondAssociated = params.get<bool>("Bond Associated Correspondence");
+  // The bond-associated formulation replaces the hourglass penalty, so the two cannot be combined
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_bondAssociated && params.isParameter("Hourglass Coefficient"),
+                              "**** Error:  \"Hourglass Coefficient\" cannot be combined with \"Bond Associated Correspondence\", which replaces the hourglass force.\n");
+  if(!m_bondAssociated)
+    m_hourglassCoefficient = params.get<double>("Hourglass Coefficient");
 
   obj_alphaVol.set(params,"Thermal Expansion Coefficient");
   m_alphaVol= obj_alphaVol.compute(0.0);
@@ -100,6 +112,8 @@ PeridigmNS::CorrespondenceMaterial::CorrespondenceMaterial(const Teuchos::Parame
     m_temperatureDependence  = params.get<bool>("Temperature Dependence");
   if(params.isParameter("Thermal Expansion Coefficient"))
     m_applyThermalStrains = true;
+  if(params.isParameter("Fused Kernel"))
+    m_fusedKernel = params.get<bool>("Fused Kernel");
   if (m_useSpecularBondPositions && params.isParameter("Critical J_integral")){
     obj_CritJintegral.set(params,"Critical J_integral");
     m_CritJintegral = obj_CritJintegral.compute(0.0);
@@ -138,6 +152,15 @@ PeridigmNS::CorrespondenceMaterial::CorrespondenceMaterial(const Teuchos::Parame
   }
   if(m_temperatureDependence||m_applyThermalStrains)
     m_deltaTemperatureFieldId      = fieldManager.getFieldId(PeridigmField::NODE,    PeridigmField::SCALAR,      PeridigmField::TWO_STEP, "Temperature_Change");
+  if(m_bondAssociated){
+    m_bondShapeTensorInverseXXFieldId = fieldManager.getFieldId(PeridigmField::BOND,    PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Associated_Shape_Tensor_Inverse_XX");
+    m_bondShapeTensorInverseXYFieldId = fieldManager.getFieldId(PeridigmField::BOND,    PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Associated_Shape_Tensor_Inverse_XY");
+    m_bondShapeTensorInverseXZFieldId = fieldManager.getFieldId(PeridigmField::BOND,    PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Associated_Shape_Tensor_Inverse_XZ");
+    m_bondShapeTensorInverseYYFieldId = fieldManager.getFieldId(PeridigmField::BOND,    PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Associated_Shape_Tensor_Inverse_YY");
+    m_bondShapeTensorInverseYZFieldId = fieldManager.getFieldId(PeridigmField::BOND,    PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Associated_Shape_Tensor_Inverse_YZ");
+    m_bondShapeTensorInverseZZFieldId = fieldManager.getFieldId(PeridigmField::BOND,    PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Associated_Shape_Tensor_Inverse_ZZ");
+    m_bondAssociatedDamageSumFieldId  = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Associated_Damage_Sum");
+  }
 
   m_fieldIds.push_back(m_horizonFieldId);
   m_fieldIds.push_back(m_volumeFieldId);
@@ -165,6 +188,15 @@ PeridigmNS::CorrespondenceMaterial::CorrespondenceMaterial(const Teuchos::Parame
   }
   if(m_deltaTemperatureFieldId!=-1)
       m_fieldIds.push_back(m_deltaTemperatureFieldId);
+  if(m_bondAssociated){
+      m_fieldIds.push_back(m_bondShapeTensorInverseXXFieldId);
+      m_fieldIds.push_back(m_bondShapeTensorInverseXYFieldId);
+      m_fieldIds.push_back(m_bondShapeTensorInverseXZFieldId);
+      m_fieldIds.push_back(m_bondShapeTensorInverseYYFieldId);
+      m_fieldIds.push_back(m_bondShapeTensorInverseYZFieldId);
+      m_fieldIds.push_back(m_bondShapeTensorInverseZZFieldId);
+      m_fieldIds.push_back(m_bondAssociatedDamageSumFieldId);
+  }
 }
 
 PeridigmNS::CorrespondenceMaterial::~CorrespondenceMaterial()
@@ -254,6 +286,33 @@ PeridigmNS::CorrespondenceMaterial::initialize(const double dt,
     "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
   TEUCHOS_TEST_FOR_EXCEPT_MSG(shapeTensorReturnCode != 0, shapeTensorErrorMessage);
 
+  // The bond-associated shape tensors are computed once here and afterwards only for points whose bonds break
+  if(m_bondAssociated){
+    double *bondShapeTensorInverseXX, *bondShapeTensorInverseXY, *bondShapeTensorInverseXZ,
+      *bondShapeTensorInverseYY, *bondShapeTensorInverseYZ, *bondShapeTensorInverseZZ, *bondAssociatedDamageSum;
+    dataManager.getData(m_bondShapeTensorInverseXXFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseXX);
+    dataManager.getData(m_bondShapeTensorInverseXYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseXY);
+    dataManager.getData(m_bondShapeTensorInverseXZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseXZ);
+    dataManager.getData(m_bondShapeTensorInverseYYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseYY);
+    dataManager.getData(m_bondShapeTensorInverseYZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseYZ);
+    dataManager.getData(m_bondShapeTensorInverseZZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseZZ);
+    dataManager.getData(m_bondAssociatedDamageSumFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondAssociatedDamageSum);
+
+    CORRESPONDENCE::computeBondAssociatedShapeTensorInverse(volume,
+                                                            horizon,
+                                                            modelCoordinates,
+                                                            bondDamage,
+                                                            bondShapeTensorInverseXX,
+                                                            bondShapeTensorInverseXY,
+                                                            bondShapeTensorInverseXZ,
+                                                            bondShapeTensorInverseYY,
+                                                            bondShapeTensorInverseYZ,
+                                                            bondShapeTensorInverseZZ,
+                                                            bondAssociatedDamageSum,
+                                                            neighborhoodList,
+                                                            numOwnedPoints,
+                                                            true);
+  }
 }
 
 void
@@ -298,22 +357,77 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   }else {specu=nullptr;miPotNP1=nullptr;}
   miPotNP1overlap = miPotNP1;
 
-  // Compute the inverse of the shape tensor and the approximate deformation gradient
-  // The approximate deformation gradient will be used by the derived class (specific correspondence material model)
-  // to compute the Cauchy stress.
-  // The inverse of the shape tensor is stored for later use after the Cauchy stress calculation
-  int shapeTensorReturnCode = 
-    CORRESPONDENCE::computeShapeTensorInverseAndApproximateDeformationGradient(volume,
+  double *leftStretchTensorN, *leftStretchTensorNP1, *rotationTensorN, *rotationTensorNP1, *unrotatedRateOfDeformation;
+  dataManager.getData(m_leftStretchTensorFieldId, PeridigmField::STEP_N)->ExtractView(&leftStretchTensorN);
+  dataManager.getData(m_leftStretchTensorFieldId, PeridigmField::STEP_NP1)->ExtractView(&leftStretchTensorNP1);
+  dataManager.getData(m_rotationTensorFieldId, PeridigmField::STEP_N)->ExtractView(&rotationTensorN);
+  dataManager.getData(m_rotationTensorFieldId, PeridigmField::STEP_NP1)->ExtractView(&rotationTensorNP1);
+  dataManager.getData(m_unrotatedRateOfDeformationFieldId, PeridigmField::STEP_NONE)->ExtractView(&unrotatedRateOfDeformation);
+
+  int shapeTensorReturnCode(0), rotationTensorReturnCode(0);
+
+  if(m_fusedKernel){
+    // Compute the inverse of the shape tensor, the approximate deformation gradient, the left stretch tensor,
+    // the rotation tensor, and the unrotated rate-of-deformation from a single sweep over the bonds
+    int kinematicsReturnCode = CORRESPONDENCE::computeCorrespondenceKinematics(volume,
                                                                                horizon,
                                                                                modelCoordinates,
                                                                                coordinates,
+                                                                               velocities,
                                                                                shapeTensorInverse,
                                                                                deformationGradient,
-                                                                               specu,
+                                                                               leftStretchTensorN,
+                                                                               rotationTensorN,
+                                                                               leftStretchTensorNP1,
+                                                                               rotationTensorNP1,
+                                                                               unrotatedRateOfDeformation,
                                                                                bondDamage,
                                                                                singu,
                                                                                neighborhoodList,
-                                                                               numOwnedPoints);
+                                                                               numOwnedPoints,
+                                                                               dt);
+    shapeTensorReturnCode = kinematicsReturnCode & 1;
+    rotationTensorReturnCode = kinematicsReturnCode & 2;
+  }
+  else{
+    // Compute the inverse of the shape tensor and the approximate deformation gradient
+    // The approximate deformation gradient will be used by the derived class (specific correspondence material model)
+    // to compute the Cauchy stress.
+    // The inverse of the shape tensor is stored for later use after the Cauchy stress calculation
+    shapeTensorReturnCode =
+      CORRESPONDENCE::computeShapeTensorInverseAndApproximateDeformationGradient(volume,
+                                                                                 horizon,
+                                                                                 modelCoordinates,
+                                                                                 coordinates,
+                                                                                 shapeTensorInverse,
+                                                                                 deformationGradient,
+                                                                                 specu,
+                                                                                 bondDamage,
+                                                                                 singu,
+                                                                                 neighborhoodList,
+                                                                                 numOwnedPoints);
+
+    // Compute left stretch tensor, rotation tensor, and unrotated rate-of-deformation.
+    // Performs a polar decomposition via Flanagan & Taylor (1987) algorithm.
+    rotationTensorReturnCode = CORRESPONDENCE::computeUnrotatedRateOfDeformationAndRotationTensor(volume,
+                                                                                                  horizon,
+                                                                                                  modelCoordinates,
+                                                                                                  velocities,
+                                                                                                  deformationGradient,
+                                                                                                  shapeTensorInverse,
+                                                                                                  leftStretchTensorN,
+                                                                                                  rotationTensorN,
+                                                                                                  leftStretchTensorNP1,
+                                                                                                  rotationTensorNP1,
+                                                                                                  unrotatedRateOfDeformation,
+                                                                                                  specu,
+                                                                                                  bondDamage,
+                                                                                                  singu,
+                                                                                                  neighborhoodList,
+                                                                                                  numOwnedPoints,
+                                                                                                  dt);
+  }
+
   string shapeTensorErrorMessage =
     "**** Error:  CorrespondenceMaterial::computeForce() failed to compute shape tensor.\n";
   shapeTensorErrorMessage +=
@@ -321,32 +435,6 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   if ((!m_singularityDetachment)&&(shapeTensorReturnCode != 0))
       TEUCHOS_TEST_FOR_EXCEPT_MSG(shapeTensorReturnCode != 0, shapeTensorErrorMessage);
 
-  double *leftStretchTensorN, *leftStretchTensorNP1, *rotationTensorN, *rotationTensorNP1, *unrotatedRateOfDeformation;
-  dataManager.getData(m_leftStretchTensorFieldId, PeridigmField::STEP_N)->ExtractView(&leftStretchTensorN);
-  dataManager.getData(m_leftStretchTensorFieldId, PeridigmField::STEP_NP1)->ExtractView(&leftStretchTensorNP1);
-  dataManager.getData(m_rotationTensorFieldId, PeridigmField::STEP_N)->ExtractView(&rotationTensorN);
-  dataManager.getData(m_rotationTensorFieldId, PeridigmField::STEP_NP1)->ExtractView(&rotationTensorNP1);
-  dataManager.getData(m_unrotatedRateOfDeformationFieldId, PeridigmField::STEP_NONE)->ExtractView(&unrotatedRateOfDeformation);
-
-  // Compute left stretch tensor, rotation tensor, and unrotated rate-of-deformation.
-  // Performs a polar decomposition via Flanagan & Taylor (1987) algorithm.
-  int rotationTensorReturnCode = CORRESPONDENCE::computeUnrotatedRateOfDeformationAndRotationTensor(volume,
-                                                                                                    horizon,
-                                                                                                    modelCoordinates, 
-                                                                                                    velocities, 
-                                                                                                    deformationGradient,
-                                                                                                    shapeTensorInverse,
-                                                                                                    leftStretchTensorN,
-                                                                                                    rotationTensorN,
-                                                                                                    leftStretchTensorNP1,
-                                                                                                    rotationTensorNP1,
-                                                                                                    unrotatedRateOfDeformation,
-                                                                                                    specu,
-                                                                                                    bondDamage,
-                                                                                                    singu,
-                                                                                                    neighborhoodList, 
-                                                                                                    numOwnedPoints, 
-                                                                                                    dt);
   string rotationTensorErrorMessage =
     "**** Error:  CorrespondenceMaterial::computeForce() failed to compute rotation tensor.\n";
   rotationTensorErrorMessage +=
@@ -386,9 +474,13 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   double *partialStress;
   dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->ExtractView(&partialStress);
 
+  // Hourglass forces for stabilization of low-energy and/or zero-energy modes
+  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+
+  double *hourglassForceDensity;
+  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&hourglassForceDensity);
+
   double *delta = horizon;
-  double* stress = cauchyStressNP1;
-  double* shapeTensorInv = shapeTensorInverse;
   double* defGrad = deformationGradient;
 
   double *modelCoordinatesPtr, *coordinatesPtr, *velocitiesPtr,
@@ -397,7 +489,11 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
   double velocityBondX, velocityBondY, velocityBondZ;
   double alphaN, alphaNP1, alpha(m_alphaVol), dotThermalExpansion;
-  double TX, TY, TZ, omega, vol, neighborVol, jacobianDeterminant;
+  double TX, TY, TZ, omega, vol, neighborVol;
+  double deformedBondX, deformedBondY, deformedBondZ, deformedBondLength;
+  double hourglassVectorX, hourglassVectorY, hourglassVectorZ, hourglassMagnitude, hourglassConstant(0.0);
+  double *hourglassForceDensityPtr, *neighborHourglassForceDensityPtr;
+  bool fusedHourglass = m_fusedKernel && !m_bondAssociated;
   int numNeighbors, neighborIndex;
   int bondIndex(0);
   
@@ -406,15 +502,24 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
   matrixInversionErrorMessage +=
     "****         Note that all nodes must have a minimum of three neighbors.  Is the horizon too small?\n";
 
-  vector<double> defGradInvVector(9), piolaStressVector(9), tempVector(9);
-  double* defGradInv = &defGradInvVector[0];
-  double* piolaStress = &piolaStressVector[0];
-  double* temp = &tempVector[0];
-  
+  // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T, followed by the inner product with the
+  // inverse of the shape tensor, evaluated for all points with the batched tensor kernels
+  m_jacobianDeterminantVector.resize(numOwnedPoints);
+  m_damageFactorVector.resize(numOwnedPoints);
+  m_defGradInvVector.resize(9*numOwnedPoints);
+  m_piolaStressVector.resize(9*numOwnedPoints);
+  m_forceStateTensorVector.resize(9*numOwnedPoints);
+  CORRESPONDENCE::Invert3by3MatrixBatch(deformationGradient, m_jacobianDeterminantVector.data(), m_defGradInvVector.data(), numOwnedPoints);
+  CORRESPONDENCE::MatrixMultiplyBatch(false, true, m_jacobianDeterminantVector.data(), cauchyStressNP1, m_defGradInvVector.data(), m_piolaStressVector.data(), numOwnedPoints);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID)
+    m_damageFactorVector[iID] = 1.0 - damage[iID];
+  CORRESPONDENCE::MatrixMultiplyBatch(false, false, m_damageFactorVector.data(), m_piolaStressVector.data(), shapeTensorInverse, m_forceStateTensorVector.data(), numOwnedPoints);
+  double* temp;
+
   // Loop over the material points and convert the Cauchy stress into pairwise peridynamic force densities
   const int *neighborListPtr = neighborhoodList;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID, 
-          ++delta, defGrad+=9, stress+=9, shapeTensorInv+=9, ++damage, ++singu, deltaTemperatureN++, deltaTemperatureNP1++){
+          ++delta, defGrad+=9, ++damage, ++singu, deltaTemperatureN++, deltaTemperatureNP1++){
 
     numNeighbors = *neighborListPtr; neighborListPtr++;
     if ((m_singularityDetachment)&&(*singu==1.0)){
@@ -433,19 +538,14 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
         continue;
     }
 
-    // first Piola-Kirchhoff stress = J * cauchyStress * defGrad^-T
+    // A zero determinant means the deformation gradient could not be inverted
+    if ((!m_singularityDetachment)&&(m_jacobianDeterminantVector[iID] == 0.0))
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(m_jacobianDeterminantVector[iID] == 0.0, matrixInversionErrorMessage);
 
-    // Invert the deformation gradient and store the determinant
-    int matrixInversionReturnCode =
-      CORRESPONDENCE::Invert3by3Matrix(defGrad, jacobianDeterminant, defGradInv);
-    if ((!m_singularityDetachment)&&(matrixInversionReturnCode != 0))
-        TEUCHOS_TEST_FOR_EXCEPT_MSG(matrixInversionReturnCode != 0, matrixInversionErrorMessage);
+    temp = m_forceStateTensorVector.data() + 9*iID;
 
-    //P = J * \sigma * F^(-T)
-    CORRESPONDENCE::MatrixMultiply(false, true, jacobianDeterminant, stress, defGradInv, piolaStress);
-
-    // Inner product of Piola stress and the inverse of the shape tensor
-    CORRESPONDENCE::MatrixMultiply(false, false, (1.0-*damage), piolaStress, shapeTensorInv, temp);
+    if(fusedHourglass)
+      hourglassConstant = 18.0*m_hourglassCoefficient*m_bulkModulus/m_pi/( (*delta)*(*delta)*(*delta)*(*delta) );
 
     // Loop over the neighbors and compute contribution to force densities
     modelCoordinatesPtr = modelCoordinates + 3*iID;
@@ -496,7 +596,37 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
       *(partialStressPtr+6) += TZ*undeformedBondX*neighborVol;
       *(partialStressPtr+7) += TZ*undeformedBondY*neighborVol;
       *(partialStressPtr+8) += TZ*undeformedBondZ*neighborVol;
-      
+
+      if(fusedHourglass){
+        // Hourglass force for this bond, evaluated from the same neighbor gather
+        deformedBondX = *(neighborCoordinatesPtr)   - *(coordinatesPtr);
+        deformedBondY = *(neighborCoordinatesPtr+1) - *(coordinatesPtr+1);
+        deformedBondZ = *(neighborCoordinatesPtr+2) - *(coordinatesPtr+2);
+        deformedBondLength = sqrt(deformedBondX*deformedBondX +
+                                  deformedBondY*deformedBondY +
+                                  deformedBondZ*deformedBondZ);
+
+        hourglassVectorX = *(coordinatesPtr) +
+          *(defGrad)   * undeformedBondX + *(defGrad+1) * undeformedBondY + *(defGrad+2) * undeformedBondZ - *(neighborCoordinatesPtr);
+        hourglassVectorY = *(coordinatesPtr+1) +
+          *(defGrad+3) * undeformedBondX + *(defGrad+4) * undeformedBondY + *(defGrad+5) * undeformedBondZ - *(neighborCoordinatesPtr+1);
+        hourglassVectorZ = *(coordinatesPtr+2) +
+          *(defGrad+6) * undeformedBondX + *(defGrad+7) * undeformedBondY + *(defGrad+8) * undeformedBondZ - *(neighborCoordinatesPtr+2);
+
+        hourglassMagnitude = -1.0*(hourglassVectorX*deformedBondX + hourglassVectorY*deformedBondY + hourglassVectorZ*deformedBondZ);
+        hourglassMagnitude = (1.0-bondDamage[bondIndex]) * hourglassConstant * (hourglassMagnitude/undeformedBondLength) * (1.0/deformedBondLength);
+
+        hourglassForceDensityPtr = hourglassForceDensity + 3*iID;
+        neighborHourglassForceDensityPtr = hourglassForceDensity + 3*neighborIndex;
+
+        *(hourglassForceDensityPtr)   += hourglassMagnitude * deformedBondX * neighborVol;
+        *(hourglassForceDensityPtr+1) += hourglassMagnitude * deformedBondY * neighborVol;
+        *(hourglassForceDensityPtr+2) += hourglassMagnitude * deformedBondZ * neighborVol;
+        *(neighborHourglassForceDensityPtr)   -= hourglassMagnitude * deformedBondX * vol;
+        *(neighborHourglassForceDensityPtr+1) -= hourglassMagnitude * deformedBondY * vol;
+        *(neighborHourglassForceDensityPtr+2) -= hourglassMagnitude * deformedBondZ * vol;
+      }
+
       if (m_useSpecularBondPositions){
           velocityBondX = *(neighborVelocitiesPtr)   - *(velocitiesPtr);
           velocityBondY = *(neighborVelocitiesPtr+1) - *(velocitiesPtr+1);
@@ -526,27 +656,69 @@ PeridigmNS::CorrespondenceMaterial::computeForce(const double dt,
     }
   }
 
-  // Compute hourglass forces for stabilization of low-energy and/or zero-energy modes
-  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-
-  double *hourglassForceDensity;
-  dataManager.getData(m_hourglassForceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&hourglassForceDensity);
-
   // \todo HOURGLASS FORCES ARE NOT OUTPUT TO EXODUS CORRECTLY BECAUSE THEY ARE NOT ASSEMBLED ACROSS PROCESSORS.
   //       They are summed into the force vector below, and the force vector is assembled across processors,
   //       so the calculation runs correctly, but the hourglass output is off.
 
-  CORRESPONDENCE::computeHourglassForce(volume,
-                                            horizon,
-                                            modelCoordinates,
-                                              coordinates,
-                                            deformationGradient,
-                                            hourglassForceDensity,
-                                            bondDamage,
-                                            neighborhoodList,
-                                            numOwnedPoints,
-                                            m_bulkModulus,
-                                            m_hourglassCoefficient);
+  if(m_bondAssociated){
+    // Bond-associated stabilization replaces the hourglass force; the cached bond-associated
+    // shape tensors are refreshed only for points whose bond damage has changed
+    double *bondShapeTensorInverseXX, *bondShapeTensorInverseXY, *bondShapeTensorInverseXZ,
+      *bondShapeTensorInverseYY, *bondShapeTensorInverseYZ, *bondShapeTensorInverseZZ, *bondAssociatedDamageSum;
+    dataManager.getData(m_bondShapeTensorInverseXXFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseXX);
+    dataManager.getData(m_bondShapeTensorInverseXYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseXY);
+    dataManager.getData(m_bondShapeTensorInverseXZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseXZ);
+    dataManager.getData(m_bondShapeTensorInverseYYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseYY);
+    dataManager.getData(m_bondShapeTensorInverseYZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseYZ);
+    dataManager.getData(m_bondShapeTensorInverseZZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondShapeTensorInverseZZ);
+    dataManager.getData(m_bondAssociatedDamageSumFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondAssociatedDamageSum);
+
+    CORRESPONDENCE::computeBondAssociatedShapeTensorInverse(volume,
+                                                            horizon,
+                                                            modelCoordinates,
+                                                            bondDamage,
+                                                            bondShapeTensorInverseXX,
+                                                            bondShapeTensorInverseXY,
+                                                            bondShapeTensorInverseXZ,
+                                                            bondShapeTensorInverseYY,
+                                                            bondShapeTensorInverseYZ,
+                                                            bondShapeTensorInverseZZ,
+                                                            bondAssociatedDamageSum,
+                                                            neighborhoodList,
+                                                            numOwnedPoints,
+                                                            false);
+
+    CORRESPONDENCE::computeBondAssociatedStabilizationForce(volume,
+                                                            horizon,
+                                                            modelCoordinates,
+                                                            coordinates,
+                                                            deformationGradient,
+                                                            shapeTensorInverse,
+                                                            bondShapeTensorInverseXX,
+                                                            bondShapeTensorInverseXY,
+                                                            bondShapeTensorInverseXZ,
+                                                            bondShapeTensorInverseYY,
+                                                            bondShapeTensorInverseYZ,
+                                                            bondShapeTensorInverseZZ,
+                                                            hourglassForceDensity,
+                                                            bondDamage,
+                                                            neighborhoodList,
+                                                            numOwnedPoints,
+                                                            m_bulkModulus,
+                                                            m_shearModulus);
+  }
+  else if(!m_fusedKernel)
+    CORRESPONDENCE::computeHourglassForce(volume,
+                                          horizon,
+                                          modelCoordinates,
+                                          coordinates,
+                                          deformationGradient,
+                                          hourglassForceDensity,
+                                          bondDamage,
+                                          neighborhoodList,
+                                          numOwnedPoints,
+                                          m_bulkModulus,
+                                          m_hourglassCoefficient);
 
   // Sum the hourglass force densities into the force densities
   Teuchos::RCP<Epetra_Vector> forceDensityVector = dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1);
@@ -137,14 +137,34 @@ namespace PeridigmNS {
     int m_specularBondPositionFieldId;
     int m_microPotentialFieldId;
     int m_deltaTemperatureFieldId;
+    int m_bondShapeTensorInverseXXFieldId;
+    int m_bondShapeTensorInverseXYFieldId;
+    int m_bondShapeTensorInverseXZFieldId;
+    int m_bondShapeTensorInverseYYFieldId;
+    int m_bondShapeTensorInverseYZFieldId;
+    int m_bondShapeTensorInverseZZFieldId;
+    int m_bondAssociatedDamageSumFieldId;
 
     bool m_singularityDetachment;
     bool m_useSpecularBondPositions;
     bool m_temperatureDependence;
     bool m_applyThermalStrains;
 
+    //! Evaluate kinematics in a single neighbor sweep and fold the hourglass force into the bond force loop
+    bool m_fusedKernel;
+
+    //! Stabilize with bond-associated deformation gradients instead of the hourglass force
+    bool m_bondAssociated;
+
     TempDepConst obj_CritJintegral;
     double m_CritJintegral;
+
+    //! Scratch for the batched stress kernels in computeForce(), resized on demand and reused across time steps
+    mutable std::vector<double> m_jacobianDeterminantVector;
+    mutable std::vector<double> m_damageFactorVector;
+    mutable std::vector<double> m_defGradInvVector;
+    mutable std::vector<double> m_piolaStressVector;
+    mutable std::vector<double> m_forceStateTensorVector;
   };
 }
 
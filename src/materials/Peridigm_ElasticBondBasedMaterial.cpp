@@ -102,6 +102,41 @@ PeridigmNS::ElasticBondBasedMaterial::computeForce(const double dt,
   // Zero out the forces
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
+  evaluateForce(numOwnedPoints, neighborhoodList, 0, 0, dataManager);
+}
+
+void
+PeridigmNS::ElasticBondBasedMaterial::computeInteriorForce(const double dt,
+                                                           const int numOwnedPoints,
+                                                           const int* ownedIDs,
+                                                           const int* neighborhoodList,
+                                                           const int* isBoundaryPoint,
+                                                           PeridigmNS::DataManager& dataManager) const
+{
+  // Zero out the forces
+  dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+
+  evaluateForce(numOwnedPoints, neighborhoodList, isBoundaryPoint, 0, dataManager);
+}
+
+void
+PeridigmNS::ElasticBondBasedMaterial::computeBoundaryForce(const double dt,
+                                                           const int numOwnedPoints,
+                                                           const int* ownedIDs,
+                                                           const int* neighborhoodList,
+                                                           const int* isBoundaryPoint,
+                                                           PeridigmNS::DataManager& dataManager) const
+{
+  evaluateForce(numOwnedPoints, neighborhoodList, isBoundaryPoint, 1, dataManager);
+}
+
+void
+PeridigmNS::ElasticBondBasedMaterial::evaluateForce(const int numOwnedPoints,
+                                                    const int* neighborhoodList,
+                                                    const int* pointFlags,
+                                                    int evaluateFlag,
+                                                    PeridigmNS::DataManager& dataManager) const
+{
   // Extract pointers to the underlying data
   double *x, *y, *cellVolume, *bondDamage, *force;
 
@@ -111,5 +146,5 @@ PeridigmNS::ElasticBondBasedMaterial::computeForce(const double dt,
   dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->ExtractView(&force);
 
-  MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
+  MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon,pointFlags,evaluateFlag);
 }
@@ -97,7 +97,37 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
 
+    //! The bond-based force at a point depends only on the point and its neighbors, so interior points can be evaluated separately.
+    virtual bool supportsSplitEvaluation() const { return true; }
+
+    //! Evaluate the internal force at interior points; zeroes the force density.
+    virtual void
+    computeInteriorForce(const double dt,
+                         const int numOwnedPoints,
+                         const int* ownedIDs,
+                         const int* neighborhoodList,
+                         const int* isBoundaryPoint,
+                         PeridigmNS::DataManager& dataManager) const;
+
+    //! Evaluate the internal force at boundary points, adding to the force density computed by computeInteriorForce().
+    virtual void
+    computeBoundaryForce(const double dt,
+                         const int numOwnedPoints,
+                         const int* ownedIDs,
+                         const int* neighborhoodList,
+                         const int* isBoundaryPoint,
+                         PeridigmNS::DataManager& dataManager) const;
+
   protected:
+
+    //! Evaluate the internal force at the owned points for which pointFlags equals evaluateFlag, or at all owned points if pointFlags is null.
+    void
+    evaluateForce(const int numOwnedPoints,
+                  const int* neighborhoodList,
+                  const int* pointFlags,
+                  int evaluateFlag,
+                  PeridigmNS::DataManager& dataManager) const;
+
 	
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
     inline double distance(double a1, double a2, double a3,
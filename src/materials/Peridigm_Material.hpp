@@ -128,6 +128,34 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const = 0;
 
+    //! Returns true if the material implements computeInteriorForce() and computeBoundaryForce().
+    virtual bool supportsSplitEvaluation() const { return false; }
+
+    /*! \brief Evaluate the internal force at interior points while the halo exchange is in progress.
+     *
+     *  Interior points are the owned points for which isBoundaryPoint is zero; they have no ghosted neighbors.
+     *  A material that overrides this function must also override computeBoundaryForce() such that the two
+     *  calls, made in sequence, are equivalent to computeForce().  The default implementation does nothing.
+     */
+    virtual void
+    computeInteriorForce(const double dt,
+                         const int numOwnedPoints,
+                         const int* ownedIDs,
+                         const int* neighborhoodList,
+                         const int* isBoundaryPoint,
+                         PeridigmNS::DataManager& dataManager) const {}
+
+    //! Evaluate the internal force at boundary points once the halo exchange is complete; the default implementation calls computeForce().
+    virtual void
+    computeBoundaryForce(const double dt,
+                         const int numOwnedPoints,
+                         const int* ownedIDs,
+                         const int* neighborhoodList,
+                         const int* isBoundaryPoint,
+                         PeridigmNS::DataManager& dataManager) const {
+      computeForce(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager);
+    }
+
     /// \enum JacobianType
     /// \brief Whether to compute the full tangent stiffness matrix or just its block diagonal entries
     ///
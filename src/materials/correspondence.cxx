@@ -53,6 +53,7 @@
 #include <functional>
 #include <boost/math/constants/constants.hpp>
 #include <vector>
+#include <algorithm>
 #include <iostream>
 
 namespace CORRESPONDENCE {
@@ -227,6 +228,281 @@ void MatrixMultiply
   }
 }
 
+// Number of points staged together in the structure-of-arrays buffers of the
+// batched kernels below; the buffers for one batch fit in the L1 cache
+static const int batchSize = 32;
+
+// Copy a batch of row-major 3x3 tensors into structure-of-arrays form,
+// optionally transposing each tensor
+template<typename ScalarT>
+inline void gatherTensorBatch
+(
+ const ScalarT* tensor,
+ ScalarT soa[][batchSize],
+ int numPoints,
+ bool transpose = false
+)
+{
+  for(int c=0 ; c<9 ; ++c){
+    const int src = transpose ? 3*(c%3) + c/3 : c;
+    for(int p=0 ; p<numPoints ; ++p)
+      soa[c][p] = tensor[9*p+src];
+  }
+}
+
+// Copy a batch of tensors from structure-of-arrays form back to row-major storage
+template<typename ScalarT>
+inline void scatterTensorBatch
+(
+ ScalarT soa[][batchSize],
+ ScalarT* tensor,
+ int numPoints
+)
+{
+  for(int c=0 ; c<9 ; ++c)
+    for(int p=0 ; p<numPoints ; ++p)
+      tensor[9*p+c] = soa[c][p];
+}
+
+template<typename ScalarT>
+int Invert3by3MatrixBatch
+(
+ const ScalarT* matrix,
+ ScalarT* determinant,
+ ScalarT* inverse,
+ int numPoints
+)
+{
+  int numSingular(0);
+
+  ScalarT m[9][batchSize], inv[9][batchSize];
+
+  for(int first=0 ; first<numPoints ; first+=batchSize){
+
+    const int n = std::min(batchSize, numPoints-first);
+    gatherTensorBatch(matrix+9*first, m, n);
+
+    for(int p=0 ; p<n ; ++p){
+      ScalarT minor0 =  m[4][p] * m[8][p] - m[5][p] * m[7][p];
+      ScalarT minor1 =  m[3][p] * m[8][p] - m[5][p] * m[6][p];
+      ScalarT minor2 =  m[3][p] * m[7][p] - m[4][p] * m[6][p];
+      ScalarT minor3 =  m[1][p] * m[8][p] - m[2][p] * m[7][p];
+      ScalarT minor4 =  m[0][p] * m[8][p] - m[6][p] * m[2][p];
+      ScalarT minor5 =  m[0][p] * m[7][p] - m[1][p] * m[6][p];
+      ScalarT minor6 =  m[1][p] * m[5][p] - m[2][p] * m[4][p];
+      ScalarT minor7 =  m[0][p] * m[5][p] - m[2][p] * m[3][p];
+      ScalarT minor8 =  m[0][p] * m[4][p] - m[1][p] * m[3][p];
+      ScalarT det = m[0][p] * minor0 - m[1][p] * minor1 + m[2][p] * minor2;
+
+      // Branch-free handling of singular matrices, which get a zero inverse
+      const bool singular = (det == ScalarT(0.0));
+      const ScalarT safeDet = singular ? ScalarT(1.0) : det;
+      const ScalarT scale = singular ? ScalarT(0.0) : ScalarT(1.0);
+      numSingular += singular ? 1 : 0;
+
+      determinant[first+p] = det;
+      inv[0][p] = scale * (minor0/safeDet);
+      inv[1][p] = scale * (-1.0*minor3/safeDet);
+      inv[2][p] = scale * (minor6/safeDet);
+      inv[3][p] = scale * (-1.0*minor1/safeDet);
+      inv[4][p] = scale * (minor4/safeDet);
+      inv[5][p] = scale * (-1.0*minor7/safeDet);
+      inv[6][p] = scale * (minor2/safeDet);
+      inv[7][p] = scale * (-1.0*minor5/safeDet);
+      inv[8][p] = scale * (minor8/safeDet);
+    }
+
+    scatterTensorBatch(inv, inverse+9*first, n);
+  }
+
+  return numSingular;
+}
+
+template<typename ScalarT>
+void MatrixMultiplyBatch
+(
+ bool transA,
+ bool transB,
+ const ScalarT* alpha,
+ const ScalarT* a,
+ const ScalarT* b,
+ ScalarT* result,
+ int numPoints
+)
+{
+  ScalarT A[9][batchSize], B[9][batchSize], C[9][batchSize];
+
+  for(int first=0 ; first<numPoints ; first+=batchSize){
+
+    const int n = std::min(batchSize, numPoints-first);
+
+    // Transposes are resolved while staging, so the kernel below is a plain product
+    gatherTensorBatch(a+9*first, A, n, transA);
+    gatherTensorBatch(b+9*first, B, n, transB);
+
+    for(int p=0 ; p<n ; ++p){
+      C[0][p] = A[0][p] * B[0][p] + A[1][p] * B[3][p] + A[2][p] * B[6][p];
+      C[1][p] = A[0][p] * B[1][p] + A[1][p] * B[4][p] + A[2][p] * B[7][p];
+      C[2][p] = A[0][p] * B[2][p] + A[1][p] * B[5][p] + A[2][p] * B[8][p];
+      C[3][p] = A[3][p] * B[0][p] + A[4][p] * B[3][p] + A[5][p] * B[6][p];
+      C[4][p] = A[3][p] * B[1][p] + A[4][p] * B[4][p] + A[5][p] * B[7][p];
+      C[5][p] = A[3][p] * B[2][p] + A[4][p] * B[5][p] + A[5][p] * B[8][p];
+      C[6][p] = A[6][p] * B[0][p] + A[7][p] * B[3][p] + A[8][p] * B[6][p];
+      C[7][p] = A[6][p] * B[1][p] + A[7][p] * B[4][p] + A[8][p] * B[7][p];
+      C[8][p] = A[6][p] * B[2][p] + A[7][p] * B[5][p] + A[8][p] * B[8][p];
+    }
+
+    if(alpha != nullptr){
+      for(int c=0 ; c<9 ; ++c)
+        for(int p=0 ; p<n ; ++p)
+          C[c][p] *= alpha[first+p];
+    }
+
+    scatterTensorBatch(C, result+9*first, n);
+  }
+}
+
+template<typename ScalarT>
+void computeRotationAndUnrotatedRateOfDeformationBatch
+(
+const ScalarT* eulerianVelocityGradient,
+const ScalarT* leftStretchTensorN,
+const ScalarT* rotationTensorN,
+ScalarT* leftStretchTensorNP1,
+ScalarT* rotationTensorNP1,
+ScalarT* unrotatedRateOfDeformation,
+int* returnCode,
+int numPoints,
+double dt
+)
+{
+  ScalarT L[9][batchSize], V[9][batchSize], R[9][batchSize];
+  ScalarT VNP1[9][batchSize], RNP1[9][batchSize], d[9][batchSize];
+
+  for(int first=0 ; first<numPoints ; first+=batchSize){
+
+    const int n = std::min(batchSize, numPoints-first);
+    gatherTensorBatch(eulerianVelocityGradient+9*first, L, n);
+    gatherTensorBatch(leftStretchTensorN+9*first, V, n);
+    gatherTensorBatch(rotationTensorN+9*first, R, n);
+
+    // Same sequence of operations as computeRotationAndUnrotatedRateOfDeformationAtPoint,
+    // written without branches so that the loop vectorizes across points
+    for(int p=0 ; p<n ; ++p){
+
+      ScalarT D[9], spin[9], temp[9], tempInv[9], Omega[9], OmegaSq[9], Q[9];
+
+      // Compute rate-of-deformation tensor, D = 1/2 * (L + Lt)
+      D[0] = L[0][p];
+      D[1] = 0.5 * ( L[1][p] + L[3][p] );
+      D[2] = 0.5 * ( L[2][p] + L[6][p] );
+      D[3] = D[1];
+      D[4] = L[4][p];
+      D[5] = 0.5 * ( L[5][p] + L[7][p] );
+      D[6] = D[2];
+      D[7] = D[5];
+      D[8] = L[8][p];
+
+      // Compute spin tensor, W = 1/2 * (L - Lt)
+      spin[1] = 0.5 * ( L[1][p] - L[3][p] );
+      spin[2] = 0.5 * ( L[2][p] - L[6][p] );
+      spin[3] = -1.0 * spin[1];
+      spin[5] = 0.5 * ( L[5][p] - L[7][p] );
+      spin[6] = -1.0 * spin[2];
+      spin[7] = -1.0 * spin[5];
+
+      // z_i = \epsilon_{ikj} * D_{jm} * V_{mk} (T&F Eq. 13)
+      ScalarT zX = - V[2][p] * D[3] - V[5][p] * D[4] - V[8][p] * D[5] + V[1][p] * D[6] + V[4][p] * D[7] + V[7][p] * D[8];
+      ScalarT zY =   V[2][p] * D[0] + V[5][p] * D[1] + V[8][p] * D[2] - V[0][p] * D[6] - V[3][p] * D[7] - V[6][p] * D[8];
+      ScalarT zZ = - V[1][p] * D[0] - V[4][p] * D[1] - V[7][p] * D[2] + V[0][p] * D[3] + V[3][p] * D[4] + V[6][p] * D[5];
+
+      // w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
+      ScalarT wX = 0.5 * ( spin[7] - spin[5] );
+      ScalarT wY = 0.5 * ( spin[2] - spin[6] );
+      ScalarT wZ = 0.5 * ( spin[3] - spin[1] );
+
+      // (trace(V) * I - V) and its inverse
+      ScalarT traceV = V[0][p] + V[4][p] + V[8][p];
+      temp[0] = traceV - V[0][p]; temp[1] = - V[1][p];         temp[2] = - V[2][p];
+      temp[3] = - V[3][p];         temp[4] = traceV - V[4][p]; temp[5] = - V[5][p];
+      temp[6] = - V[6][p];         temp[7] = - V[7][p];         temp[8] = traceV - V[8][p];
+
+      ScalarT minor0 =  temp[4] * temp[8] - temp[5] * temp[7];
+      ScalarT minor1 =  temp[3] * temp[8] - temp[5] * temp[6];
+      ScalarT minor2 =  temp[3] * temp[7] - temp[4] * temp[6];
+      ScalarT minor3 =  temp[1] * temp[8] - temp[2] * temp[7];
+      ScalarT minor4 =  temp[0] * temp[8] - temp[6] * temp[2];
+      ScalarT minor5 =  temp[0] * temp[7] - temp[1] * temp[6];
+      ScalarT minor6 =  temp[1] * temp[5] - temp[2] * temp[4];
+      ScalarT minor7 =  temp[0] * temp[5] - temp[2] * temp[3];
+      ScalarT minor8 =  temp[0] * temp[4] - temp[1] * temp[3];
+      ScalarT det = temp[0] * minor0 - temp[1] * minor1 + temp[2] * minor2;
+      const bool singular = (det == ScalarT(0.0));
+      const ScalarT safeDet = singular ? ScalarT(1.0) : det;
+      const ScalarT scale = singular ? ScalarT(0.0) : ScalarT(1.0);
+      returnCode[first+p] = singular ? 1 : 0;
+      tempInv[0] = scale * (minor0/safeDet);      tempInv[1] = scale * (-1.0*minor3/safeDet); tempInv[2] = scale * (minor6/safeDet);
+      tempInv[3] = scale * (-1.0*minor1/safeDet); tempInv[4] = scale * (minor4/safeDet);      tempInv[5] = scale * (-1.0*minor7/safeDet);
+      tempInv[6] = scale * (minor2/safeDet);      tempInv[7] = scale * (-1.0*minor5/safeDet); tempInv[8] = scale * (minor8/safeDet);
+
+      // \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
+      ScalarT omegaX = wX + tempInv[0] * zX + tempInv[1] * zY + tempInv[2] * zZ;
+      ScalarT omegaY = wY + tempInv[3] * zX + tempInv[4] * zY + tempInv[5] * zZ;
+      ScalarT omegaZ = wZ + tempInv[6] * zX + tempInv[7] * zY + tempInv[8] * zZ;
+
+      // \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
+      Omega[0] = 0.0;     Omega[1] = -omegaZ; Omega[2] = omegaY;
+      Omega[3] = omegaZ;  Omega[4] = 0.0;     Omega[5] = -omegaX;
+      Omega[6] = -omegaY; Omega[7] = omegaX;  Omega[8] = 0.0;
+
+      // Q = I + sin( dt * Omega ) * OmegaTensor / Omega - (1. - cos(dt * Omega)) * omegaTensor^2 / OmegaSq (T&F Eq. 44)
+      ScalarT omegaSq = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
+      const bool rotating = (omegaSq > 1.e-30);
+      ScalarT safeOmegaSq = rotating ? omegaSq : ScalarT(1.0);
+      ScalarT safeOmega = sqrt(safeOmegaSq);
+      ScalarT scaleFactor1 = rotating ? ScalarT(sin(dt*safeOmega) / safeOmega) : ScalarT(0.0);
+      ScalarT scaleFactor2 = rotating ? ScalarT(-(1.0 - cos(dt*safeOmega)) / safeOmegaSq) : ScalarT(0.0);
+
+      OmegaSq[0] = Omega[0] * Omega[0] + Omega[1] * Omega[3] + Omega[2] * Omega[6];
+      OmegaSq[1] = Omega[0] * Omega[1] + Omega[1] * Omega[4] + Omega[2] * Omega[7];
+      OmegaSq[2] = Omega[0] * Omega[2] + Omega[1] * Omega[5] + Omega[2] * Omega[8];
+      OmegaSq[3] = Omega[3] * Omega[0] + Omega[4] * Omega[3] + Omega[5] * Omega[6];
+      OmegaSq[4] = Omega[3] * Omega[1] + Omega[4] * Omega[4] + Omega[5] * Omega[7];
+      OmegaSq[5] = Omega[3] * Omega[2] + Omega[4] * Omega[5] + Omega[5] * Omega[8];
+      OmegaSq[6] = Omega[6] * Omega[0] + Omega[7] * Omega[3] + Omega[8] * Omega[6];
+      OmegaSq[7] = Omega[6] * Omega[1] + Omega[7] * Omega[4] + Omega[8] * Omega[7];
+      OmegaSq[8] = Omega[6] * Omega[2] + Omega[7] * Omega[5] + Omega[8] * Omega[8];
+
+      for(int i=0 ; i<9 ; ++i)
+        Q[i] = (i%4 == 0 ? 1.0 : 0.0) + scaleFactor1 * Omega[i] + scaleFactor2 * OmegaSq[i];
+
+      // R_STEP_NP1 = QMatrix * R_STEP_N (T&F Eq. 36)
+      for(int r=0 ; r<3 ; ++r)
+        for(int c=0 ; c<3 ; ++c)
+          RNP1[3*r+c][p] = Q[3*r] * R[c][p] + Q[3*r+1] * R[3+c][p] + Q[3*r+2] * R[6+c][p];
+
+      // V_STEP_NP1 = V_STEP_N + dt*Vdot with Vdot = L*V - V*Omega
+      for(int r=0 ; r<3 ; ++r)
+        for(int c=0 ; c<3 ; ++c)
+          VNP1[3*r+c][p] = V[3*r+c][p] + dt * (
+            ( L[3*r][p] * V[c][p] + L[3*r+1][p] * V[3+c][p] + L[3*r+2][p] * V[6+c][p] ) -
+            ( V[3*r][p] * Omega[c] + V[3*r+1][p] * Omega[3+c] + V[3*r+2][p] * Omega[6+c] ) );
+
+      // d = Rt * D * R
+      for(int r=0 ; r<3 ; ++r)
+        for(int c=0 ; c<3 ; ++c)
+          temp[3*r+c] = D[3*r] * RNP1[c][p] + D[3*r+1] * RNP1[3+c][p] + D[3*r+2] * RNP1[6+c][p];
+      for(int r=0 ; r<3 ; ++r)
+        for(int c=0 ; c<3 ; ++c)
+          d[3*r+c][p] = RNP1[r][p] * temp[c] + RNP1[3+r][p] * temp[3+c] + RNP1[6+r][p] * temp[6+c];
+    }
+
+    scatterTensorBatch(VNP1, leftStretchTensorNP1+9*first, n);
+    scatterTensorBatch(RNP1, rotationTensorNP1+9*first, n);
+    scatterTensorBatch(d, unrotatedRateOfDeformation+9*first, n);
+  }
+}
+
 template<typename ScalarT>
 int computeShapeTensorInverseAndApproximateDeformationGradient
 (
@@ -378,6 +654,176 @@ int numPoints
   return returnCode;
 }
 
+//Performs the Flanagan and Taylor (1987) update of the rotation and left stretch
+//tensors at a single point given its Eulerian velocity gradient; returns zero if
+//successful, nonzero if (trace(V) * I - V) is singular
+template<typename ScalarT>
+int computeRotationAndUnrotatedRateOfDeformationAtPoint
+(
+const ScalarT* eulerianVelGrad,
+const ScalarT* leftStretchN,
+const ScalarT* rotTensorN,
+ScalarT* leftStretchNP1,
+ScalarT* rotTensorNP1,
+ScalarT* unrotRateOfDef,
+double dt
+)
+{
+  ScalarT rateOfDef[9], spin[9], temp[9], tempInv[9];
+  ScalarT OmegaTensor[9], QMatrix[9], OmegaTensorSq[9];
+  ScalarT tempA[9], tempB[9], rateOfStretch[9];
+
+  ScalarT determinant;
+  ScalarT omegaX, omegaY, omegaZ;
+  ScalarT zX, zY, zZ;
+  ScalarT wX, wY, wZ;
+  ScalarT traceV, Omega, OmegaSq, scaleFactor1, scaleFactor2;
+  int inversionReturnCode(0);
+
+  // Compute rate-of-deformation tensor, D = 1/2 * (L + Lt)
+  *(rateOfDef)   = *(eulerianVelGrad);
+  *(rateOfDef+1) = 0.5 * ( *(eulerianVelGrad+1) + *(eulerianVelGrad+3) );
+  *(rateOfDef+2) = 0.5 * ( *(eulerianVelGrad+2) + *(eulerianVelGrad+6) );
+  *(rateOfDef+3) = *(rateOfDef+1);
+  *(rateOfDef+4) = *(eulerianVelGrad+4);
+  *(rateOfDef+5) = 0.5 * ( *(eulerianVelGrad+5) + *(eulerianVelGrad+7) );
+  *(rateOfDef+6) = *(rateOfDef+2);
+  *(rateOfDef+7) = *(rateOfDef+5);
+  *(rateOfDef+8) = *(eulerianVelGrad+8);
+
+  // Compute spin tensor, W = 1/2 * (L - Lt)
+  *(spin)   = 0.0;
+  *(spin+1) = 0.5 * ( *(eulerianVelGrad+1) - *(eulerianVelGrad+3) );
+  *(spin+2) = 0.5 * ( *(eulerianVelGrad+2) - *(eulerianVelGrad+6) );
+  *(spin+3) = -1.0 * *(spin+1);
+  *(spin+4) = 0.0;
+  *(spin+5) = 0.5 * ( *(eulerianVelGrad+5) - *(eulerianVelGrad+7) );
+  *(spin+6) = -1.0 * *(spin+2);
+  *(spin+7) = -1.0 * *(spin+5);
+  *(spin+8) = 0.0;
+ 
+  //Following Flanagan & Taylor (T&F) 
+  //
+  //Find the vector z_i = \epsilon_{ikj} * D_{jm} * V_{mk} (T&F Eq. 13)
+  //
+  //where \epsilon_{ikj} is the alternator tensor.
+  //
+  //Components below copied from computer algebra solution to the expansion
+  //above
+  
+  
+  zX = - *(leftStretchN+2) *  *(rateOfDef+3) -  *(leftStretchN+5) *  *(rateOfDef+4) - 
+         *(leftStretchN+8) *  *(rateOfDef+5) +  *(leftStretchN+1) *  *(rateOfDef+6) + 
+         *(leftStretchN+4) *  *(rateOfDef+7) +  *(leftStretchN+7) *  *(rateOfDef+8);
+  zY =   *(leftStretchN+2) *  *(rateOfDef)   +  *(leftStretchN+5) *  *(rateOfDef+1) + 
+         *(leftStretchN+8) *  *(rateOfDef+2) -  *(leftStretchN)   *  *(rateOfDef+6) - 
+         *(leftStretchN+3) *  *(rateOfDef+7) -  *(leftStretchN+6) *  *(rateOfDef+8);
+  zZ = - *(leftStretchN+1) *  *(rateOfDef)   -  *(leftStretchN+4) *  *(rateOfDef+1) - 
+         *(leftStretchN+7) *  *(rateOfDef+2) +  *(leftStretchN)   *  *(rateOfDef+3) + 
+         *(leftStretchN+3) *  *(rateOfDef+4) +  *(leftStretchN+6) *  *(rateOfDef+5);
+
+  //Find the vector w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
+  wX = 0.5 * ( *(spin+7) - *(spin+5) );
+  wY = 0.5 * ( *(spin+2) - *(spin+6) );
+  wZ = 0.5 * ( *(spin+3) - *(spin+1) );
+
+  //Find trace(V)
+  traceV = *(leftStretchN) + *(leftStretchN+4) + *(leftStretchN+8);
+
+  // Compute (trace(V) * I - V) store in temp
+  *(temp)   = traceV - *(leftStretchN);
+  *(temp+1) = - *(leftStretchN+1);
+  *(temp+2) = - *(leftStretchN+2);
+  *(temp+3) = - *(leftStretchN+3);
+  *(temp+4) = traceV - *(leftStretchN+4);
+  *(temp+5) = - *(leftStretchN+5);
+  *(temp+6) = - *(leftStretchN+6);
+  *(temp+7) = - *(leftStretchN+7);
+  *(temp+8) = traceV - *(leftStretchN+8);
+
+  // Compute the inverse of the temp matrix
+  inversionReturnCode=Invert3by3Matrix(temp, determinant, tempInv);
+  if(inversionReturnCode > 0)
+    return inversionReturnCode;
+
+  //Find omega vector, i.e. \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
+  omegaX =  wX + *(tempInv)   * zX + *(tempInv+1) * zY + *(tempInv+2) * zZ;
+  omegaY =  wY + *(tempInv+3) * zX + *(tempInv+4) * zY + *(tempInv+5) * zZ;
+  omegaZ =  wZ + *(tempInv+6) * zX + *(tempInv+7) * zY + *(tempInv+8) * zZ;
+
+  //Find the tensor \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
+  *(OmegaTensor) = 0.0;
+  *(OmegaTensor+1) = -omegaZ;
+  *(OmegaTensor+2) = omegaY;
+  *(OmegaTensor+3) = omegaZ;
+  *(OmegaTensor+4) = 0.0;
+  *(OmegaTensor+5) = -omegaX;
+  *(OmegaTensor+6) = -omegaY;
+  *(OmegaTensor+7) = omegaX;
+  *(OmegaTensor+8) = 0.0;
+
+  //Increment R with (T&F Eq. 36 and 44) as opposed to solving (T&F 39) this
+  //is desirable for accuracy in implicit solves and has no effect on
+  //explicit solves (other than a slight decrease in speed).
+  //
+  // Compute Q with (T&F Eq. 44)
+  //
+  // Omega^2 = w_i * w_i (T&F Eq. 42)
+  OmegaSq = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
+  // Omega = \sqrt{OmegaSq}
+  Omega = sqrt(OmegaSq);
+
+  // Avoid a potential divide-by-zero
+  if ( OmegaSq > 1.e-30){
+
+    // Compute Q = I + sin( dt * Omega ) * OmegaTensor / Omega - (1. - cos(dt * Omega)) * omegaTensor^2 / OmegaSq
+    //           = I + scaleFactor1 * OmegaTensor + scaleFactor2 * OmegaTensorSq
+    scaleFactor1 = sin(dt*Omega) / Omega;
+    scaleFactor2 = -(1.0 - cos(dt*Omega)) / OmegaSq;
+    MatrixMultiply(false, false, 1.0, OmegaTensor, OmegaTensor, OmegaTensorSq);
+    *(QMatrix)   = 1.0 + scaleFactor1 * *(OmegaTensor)   + scaleFactor2 * *(OmegaTensorSq)   ;
+    *(QMatrix+1) =       scaleFactor1 * *(OmegaTensor+1) + scaleFactor2 * *(OmegaTensorSq+1) ;
+    *(QMatrix+2) =       scaleFactor1 * *(OmegaTensor+2) + scaleFactor2 * *(OmegaTensorSq+2) ;
+    *(QMatrix+3) =       scaleFactor1 * *(OmegaTensor+3) + scaleFactor2 * *(OmegaTensorSq+3) ;
+    *(QMatrix+4) = 1.0 + scaleFactor1 * *(OmegaTensor+4) + scaleFactor2 * *(OmegaTensorSq+4) ;
+    *(QMatrix+5) =       scaleFactor1 * *(OmegaTensor+5) + scaleFactor2 * *(OmegaTensorSq+5) ;
+    *(QMatrix+6) =       scaleFactor1 * *(OmegaTensor+6) + scaleFactor2 * *(OmegaTensorSq+6) ;
+    *(QMatrix+7) =       scaleFactor1 * *(OmegaTensor+7) + scaleFactor2 * *(OmegaTensorSq+7) ;
+    *(QMatrix+8) = 1.0 + scaleFactor1 * *(OmegaTensor+8) + scaleFactor2 * *(OmegaTensorSq+8) ;
+
+  } else {
+    *(QMatrix)   = 1.0 ; *(QMatrix+1) = 0.0 ; *(QMatrix+2) = 0.0 ;
+    *(QMatrix+3) = 0.0 ; *(QMatrix+4) = 1.0 ; *(QMatrix+5) = 0.0 ;
+    *(QMatrix+6) = 0.0 ; *(QMatrix+7) = 0.0 ; *(QMatrix+8) = 1.0 ;
+  };
+
+  // Compute R_STEP_NP1 = QMatrix * R_STEP_N (T&F Eq. 36)
+  MatrixMultiply(false, false, 1.0, QMatrix, rotTensorN, rotTensorNP1);
+
+  // Compute rate of stretch, Vdot = L*V - V*Omega
+  // First tempA = L*V, 
+  MatrixMultiply(false, false, 1.0, eulerianVelGrad, leftStretchN, tempA);
+
+  // tempB = V*Omega
+  MatrixMultiply(false, false, 1.0, leftStretchN, OmegaTensor, tempB);
+
+  //Vdot = tempA - tempB
+  for(int i=0 ; i<9 ; ++i)
+    *(rateOfStretch+i) = *(tempA+i) - *(tempB+i);
+
+  //V_STEP_NP1 = V_STEP_N + dt*Vdot
+  for(int i=0 ; i<9 ; ++i)
+    *(leftStretchNP1+i) = *(leftStretchN+i) + dt * *(rateOfStretch+i);
+
+  // Compute the unrotated rate-of-deformation, d, i.e., temp = D * R
+  MatrixMultiply(false, false, 1.0, rateOfDef, rotTensorNP1, temp);
+
+  // d = Rt * temp
+  MatrixMultiply(true, false, 1.0, rotTensorNP1, temp, unrotRateOfDef);
+
+  return 0;
+}
+
 //Performs kinematic computations following Flanagan and Taylor (1987), returns
 //unrotated rate-of-deformation and rotation tensors
 template<typename ScalarT>
@@ -424,23 +870,9 @@ double dt
   std::vector<ScalarT> FdotVector(9) ; ScalarT* Fdot = &FdotVector[0];
   std::vector<ScalarT> FinverseVector(9) ; ScalarT* Finverse = &FinverseVector[0];
   std::vector<ScalarT> eulerianVelGradVector(9) ; ScalarT* eulerianVelGrad = &eulerianVelGradVector[0];
-  std::vector<ScalarT> rateOfDefVector(9) ; ScalarT* rateOfDef = &rateOfDefVector[0];
-  std::vector<ScalarT> spinVector(9) ; ScalarT* spin = &spinVector[0];
-  std::vector<ScalarT> tempVector(9) ; ScalarT* temp = &tempVector[0];
-  std::vector<ScalarT> tempInvVector(9) ; ScalarT* tempInv = &tempInvVector[0];
-  std::vector<ScalarT> OmegaTensorVector(9) ; ScalarT* OmegaTensor = &OmegaTensorVector[0];
-  std::vector<ScalarT> QMatrixVector(9) ; ScalarT* QMatrix = &QMatrixVector[0];
-  std::vector<ScalarT> OmegaTensorSqVector(9) ; ScalarT* OmegaTensorSq = &OmegaTensorSqVector[0];
-  std::vector<ScalarT> tempAVector(9) ; ScalarT* tempA = &tempAVector[0];
-  std::vector<ScalarT> tempBVector(9) ; ScalarT* tempB = &tempBVector[0];
-  std::vector<ScalarT> rateOfStretchVector(9) ; ScalarT* rateOfStretch = &rateOfStretchVector[0];
 
   ScalarT determinant;
-  ScalarT omegaX, omegaY, omegaZ;
-  ScalarT zX, zY, zZ;
-  ScalarT wX, wY, wZ;
   ScalarT velStateX, velStateY, velStateZ;
-  ScalarT traceV, Omega, OmegaSq, scaleFactor1, scaleFactor2;
   double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
   double neighborVolume, omega, scalarTemp; 
   int inversionReturnCode(0);
@@ -542,69 +974,14 @@ double dt
     // Compute the Eulerian velocity gradient L = Fdot * Finv
     MatrixMultiply(false, false, 1.0, Fdot, Finverse, eulerianVelGrad);
 
-    // Compute rate-of-deformation tensor, D = 1/2 * (L + Lt)
-    *(rateOfDef)   = *(eulerianVelGrad);
-    *(rateOfDef+1) = 0.5 * ( *(eulerianVelGrad+1) + *(eulerianVelGrad+3) );
-    *(rateOfDef+2) = 0.5 * ( *(eulerianVelGrad+2) + *(eulerianVelGrad+6) );
-    *(rateOfDef+3) = *(rateOfDef+1);
-    *(rateOfDef+4) = *(eulerianVelGrad+4);
-    *(rateOfDef+5) = 0.5 * ( *(eulerianVelGrad+5) + *(eulerianVelGrad+7) );
-    *(rateOfDef+6) = *(rateOfDef+2);
-    *(rateOfDef+7) = *(rateOfDef+5);
-    *(rateOfDef+8) = *(eulerianVelGrad+8);
-
-    // Compute spin tensor, W = 1/2 * (L - Lt)
-    *(spin)   = 0.0;
-    *(spin+1) = 0.5 * ( *(eulerianVelGrad+1) - *(eulerianVelGrad+3) );
-    *(spin+2) = 0.5 * ( *(eulerianVelGrad+2) - *(eulerianVelGrad+6) );
-    *(spin+3) = -1.0 * *(spin+1);
-    *(spin+4) = 0.0;
-    *(spin+5) = 0.5 * ( *(eulerianVelGrad+5) - *(eulerianVelGrad+7) );
-    *(spin+6) = -1.0 * *(spin+2);
-    *(spin+7) = -1.0 * *(spin+5);
-    *(spin+8) = 0.0;
-   
-    //Following Flanagan & Taylor (T&F) 
-    //
-    //Find the vector z_i = \epsilon_{ikj} * D_{jm} * V_{mk} (T&F Eq. 13)
-    //
-    //where \epsilon_{ikj} is the alternator tensor.
-    //
-    //Components below copied from computer algebra solution to the expansion
-    //above
-    
-    
-    zX = - *(leftStretchN+2) *  *(rateOfDef+3) -  *(leftStretchN+5) *  *(rateOfDef+4) - 
-           *(leftStretchN+8) *  *(rateOfDef+5) +  *(leftStretchN+1) *  *(rateOfDef+6) + 
-           *(leftStretchN+4) *  *(rateOfDef+7) +  *(leftStretchN+7) *  *(rateOfDef+8);
-    zY =   *(leftStretchN+2) *  *(rateOfDef)   +  *(leftStretchN+5) *  *(rateOfDef+1) + 
-           *(leftStretchN+8) *  *(rateOfDef+2) -  *(leftStretchN)   *  *(rateOfDef+6) - 
-           *(leftStretchN+3) *  *(rateOfDef+7) -  *(leftStretchN+6) *  *(rateOfDef+8);
-    zZ = - *(leftStretchN+1) *  *(rateOfDef)   -  *(leftStretchN+4) *  *(rateOfDef+1) - 
-           *(leftStretchN+7) *  *(rateOfDef+2) +  *(leftStretchN)   *  *(rateOfDef+3) + 
-           *(leftStretchN+3) *  *(rateOfDef+4) +  *(leftStretchN+6) *  *(rateOfDef+5);
-
-    //Find the vector w_i = -1/2 * \epsilon_{ijk} * W_{jk} (T&F Eq. 11)
-    wX = 0.5 * ( *(spin+7) - *(spin+5) );
-    wY = 0.5 * ( *(spin+2) - *(spin+6) );
-    wZ = 0.5 * ( *(spin+3) - *(spin+1) );
-
-    //Find trace(V)
-    traceV = *(leftStretchN) + *(leftStretchN+4) + *(leftStretchN+8);
-
-    // Compute (trace(V) * I - V) store in temp
-    *(temp)   = traceV - *(leftStretchN);
-    *(temp+1) = - *(leftStretchN+1);
-    *(temp+2) = - *(leftStretchN+2);
-    *(temp+3) = - *(leftStretchN+3);
-    *(temp+4) = traceV - *(leftStretchN+4);
-    *(temp+5) = - *(leftStretchN+5);
-    *(temp+6) = - *(leftStretchN+6);
-    *(temp+7) = - *(leftStretchN+7);
-    *(temp+8) = traceV - *(leftStretchN+8);
-
-    // Compute the inverse of the temp matrix
-    inversionReturnCode=Invert3by3Matrix(temp, determinant, tempInv);
+    // Update the rotation tensor, left stretch tensor, and unrotated rate-of-deformation
+    inversionReturnCode = computeRotationAndUnrotatedRateOfDeformationAtPoint(eulerianVelGrad,
+                                                                             leftStretchN,
+                                                                             rotTensorN,
+                                                                             leftStretchNP1,
+                                                                             rotTensorNP1,
+                                                                             unrotRateOfDef,
+                                                                             dt);
     if(inversionReturnCode > 0){
         returnCode = inversionReturnCode;
         if (singularityDetachment){
@@ -618,84 +995,231 @@ double dt
           *(unrotRateOfDef)   = 0.0 ; *(unrotRateOfDef+1) = 0.0 ;  *(unrotRateOfDef+2) = 0.0;
           *(unrotRateOfDef+3) = 0.0 ; *(unrotRateOfDef+4) = 0.0 ;  *(unrotRateOfDef+5) = 0.0;
           *(unrotRateOfDef+6) = 0.0 ; *(unrotRateOfDef+7) = 0.0 ;  *(unrotRateOfDef+8) = 0.0;
-          continue;
         }
     }
+  }
 
-    //Find omega vector, i.e. \omega = w +  (trace(V) I - V)^(-1) * z (T&F Eq. 12)
-    omegaX =  wX + *(tempInv)   * zX + *(tempInv+1) * zY + *(tempInv+2) * zZ;
-    omegaY =  wY + *(tempInv+3) * zX + *(tempInv+4) * zY + *(tempInv+5) * zZ;
-    omegaZ =  wZ + *(tempInv+6) * zX + *(tempInv+7) * zY + *(tempInv+8) * zZ;
-
-    //Find the tensor \Omega_{ij} = \epsilon_{ikj} * w_k (T&F Eq. 10)
-    *(OmegaTensor) = 0.0;
-    *(OmegaTensor+1) = -omegaZ;
-    *(OmegaTensor+2) = omegaY;
-    *(OmegaTensor+3) = omegaZ;
-    *(OmegaTensor+4) = 0.0;
-    *(OmegaTensor+5) = -omegaX;
-    *(OmegaTensor+6) = -omegaY;
-    *(OmegaTensor+7) = omegaX;
-    *(OmegaTensor+8) = 0.0;
-
-    //Increment R with (T&F Eq. 36 and 44) as opposed to solving (T&F 39) this
-    //is desirable for accuracy in implicit solves and has no effect on
-    //explicit solves (other than a slight decrease in speed).
-    //
-    // Compute Q with (T&F Eq. 44)
-    //
-    // Omega^2 = w_i * w_i (T&F Eq. 42)
-    OmegaSq = omegaX*omegaX + omegaY*omegaY + omegaZ*omegaZ;
-    // Omega = \sqrt{OmegaSq}
-    Omega = sqrt(OmegaSq);
-
-    // Avoid a potential divide-by-zero
-    if ( OmegaSq > 1.e-30){
-
-      // Compute Q = I + sin( dt * Omega ) * OmegaTensor / Omega - (1. - cos(dt * Omega)) * omegaTensor^2 / OmegaSq
-      //           = I + scaleFactor1 * OmegaTensor + scaleFactor2 * OmegaTensorSq
-      scaleFactor1 = sin(dt*Omega) / Omega;
-      scaleFactor2 = -(1.0 - cos(dt*Omega)) / OmegaSq;
-      MatrixMultiply(false, false, 1.0, OmegaTensor, OmegaTensor, OmegaTensorSq);
-      *(QMatrix)   = 1.0 + scaleFactor1 * *(OmegaTensor)   + scaleFactor2 * *(OmegaTensorSq)   ;
-      *(QMatrix+1) =       scaleFactor1 * *(OmegaTensor+1) + scaleFactor2 * *(OmegaTensorSq+1) ;
-      *(QMatrix+2) =       scaleFactor1 * *(OmegaTensor+2) + scaleFactor2 * *(OmegaTensorSq+2) ;
-      *(QMatrix+3) =       scaleFactor1 * *(OmegaTensor+3) + scaleFactor2 * *(OmegaTensorSq+3) ;
-      *(QMatrix+4) = 1.0 + scaleFactor1 * *(OmegaTensor+4) + scaleFactor2 * *(OmegaTensorSq+4) ;
-      *(QMatrix+5) =       scaleFactor1 * *(OmegaTensor+5) + scaleFactor2 * *(OmegaTensorSq+5) ;
-      *(QMatrix+6) =       scaleFactor1 * *(OmegaTensor+6) + scaleFactor2 * *(OmegaTensorSq+6) ;
-      *(QMatrix+7) =       scaleFactor1 * *(OmegaTensor+7) + scaleFactor2 * *(OmegaTensorSq+7) ;
-      *(QMatrix+8) = 1.0 + scaleFactor1 * *(OmegaTensor+8) + scaleFactor2 * *(OmegaTensorSq+8) ;
-
-    } else {
-      *(QMatrix)   = 1.0 ; *(QMatrix+1) = 0.0 ; *(QMatrix+2) = 0.0 ;
-      *(QMatrix+3) = 0.0 ; *(QMatrix+4) = 1.0 ; *(QMatrix+5) = 0.0 ;
-      *(QMatrix+6) = 0.0 ; *(QMatrix+7) = 0.0 ; *(QMatrix+8) = 1.0 ;
-    };
-
-    // Compute R_STEP_NP1 = QMatrix * R_STEP_N (T&F Eq. 36)
-    MatrixMultiply(false, false, 1.0, QMatrix, rotTensorN, rotTensorNP1);
-
-    // Compute rate of stretch, Vdot = L*V - V*Omega
-    // First tempA = L*V, 
-    MatrixMultiply(false, false, 1.0, eulerianVelGrad, leftStretchN, tempA);
-
-    // tempB = V*Omega
-    MatrixMultiply(false, false, 1.0, leftStretchN, OmegaTensor, tempB);
-
-    //Vdot = tempA - tempB
-    for(int i=0 ; i<9 ; ++i)
-      *(rateOfStretch+i) = *(tempA+i) - *(tempB+i);
+  return returnCode;
+}
 
-    //V_STEP_NP1 = V_STEP_N + dt*Vdot
-    for(int i=0 ; i<9 ; ++i)
-      *(leftStretchNP1+i) = *(leftStretchN+i) + dt * *(rateOfStretch+i);
+//Fused evaluation of the shape tensor inverse, the approximate deformation
+//gradient, and the Flanagan and Taylor (1987) kinematics.  Each neighbor is
+//gathered once per point and the shape tensor, deformation gradient, and
+//deformation gradient rate are accumulated in the same bond loop.  Returns zero
+//if successful; bit 1 is set if a shape tensor could not be inverted and bit 2 is
+//set if the deformation gradient or the rotation update failed.
+template<typename ScalarT>
+int computeCorrespondenceKinematics
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* velocities,
+ScalarT* shapeTensorInverse,
+ScalarT* deformationGradient,
+const ScalarT* leftStretchTensorN,
+const ScalarT* rotationTensorN,
+ScalarT* leftStretchTensorNP1,
+ScalarT* rotationTensorNP1,
+ScalarT* unrotatedRateOfDeformation,
+ScalarT* bondDamage,
+ScalarT* singu,
+const int* neighborhoodList,
+int numPoints,
+double dt
+)
+{
+  int returnCode = 0;
 
-    // Compute the unrotated rate-of-deformation, d, i.e., temp = D * R
-    MatrixMultiply(false, false, 1.0, rateOfDef, rotTensorNP1, temp);
+  bool singularityDetachment = (singu!=nullptr);
 
-    // d = Rt * temp
-    MatrixMultiply(true, false, 1.0, rotTensorNP1, temp, unrotRateOfDef);
+  const double* delta = horizon;
+  const double* modelCoord = modelCoordinates;
+  const double* neighborModelCoord;
+  const ScalarT* coord = coordinates;
+  const ScalarT* neighborCoord;
+  const ScalarT* vel = velocities;
+  const ScalarT* neighborVel;
+  ScalarT* shapeTensorInv = shapeTensorInverse;
+  ScalarT* defGrad = deformationGradient;
+  ScalarT* singularity = singu;
+
+  ScalarT shapeTensor[9], defGradFirstTerm[9], FdotFirstTerm[9];
+  ScalarT Fdot[9], Finverse[9];
+
+  // The Eulerian velocity gradients are collected so that the polar decomposition can be batched
+  std::vector<ScalarT> eulerianVelGradVector(9*numPoints);
+  ScalarT* eulerianVelGrad = eulerianVelGradVector.data();
+  std::vector<int> detached(numPoints, 0), rotationReturnCode(numPoints, 0);
+
+  ScalarT determinant;
+  ScalarT deformedBondX, deformedBondY, deformedBondZ;
+  ScalarT velStateX, velStateY, velStateZ;
+  double undeformedBondX, undeformedBondY, undeformedBondZ, undeformedBondLength;
+  double neighborVolume, omega, scalarTemp;
+  int inversionReturnCode(0);
+  bool singular;
+
+  int neighborIndex, numNeighbors;
+  const int *neighborListPtr = neighborhoodList;
+  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, coord+=3, vel+=3,
+        shapeTensorInv+=9, defGrad+=9, singu++){
+
+    numNeighbors = *neighborListPtr; neighborListPtr++;
+
+    singular = (singularityDetachment)&&(*singu!=0.0);
+
+    if(!singular){
+
+      for(int i=0 ; i<9 ; ++i){
+        *(shapeTensor+i) = 0.0;
+        *(defGradFirstTerm+i) = 0.0;
+        *(FdotFirstTerm+i) = 0.0;
+      }
+
+      // Single neighbor gather for the shape tensor, the deformation gradient,
+      // and the rate of the deformation gradient
+      for(int n=0; n<numNeighbors; n++){
+
+        neighborIndex = *(neighborListPtr+n);
+        neighborVolume = volume[neighborIndex];
+        neighborModelCoord = modelCoordinates + 3*neighborIndex;
+        neighborCoord = coordinates + 3*neighborIndex;
+        neighborVel = velocities + 3*neighborIndex;
+
+        undeformedBondX = *(neighborModelCoord)   - *(modelCoord);
+        undeformedBondY = *(neighborModelCoord+1) - *(modelCoord+1);
+        undeformedBondZ = *(neighborModelCoord+2) - *(modelCoord+2);
+        undeformedBondLength = sqrt(undeformedBondX*undeformedBondX +
+                                    undeformedBondY*undeformedBondY +
+                                    undeformedBondZ*undeformedBondZ);
+
+        deformedBondX = *(neighborCoord)   - *(coord);
+        deformedBondY = *(neighborCoord+1) - *(coord+1);
+        deformedBondZ = *(neighborCoord+2) - *(coord+2);
+
+        velStateX = *(neighborVel)   - *(vel);
+        velStateY = *(neighborVel+1) - *(vel+1);
+        velStateZ = *(neighborVel+2) - *(vel+2);
+
+        omega = MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta);
+
+        scalarTemp = (1.0 - *(bondDamage+n)) * omega * neighborVolume;
+
+        *(shapeTensor)   += scalarTemp * undeformedBondX * undeformedBondX;
+        *(shapeTensor+1) += scalarTemp * undeformedBondX * undeformedBondY;
+        *(shapeTensor+2) += scalarTemp * undeformedBondX * undeformedBondZ;
+        *(shapeTensor+3) += scalarTemp * undeformedBondY * undeformedBondX;
+        *(shapeTensor+4) += scalarTemp * undeformedBondY * undeformedBondY;
+        *(shapeTensor+5) += scalarTemp * undeformedBondY * undeformedBondZ;
+        *(shapeTensor+6) += scalarTemp * undeformedBondZ * undeformedBondX;
+        *(shapeTensor+7) += scalarTemp * undeformedBondZ * undeformedBondY;
+        *(shapeTensor+8) += scalarTemp * undeformedBondZ * undeformedBondZ;
+
+        *(defGradFirstTerm)   += scalarTemp * deformedBondX * undeformedBondX;
+        *(defGradFirstTerm+1) += scalarTemp * deformedBondX * undeformedBondY;
+        *(defGradFirstTerm+2) += scalarTemp * deformedBondX * undeformedBondZ;
+        *(defGradFirstTerm+3) += scalarTemp * deformedBondY * undeformedBondX;
+        *(defGradFirstTerm+4) += scalarTemp * deformedBondY * undeformedBondY;
+        *(defGradFirstTerm+5) += scalarTemp * deformedBondY * undeformedBondZ;
+        *(defGradFirstTerm+6) += scalarTemp * deformedBondZ * undeformedBondX;
+        *(defGradFirstTerm+7) += scalarTemp * deformedBondZ * undeformedBondY;
+        *(defGradFirstTerm+8) += scalarTemp * deformedBondZ * undeformedBondZ;
+
+        *(FdotFirstTerm)   += scalarTemp * velStateX * undeformedBondX;
+        *(FdotFirstTerm+1) += scalarTemp * velStateX * undeformedBondY;
+        *(FdotFirstTerm+2) += scalarTemp * velStateX * undeformedBondZ;
+        *(FdotFirstTerm+3) += scalarTemp * velStateY * undeformedBondX;
+        *(FdotFirstTerm+4) += scalarTemp * velStateY * undeformedBondY;
+        *(FdotFirstTerm+5) += scalarTemp * velStateY * undeformedBondZ;
+        *(FdotFirstTerm+6) += scalarTemp * velStateZ * undeformedBondX;
+        *(FdotFirstTerm+7) += scalarTemp * velStateZ * undeformedBondY;
+        *(FdotFirstTerm+8) += scalarTemp * velStateZ * undeformedBondZ;
+      }
+
+      inversionReturnCode = Invert3by3Matrix(shapeTensor, determinant, shapeTensorInv);
+      if(inversionReturnCode > 0){
+        returnCode |= 1;
+        if(singularityDetachment){
+          *singu = 1.0;
+          singular = true;
+          for(int i=0 ; i<9 ; ++i){
+            *(shapeTensorInv+i) = 0.0;
+            *(defGrad+i) = 0.0;
+          }
+        }
+      }
+    }
+    else{
+      for(int i=0 ; i<9 ; ++i){
+        *(shapeTensorInv+i) = 0.0;
+        *(defGrad+i) = 0.0;
+      }
+    }
+
+    if(!singular){
+
+      // F = (first term) * K^-1 and Fdot = (first term of Fdot) * K^-1
+      MatrixMultiply(false, false, 1.0, defGradFirstTerm, shapeTensorInv, defGrad);
+      MatrixMultiply(false, false, 1.0, FdotFirstTerm, shapeTensorInv, Fdot);
+
+      // Compute the inverse of the deformation gradient, Finverse
+      inversionReturnCode = Invert3by3Matrix(defGrad, determinant, Finverse);
+      if((inversionReturnCode > 0)||(determinant<=0)){
+        if(inversionReturnCode > 0)
+          returnCode |= 2;
+        if(singularityDetachment){
+          *singu = 1.0;
+          singular = true;
+        }
+      }
+    }
+
+    if(!singular){
+      // Compute the Eulerian velocity gradient L = Fdot * Finv
+      MatrixMultiply(false, false, 1.0, Fdot, Finverse, eulerianVelGrad+9*iID);
+    }
+    else{
+      // Detached point: break all of its bonds, its kinematics are zeroed below
+      for(int i=0 ; i<9 ; ++i)
+        *(eulerianVelGrad+9*iID+i) = 0.0;
+      for(int n=0; n<numNeighbors; n++)
+        *(bondDamage+n) = 1.0;
+      detached[iID] = 1;
+    }
+
+    neighborListPtr += numNeighbors;
+    bondDamage += numNeighbors;
+  }
+
+  // Update the rotation tensor, left stretch tensor, and unrotated rate-of-deformation for all points at once
+  computeRotationAndUnrotatedRateOfDeformationBatch(eulerianVelGrad,
+                                                    leftStretchTensorN,
+                                                    rotationTensorN,
+                                                    leftStretchTensorNP1,
+                                                    rotationTensorNP1,
+                                                    unrotatedRateOfDeformation,
+                                                    &rotationReturnCode[0],
+                                                    numPoints,
+                                                    dt);
+
+  singu = singularity;
+  for(int iID=0 ; iID<numPoints ; ++iID){
+    if(!detached[iID] && rotationReturnCode[iID] != 0){
+      returnCode |= 2;
+      if(singularityDetachment){
+        singu[iID] = 1.0;
+        detached[iID] = 1;
+      }
+    }
+    if(detached[iID]){
+      for(int i=0 ; i<9 ; ++i){
+        *(rotationTensorNP1+9*iID+i) = 0.0;
+        *(leftStretchTensorNP1+9*iID+i) = 0.0;
+        *(unrotatedRateOfDeformation+9*iID+i) = 0.0;
+      }
+    }
   }
 
   return returnCode;
@@ -866,6 +1390,295 @@ double hourglassCoefficient
   }
 }
 
+//Computes the inverse of the bond-associated shape tensor of each bond.  The
+//bond-associated family of bond ij is made up of the neighbors of i that also lie
+//within the horizon of j.  The shape tensors are symmetric, so only six components
+//are stored.  The tensors of a point are recomputed only when the sum of its bond
+//damage differs from the stored value, or when updateAll is set.  A singular
+//bond-associated shape tensor is stored as zero.
+template<typename ScalarT>
+void computeBondAssociatedShapeTensorInverse
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* bondDamage,
+ScalarT* bondShapeTensorInverseXX,
+ScalarT* bondShapeTensorInverseXY,
+ScalarT* bondShapeTensorInverseXZ,
+ScalarT* bondShapeTensorInverseYY,
+ScalarT* bondShapeTensorInverseYZ,
+ScalarT* bondShapeTensorInverseZZ,
+ScalarT* bondDamageSum,
+const int* neighborhoodList,
+int numPoints,
+bool updateAll
+)
+{
+  const double* delta = horizon;
+  const double* modelCoord = modelCoordinates;
+  const double* neighborModelCoord;
+
+  std::vector<double> bondVector, weightVector;
+  ScalarT shapeTensor[9], shapeTensorInv[9];
+  ScalarT determinant, damageSum;
+  double undeformedBondLength, dX, dY, dZ, horizonSq;
+  double *bond, *bondK;
+  int neighborIndex, numNeighbors;
+
+  const int *neighborListPtr = neighborhoodList;
+  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, bondDamageSum++){
+
+    numNeighbors = *neighborListPtr; neighborListPtr++;
+
+    damageSum = 0.0;
+    for(int n=0; n<numNeighbors; n++)
+      damageSum += *(bondDamage+n);
+
+    if(!updateAll && damageSum == *bondDamageSum){
+      neighborListPtr += numNeighbors; bondDamage += numNeighbors;
+      bondShapeTensorInverseXX += numNeighbors; bondShapeTensorInverseXY += numNeighbors;
+      bondShapeTensorInverseXZ += numNeighbors; bondShapeTensorInverseYY += numNeighbors;
+      bondShapeTensorInverseYZ += numNeighbors; bondShapeTensorInverseZZ += numNeighbors;
+      continue;
+    }
+    *bondDamageSum = damageSum;
+
+    // Gather the undeformed bonds and their weights
+    if(bondVector.size() < 3*(size_t)numNeighbors){
+      bondVector.resize(3*numNeighbors);
+      weightVector.resize(numNeighbors);
+    }
+    for(int n=0; n<numNeighbors; n++){
+      neighborIndex = *(neighborListPtr+n);
+      neighborModelCoord = modelCoordinates + 3*neighborIndex;
+      bond = &bondVector[3*n];
+      *(bond)   = *(neighborModelCoord)   - *(modelCoord);
+      *(bond+1) = *(neighborModelCoord+1) - *(modelCoord+1);
+      *(bond+2) = *(neighborModelCoord+2) - *(modelCoord+2);
+      undeformedBondLength = sqrt(*(bond)**(bond) + *(bond+1)**(bond+1) + *(bond+2)**(bond+2));
+      weightVector[n] = (1.0 - *(bondDamage+n)) * MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta) * volume[neighborIndex];
+    }
+
+    horizonSq = (*delta)*(*delta);
+
+    for(int j=0; j<numNeighbors; j++){
+
+      bond = &bondVector[3*j];
+
+      for(int i=0 ; i<9 ; ++i)
+        *(shapeTensor+i) = 0.0;
+
+      for(int k=0; k<numNeighbors; k++){
+        bondK = &bondVector[3*k];
+        dX = *(bondK)   - *(bond);
+        dY = *(bondK+1) - *(bond+1);
+        dZ = *(bondK+2) - *(bond+2);
+        if(dX*dX + dY*dY + dZ*dZ > horizonSq)
+          continue;
+        *(shapeTensor)   += weightVector[k] * *(bondK)   * *(bondK);
+        *(shapeTensor+1) += weightVector[k] * *(bondK)   * *(bondK+1);
+        *(shapeTensor+2) += weightVector[k] * *(bondK)   * *(bondK+2);
+        *(shapeTensor+4) += weightVector[k] * *(bondK+1) * *(bondK+1);
+        *(shapeTensor+5) += weightVector[k] * *(bondK+1) * *(bondK+2);
+        *(shapeTensor+8) += weightVector[k] * *(bondK+2) * *(bondK+2);
+      }
+      *(shapeTensor+3) = *(shapeTensor+1);
+      *(shapeTensor+6) = *(shapeTensor+2);
+      *(shapeTensor+7) = *(shapeTensor+5);
+
+      Invert3by3Matrix(shapeTensor, determinant, shapeTensorInv);
+      if(determinant <= 0.0){
+        for(int i=0 ; i<9 ; ++i)
+          *(shapeTensorInv+i) = 0.0;
+      }
+
+      *(bondShapeTensorInverseXX+j) = *(shapeTensorInv);
+      *(bondShapeTensorInverseXY+j) = *(shapeTensorInv+1);
+      *(bondShapeTensorInverseXZ+j) = *(shapeTensorInv+2);
+      *(bondShapeTensorInverseYY+j) = *(shapeTensorInv+4);
+      *(bondShapeTensorInverseYZ+j) = *(shapeTensorInv+5);
+      *(bondShapeTensorInverseZZ+j) = *(shapeTensorInv+8);
+    }
+
+    neighborListPtr += numNeighbors; bondDamage += numNeighbors;
+    bondShapeTensorInverseXX += numNeighbors; bondShapeTensorInverseXY += numNeighbors;
+    bondShapeTensorInverseXZ += numNeighbors; bondShapeTensorInverseYY += numNeighbors;
+    bondShapeTensorInverseYZ += numNeighbors; bondShapeTensorInverseZZ += numNeighbors;
+  }
+}
+
+//Bond-associated stabilization: the deformation gradient of each bond is computed
+//over its bond-associated family, and the difference between the bond and the point
+//deformation gradients is converted to a stress with the elastic moduli.  The
+//resulting force states vanish for linear deformations and resist the zero-energy
+//modes that the point-wise deformation gradient cannot see.
+template<typename ScalarT>
+void computeBondAssociatedStabilizationForce
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* deformationGradient,
+const ScalarT* shapeTensorInverse,
+const ScalarT* bondShapeTensorInverseXX,
+const ScalarT* bondShapeTensorInverseXY,
+const ScalarT* bondShapeTensorInverseXZ,
+const ScalarT* bondShapeTensorInverseYY,
+const ScalarT* bondShapeTensorInverseYZ,
+const ScalarT* bondShapeTensorInverseZZ,
+ScalarT* stabilizationForceDensity,
+const ScalarT* bondDamage,
+const int* neighborhoodList,
+int numPoints,
+double bulkModulus,
+double shearModulus
+)
+{
+  const double* delta = horizon;
+  const double* modelCoord = modelCoordinates;
+  const double* neighborModelCoord;
+  const ScalarT* coord = coordinates;
+  const ScalarT* neighborCoord;
+  const ScalarT* defGrad = deformationGradient;
+  const ScalarT* shapeTensorInv = shapeTensorInverse;
+  ScalarT* forceDensityPtr = stabilizationForceDensity;
+  ScalarT* neighborForceDensityPtr;
+
+  const double lambda = bulkModulus - 2.0*shearModulus/3.0;
+
+  std::vector<double> bondVector, weightVector;
+  std::vector<ScalarT> deformedBondVector;
+  ScalarT bondShapeTensorInv[9], defGradFirstTerm[9], bondDefGrad[9], defGradInv[9];
+  ScalarT strain[9], stress[9], piolaStress[9], temp[9];
+  ScalarT jacobianDeterminant, traceStrain, TX, TY, TZ;
+  double undeformedBondLength, dX, dY, dZ, horizonSq, omega;
+  double *bond, *bondK;
+  ScalarT *deformedBondK;
+  int neighborIndex, numNeighbors;
+
+  const int *neighborListPtr = neighborhoodList;
+  for(int iID=0 ; iID<numPoints ; ++iID, delta++, modelCoord+=3, coord+=3,
+        defGrad+=9, shapeTensorInv+=9, forceDensityPtr+=3){
+
+    numNeighbors = *neighborListPtr; neighborListPtr++;
+
+    if(Invert3by3Matrix(defGrad, jacobianDeterminant, defGradInv) != 0 || jacobianDeterminant <= 0.0){
+      neighborListPtr += numNeighbors; bondDamage += numNeighbors;
+      bondShapeTensorInverseXX += numNeighbors; bondShapeTensorInverseXY += numNeighbors;
+      bondShapeTensorInverseXZ += numNeighbors; bondShapeTensorInverseYY += numNeighbors;
+      bondShapeTensorInverseYZ += numNeighbors; bondShapeTensorInverseZZ += numNeighbors;
+      continue;
+    }
+
+    // Gather the undeformed bonds, deformed bonds, and weights once per point
+    if(bondVector.size() < 3*(size_t)numNeighbors){
+      bondVector.resize(3*numNeighbors);
+      deformedBondVector.resize(3*numNeighbors);
+      weightVector.resize(numNeighbors);
+    }
+    for(int n=0; n<numNeighbors; n++){
+      neighborIndex = *(neighborListPtr+n);
+      neighborModelCoord = modelCoordinates + 3*neighborIndex;
+      neighborCoord = coordinates + 3*neighborIndex;
+      bond = &bondVector[3*n];
+      *(bond)   = *(neighborModelCoord)   - *(modelCoord);
+      *(bond+1) = *(neighborModelCoord+1) - *(modelCoord+1);
+      *(bond+2) = *(neighborModelCoord+2) - *(modelCoord+2);
+      deformedBondVector[3*n]   = *(neighborCoord)   - *(coord);
+      deformedBondVector[3*n+1] = *(neighborCoord+1) - *(coord+1);
+      deformedBondVector[3*n+2] = *(neighborCoord+2) - *(coord+2);
+      undeformedBondLength = sqrt(*(bond)**(bond) + *(bond+1)**(bond+1) + *(bond+2)**(bond+2));
+      weightVector[n] = (1.0 - *(bondDamage+n)) * MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta) * volume[neighborIndex];
+    }
+
+    horizonSq = (*delta)*(*delta);
+
+    for(int j=0; j<numNeighbors; j++){
+
+      // Broken bonds and bonds with a singular bond-associated shape tensor carry no stabilization force
+      if(*(bondDamage+j) == 1.0 || *(bondShapeTensorInverseXX+j) <= 0.0)
+        continue;
+
+      *(bondShapeTensorInv)   = *(bondShapeTensorInverseXX+j);
+      *(bondShapeTensorInv+1) = *(bondShapeTensorInverseXY+j);
+      *(bondShapeTensorInv+2) = *(bondShapeTensorInverseXZ+j);
+      *(bondShapeTensorInv+3) = *(bondShapeTensorInverseXY+j);
+      *(bondShapeTensorInv+4) = *(bondShapeTensorInverseYY+j);
+      *(bondShapeTensorInv+5) = *(bondShapeTensorInverseYZ+j);
+      *(bondShapeTensorInv+6) = *(bondShapeTensorInverseXZ+j);
+      *(bondShapeTensorInv+7) = *(bondShapeTensorInverseYZ+j);
+      *(bondShapeTensorInv+8) = *(bondShapeTensorInverseZZ+j);
+
+      bond = &bondVector[3*j];
+
+      for(int i=0 ; i<9 ; ++i)
+        *(defGradFirstTerm+i) = 0.0;
+
+      for(int k=0; k<numNeighbors; k++){
+        bondK = &bondVector[3*k];
+        dX = *(bondK)   - *(bond);
+        dY = *(bondK+1) - *(bond+1);
+        dZ = *(bondK+2) - *(bond+2);
+        if(dX*dX + dY*dY + dZ*dZ > horizonSq)
+          continue;
+        deformedBondK = &deformedBondVector[3*k];
+        *(defGradFirstTerm)   += weightVector[k] * *(deformedBondK)   * *(bondK);
+        *(defGradFirstTerm+1) += weightVector[k] * *(deformedBondK)   * *(bondK+1);
+        *(defGradFirstTerm+2) += weightVector[k] * *(deformedBondK)   * *(bondK+2);
+        *(defGradFirstTerm+3) += weightVector[k] * *(deformedBondK+1) * *(bondK);
+        *(defGradFirstTerm+4) += weightVector[k] * *(deformedBondK+1) * *(bondK+1);
+        *(defGradFirstTerm+5) += weightVector[k] * *(deformedBondK+1) * *(bondK+2);
+        *(defGradFirstTerm+6) += weightVector[k] * *(deformedBondK+2) * *(bondK);
+        *(defGradFirstTerm+7) += weightVector[k] * *(deformedBondK+2) * *(bondK+1);
+        *(defGradFirstTerm+8) += weightVector[k] * *(deformedBondK+2) * *(bondK+2);
+      }
+
+      // Bond-associated deformation gradient
+      MatrixMultiply(false, false, 1.0, defGradFirstTerm, bondShapeTensorInv, bondDefGrad);
+
+      // Strain carried by the bond but not by the point, 1/2 * (dF + dFt) with dF = F_bond - F
+      for(int r=0 ; r<3 ; ++r)
+        for(int c=0 ; c<3 ; ++c)
+          *(strain+3*r+c) = 0.5 * ( *(bondDefGrad+3*r+c) - *(defGrad+3*r+c) + *(bondDefGrad+3*c+r) - *(defGrad+3*c+r) );
+      traceStrain = *(strain) + *(strain+4) + *(strain+8);
+
+      for(int i=0 ; i<9 ; ++i)
+        *(stress+i) = 2.0 * shearModulus * *(strain+i);
+      *(stress)   += lambda * traceStrain;
+      *(stress+4) += lambda * traceStrain;
+      *(stress+8) += lambda * traceStrain;
+
+      //P = J * \sigma * F^(-T)
+      MatrixMultiply(false, true, jacobianDeterminant, stress, defGradInv, piolaStress);
+      MatrixMultiply(false, false, 1.0, piolaStress, shapeTensorInv, temp);
+
+      undeformedBondLength = sqrt(*(bond)**(bond) + *(bond+1)**(bond+1) + *(bond+2)**(bond+2));
+      omega = (1.0 - *(bondDamage+j)) * MATERIAL_EVALUATION::scalarInfluenceFunction(undeformedBondLength, *delta);
+
+      TX = omega * ( *(temp)   * *(bond) + *(temp+1) * *(bond+1) + *(temp+2) * *(bond+2) );
+      TY = omega * ( *(temp+3) * *(bond) + *(temp+4) * *(bond+1) + *(temp+5) * *(bond+2) );
+      TZ = omega * ( *(temp+6) * *(bond) + *(temp+7) * *(bond+1) + *(temp+8) * *(bond+2) );
+
+      neighborIndex = *(neighborListPtr+j);
+      neighborForceDensityPtr = stabilizationForceDensity + 3*neighborIndex;
+
+      *(forceDensityPtr)   += TX * volume[neighborIndex];
+      *(forceDensityPtr+1) += TY * volume[neighborIndex];
+      *(forceDensityPtr+2) += TZ * volume[neighborIndex];
+      *(neighborForceDensityPtr)   -= TX * volume[iID];
+      *(neighborForceDensityPtr+1) -= TY * volume[iID];
+      *(neighborForceDensityPtr+2) -= TZ * volume[iID];
+    }
+
+    neighborListPtr += numNeighbors; bondDamage += numNeighbors;
+    bondShapeTensorInverseXX += numNeighbors; bondShapeTensorInverseXY += numNeighbors;
+    bondShapeTensorInverseXZ += numNeighbors; bondShapeTensorInverseYY += numNeighbors;
+    bondShapeTensorInverseYZ += numNeighbors; bondShapeTensorInverseZZ += numNeighbors;
+  }
+}
+
 template<typename ScalarT>
 void rotateCauchyStress
 (
@@ -875,18 +1688,27 @@ void rotateCauchyStress
  int numPoints
 )
 {
-  const ScalarT* rotTensor = rotationTensor;
-  const ScalarT* unrotatedStress = unrotatedCauchyStress;
-  ScalarT* rotatedStress = rotatedCauchyStress;
+  ScalarT R[9][batchSize], S[9][batchSize], rotated[9][batchSize];
   ScalarT temp[9];
 
-  for(int iID=0 ; iID<numPoints ; ++iID, 
-        rotTensor+=9, unrotatedStress+=9, rotatedStress+=9){ 
+  for(int first=0 ; first<numPoints ; first+=batchSize){
 
+    const int n = std::min(batchSize, numPoints-first);
+    gatherTensorBatch(rotationTensor+9*first, R, n);
+    gatherTensorBatch(unrotatedCauchyStress+9*first, S, n);
+
+    for(int p=0 ; p<n ; ++p){
       // temp = \sigma_unrot * Rt
-      CORRESPONDENCE::MatrixMultiply(false, true, 1.0, unrotatedStress, rotTensor, temp);
+      for(int r=0 ; r<3 ; ++r)
+        for(int c=0 ; c<3 ; ++c)
+          temp[3*r+c] = S[3*r][p] * R[3*c][p] + S[3*r+1][p] * R[3*c+1][p] + S[3*r+2][p] * R[3*c+2][p];
       // \sigma_rot = R * temp
-      CORRESPONDENCE::MatrixMultiply(false, false, 1.0, rotTensor, temp, rotatedStress);
+      for(int r=0 ; r<3 ; ++r)
+        for(int c=0 ; c<3 ; ++c)
+          rotated[3*r+c][p] = R[3*r][p] * temp[c] + R[3*r+1][p] * temp[3+c] + R[3*r+2][p] * temp[6+c];
+    }
+
+    scatterTensorBatch(rotated, rotatedCauchyStress+9*first, n);
   }
 }
 
@@ -917,6 +1739,38 @@ template void rotateCauchyStress<double>
  int numPoints
  );
 
+template int Invert3by3MatrixBatch<double>
+(
+ const double* matrix,
+ double* determinant,
+ double* inverse,
+ int numPoints
+);
+
+template void MatrixMultiplyBatch<double>
+(
+ bool transA,
+ bool transB,
+ const double* alpha,
+ const double* a,
+ const double* b,
+ double* result,
+ int numPoints
+);
+
+template void computeRotationAndUnrotatedRateOfDeformationBatch<double>
+(
+const double* eulerianVelocityGradient,
+const double* leftStretchTensorN,
+const double* rotationTensorN,
+double* leftStretchTensorNP1,
+double* rotationTensorNP1,
+double* unrotatedRateOfDeformation,
+int* returnCode,
+int numPoints,
+double dt
+);
+
 template int Invert3by3Matrix<double>
 (
  const double* matrix,
@@ -966,6 +1820,38 @@ int numPoints,
 double dt
 );
 
+template int computeRotationAndUnrotatedRateOfDeformationAtPoint<double>
+(
+const double* eulerianVelGrad,
+const double* leftStretchN,
+const double* rotTensorN,
+double* leftStretchNP1,
+double* rotTensorNP1,
+double* unrotRateOfDef,
+double dt
+);
+
+template int computeCorrespondenceKinematics<double>
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const double* coordinates,
+const double* velocities,
+double* shapeTensorInverse,
+double* deformationGradient,
+const double* leftStretchTensorN,
+const double* rotationTensorN,
+double* leftStretchTensorNP1,
+double* rotationTensorNP1,
+double* unrotatedRateOfDeformation,
+double* bondDamage,
+double* singu,
+const int* neighborhoodList,
+int numPoints,
+double dt
+);
+
 template void computeGreenLagrangeStrain<double>
 (
   const double* deformationGradientXX,
@@ -1004,6 +1890,46 @@ double bulkModulus,
 double hourglassCoefficient
 );
 
+template void computeBondAssociatedShapeTensorInverse<double>
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const double* bondDamage,
+double* bondShapeTensorInverseXX,
+double* bondShapeTensorInverseXY,
+double* bondShapeTensorInverseXZ,
+double* bondShapeTensorInverseYY,
+double* bondShapeTensorInverseYZ,
+double* bondShapeTensorInverseZZ,
+double* bondDamageSum,
+const int* neighborhoodList,
+int numPoints,
+bool updateAll
+);
+
+template void computeBondAssociatedStabilizationForce<double>
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const double* coordinates,
+const double* deformationGradient,
+const double* shapeTensorInverse,
+const double* bondShapeTensorInverseXX,
+const double* bondShapeTensorInverseXY,
+const double* bondShapeTensorInverseXZ,
+const double* bondShapeTensorInverseYY,
+const double* bondShapeTensorInverseYZ,
+const double* bondShapeTensorInverseZZ,
+double* stabilizationForceDensity,
+const double* bondDamage,
+const int* neighborhoodList,
+int numPoints,
+double bulkModulus,
+double shearModulus
+);
+
 template void setOnesOnDiagonalFullTensor<double>
 (
  double* tensor,
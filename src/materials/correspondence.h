@@ -87,6 +87,45 @@ void MatrixMultiply
  ScalarT* result
 );
 
+//! Invert a batch of 3-by-3 matrices stored contiguously (nine row-major entries per point); singular matrices get a zero inverse.  Returns the number of singular matrices.
+template<typename ScalarT>
+int Invert3by3MatrixBatch
+(
+ const ScalarT* matrix,
+ ScalarT* determinant,
+ ScalarT* inverse,
+ int numPoints
+);
+
+//! Inner products of a batch of 3-by-3 matrices, result = alpha * a * b with one alpha per point (alpha may be null).
+template<typename ScalarT>
+void MatrixMultiplyBatch
+(
+ bool transA,
+ bool transB,
+ const ScalarT* alpha,
+ const ScalarT* a,
+ const ScalarT* b,
+ ScalarT* result,
+ int numPoints
+);
+
+//! Flanagan & Taylor rotation and left stretch update for a batch of points; returnCode is set to nonzero for points where the update failed.
+template<typename ScalarT>
+void computeRotationAndUnrotatedRateOfDeformationBatch
+(
+const ScalarT* eulerianVelocityGradient,
+const ScalarT* leftStretchTensorN,
+const ScalarT* rotationTensorN,
+ScalarT* leftStretchTensorNP1,
+ScalarT* rotationTensorNP1,
+ScalarT* unrotatedRateOfDeformation,
+int* returnCode,
+int numPoints,
+double dt
+);
+
+//! Rotate the unrotated Cauchy stress back to the Eulerian frame, \sigma = R * \sigma_unrot * Rt.
 template<typename ScalarT>
 void rotateCauchyStress
 (
@@ -134,6 +173,42 @@ int numPoints,
 double dt
 );
 
+//! Flanagan & Taylor rotation and left stretch update at a single point, given the Eulerian velocity gradient.
+template<typename ScalarT>
+int computeRotationAndUnrotatedRateOfDeformationAtPoint
+(
+const ScalarT* eulerianVelGrad,
+const ScalarT* leftStretchN,
+const ScalarT* rotTensorN,
+ScalarT* leftStretchNP1,
+ScalarT* rotTensorNP1,
+ScalarT* unrotRateOfDef,
+double dt
+);
+
+//! Shape tensor inverse, deformation gradient, and Flanagan & Taylor kinematics evaluated from a single neighbor sweep.
+template<typename ScalarT>
+int computeCorrespondenceKinematics
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* velocities,
+ScalarT* shapeTensorInverse,
+ScalarT* deformationGradient,
+const ScalarT* leftStretchTensorN,
+const ScalarT* rotationTensorN,
+ScalarT* leftStretchTensorNP1,
+ScalarT* rotationTensorNP1,
+ScalarT* unrotatedRateOfDeformation,
+ScalarT* bondDamage,
+ScalarT* singu,
+const int* neighborhoodList,
+int numPoints,
+double dt
+);
+
 //! Green-Lagrange Strain E = 0.5*(F^T F - I).
 template<typename ScalarT>
 void computeGreenLagrangeStrain
@@ -182,6 +257,50 @@ double bulkModulus,
 double hourglassCoefficient
 );
 
+//! Inverse of the bond-associated shape tensor of each bond (six symmetric components), recomputed only for points whose bond damage has changed.
+template<typename ScalarT>
+void computeBondAssociatedShapeTensorInverse
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* bondDamage,
+ScalarT* bondShapeTensorInverseXX,
+ScalarT* bondShapeTensorInverseXY,
+ScalarT* bondShapeTensorInverseXZ,
+ScalarT* bondShapeTensorInverseYY,
+ScalarT* bondShapeTensorInverseYZ,
+ScalarT* bondShapeTensorInverseZZ,
+ScalarT* bondDamageSum,
+const int* neighborhoodList,
+int numPoints,
+bool updateAll
+);
+
+//! Bond-associated stabilization force, an alternative to the hourglass force that needs no tuning coefficient.
+template<typename ScalarT>
+void computeBondAssociatedStabilizationForce
+(
+const double* volume,
+const double* horizon,
+const double* modelCoordinates,
+const ScalarT* coordinates,
+const ScalarT* deformationGradient,
+const ScalarT* shapeTensorInverse,
+const ScalarT* bondShapeTensorInverseXX,
+const ScalarT* bondShapeTensorInverseXY,
+const ScalarT* bondShapeTensorInverseXZ,
+const ScalarT* bondShapeTensorInverseYY,
+const ScalarT* bondShapeTensorInverseYZ,
+const ScalarT* bondShapeTensorInverseZZ,
+ScalarT* stabilizationForceDensity,
+const ScalarT* bondDamage,
+const int* neighborhoodList,
+int numPoints,
+double bulkModulus,
+double shearModulus
+);
+
 template<typename ScalarT>
 void setOnesOnDiagonalFullTensor(ScalarT* tensor, int numPoints);
 
@@ -64,7 +64,9 @@ void computeInternalForceElasticBondBased
 		const int* localNeighborList,
 		int numOwnedPoints,
 		double BULK_MODULUS,
-        double horizon
+        double horizon,
+		const int* pointFlags,
+		int evaluateFlag
 )
 {
   double volume, neighborVolume, X[3], neighborX[3], initialBondLength, damageOnBond;
@@ -85,6 +87,11 @@ void computeInternalForceElasticBondBased
     volume = volumeOverlap[p];
 
     int numNeighbors = localNeighborList[neighborhoodIndex++];
+    if(pointFlags != 0 && pointFlags[p] != evaluateFlag){
+      neighborhoodIndex += numNeighbors;
+      bondDamageIndex += numNeighbors;
+      continue;
+    }
 	for(int n=0; n<numNeighbors; n++){
 
       neighborId = localNeighborList[neighborhoodIndex++];
@@ -129,7 +136,9 @@ template void computeInternalForceElasticBondBased<double>
 		const int*  localNeighborList,
 		int numOwnedPoints,
 		double BULK_MODULUS,
-        double horizon
+        double horizon,
+		const int* pointFlags,
+		int evaluateFlag
  );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
@@ -143,7 +152,9 @@ template void computeInternalForceElasticBondBased<Sacado::Fad::DFad<double> >
 		const int*  localNeighborList,
 		int numOwnedPoints,
 		double BULK_MODULUS,
-        double horizon
+        double horizon,
+		const int* pointFlags,
+		int evaluateFlag
 );
 
 }
@@ -49,7 +49,10 @@
 
 namespace MATERIAL_EVALUATION {
 
-//! Computes contributions to the internal force resulting from owned points.
+/*! \brief Computes contributions to the internal force resulting from owned points.
+ *
+ *  If pointFlags is provided, only the owned points p with pointFlags[p] == evaluateFlag are evaluated.
+ */
 template<typename ScalarT>
 void computeInternalForceElasticBondBased
 (
@@ -61,7 +64,9 @@ void computeInternalForceElasticBondBased
 		const int* localNeighborList,
 		int numOwnedPoints,
 		double BULK_MODULUS,
-        double horizon
+        double horizon,
+		const int* pointFlags = 0,
+		int evaluateFlag = 0
 );
 
 }
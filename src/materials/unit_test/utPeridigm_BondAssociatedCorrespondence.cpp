@@ -0,0 +1,211 @@
+/*! \file utPeridigm_BondAssociatedCorrespondence.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_ElasticCorrespondenceMaterial.hpp"
+#include "correspondence.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Regular 4x4x4 lattice with unit spacing and a horizon that reaches the second-nearest neighbors along the axes.
+class BondAssociatedLattice {
+
+public:
+
+  BondAssociatedLattice() : numPoints(64), horizon(2.01) {
+    const int n = 4;
+    modelCoordinates.resize(3*numPoints);
+    for(int i=0 ; i<numPoints ; ++i){
+      modelCoordinates[3*i]   = i%n;
+      modelCoordinates[3*i+1] = (i/n)%n;
+      modelCoordinates[3*i+2] = i/(n*n);
+    }
+    volume.assign(numPoints, 1.0);
+    horizons.assign(numPoints, horizon);
+    numBonds = 0;
+    for(int i=0 ; i<numPoints ; ++i){
+      vector<int> neighbors;
+      for(int j=0 ; j<numPoints ; ++j){
+        if(j == i)
+          continue;
+        double distanceSquared(0.0);
+        for(int dof=0 ; dof<3 ; ++dof)
+          distanceSquared += (modelCoordinates[3*j+dof] - modelCoordinates[3*i+dof])*(modelCoordinates[3*j+dof] - modelCoordinates[3*i+dof]);
+        if(distanceSquared <= horizon*horizon)
+          neighbors.push_back(j);
+      }
+      neighborhoodList.push_back(static_cast<int>(neighbors.size()));
+      neighborhoodList.insert(neighborhoodList.end(), neighbors.begin(), neighbors.end());
+      numBonds += static_cast<int>(neighbors.size());
+    }
+  }
+
+  //! Bond-associated stabilization force density for the given current coordinates.
+  vector<double> stabilizationForce(const vector<double>& coordinates) const {
+    vector<double> shapeTensorInverse(9*numPoints), deformationGradient(9*numPoints);
+    vector<double> specularBondPosition(numBonds, 0.0), bondDamage(numBonds, 0.0), singularity(numPoints, 0.0);
+    int returnCode = CORRESPONDENCE::computeShapeTensorInverseAndApproximateDeformationGradient(&volume[0], &horizons[0], &modelCoordinates[0], &coordinates[0],
+                                                                                                 &shapeTensorInverse[0], &deformationGradient[0],
+                                                                                                 &specularBondPosition[0], &bondDamage[0], &singularity[0],
+                                                                                                 &neighborhoodList[0], numPoints);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(returnCode != 0, "**** Singular shape tensor in the bond-associated lattice.\n");
+
+    vector<double> xx(numBonds), xy(numBonds), xz(numBonds), yy(numBonds), yz(numBonds), zz(numBonds), damageSum(numPoints, 0.0);
+    CORRESPONDENCE::computeBondAssociatedShapeTensorInverse(&volume[0], &horizons[0], &modelCoordinates[0], &bondDamage[0],
+                                                            &xx[0], &xy[0], &xz[0], &yy[0], &yz[0], &zz[0], &damageSum[0],
+                                                            &neighborhoodList[0], numPoints, true);
+
+    vector<double> force(3*numPoints, 0.0);
+    CORRESPONDENCE::computeBondAssociatedStabilizationForce(&volume[0], &horizons[0], &modelCoordinates[0], &coordinates[0],
+                                                            &deformationGradient[0], &shapeTensorInverse[0],
+                                                            &xx[0], &xy[0], &xz[0], &yy[0], &yz[0], &zz[0],
+                                                            &force[0], &bondDamage[0], &neighborhoodList[0], numPoints,
+                                                            bulkModulus, shearModulus);
+    return force;
+  }
+
+  int numPoints;
+  int numBonds;
+  double horizon;
+  vector<double> modelCoordinates;
+  vector<double> volume;
+  vector<double> horizons;
+  vector<int> neighborhoodList;
+
+  static const double bulkModulus;
+  static const double shearModulus;
+};
+
+const double BondAssociatedLattice::bulkModulus = 130.0e9;
+const double BondAssociatedLattice::shearModulus = 78.0e9;
+
+//! The bond-associated formulation replaces the hourglass force, so the two cannot be requested together.
+
+TEUCHOS_UNIT_TEST(BondAssociatedCorrespondence, testRejectsHourglassCoefficient) {
+
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 2.01);
+  params.set("Bond Associated Correspondence", true);
+
+  // without a hourglass coefficient the material is valid
+  TEST_NOTHROW(ElasticCorrespondenceMaterial mat(params));
+
+  params.set("Hourglass Coefficient", 0.02);
+  TEST_THROW(ElasticCorrespondenceMaterial mat(params), std::logic_error);
+}
+
+//! Linear patch test:  the stabilization force vanishes for any affine deformation.
+
+TEUCHOS_UNIT_TEST(BondAssociatedCorrespondence, testLinearPatch) {
+
+  BondAssociatedLattice lattice;
+
+  vector<double> coordinates(3*lattice.numPoints);
+  for(int i=0 ; i<lattice.numPoints ; ++i){
+    const double x = lattice.modelCoordinates[3*i];
+    const double y = lattice.modelCoordinates[3*i+1];
+    const double z = lattice.modelCoordinates[3*i+2];
+    coordinates[3*i]   =  1.01*x + 0.02*y - 0.03*z + 0.5;
+    coordinates[3*i+1] = -0.01*x + 0.98*y + 0.04*z - 0.2;
+    coordinates[3*i+2] =  0.03*x + 0.01*y + 1.02*z + 0.1;
+  }
+
+  vector<double> force = lattice.stabilizationForce(coordinates);
+
+  // a stress of the order of the applied strains gives a force density scale of about 1.0e-2*bulkModulus
+  const double forceScale = 1.0e-2*BondAssociatedLattice::bulkModulus;
+  for(unsigned int i=0 ; i<force.size() ; ++i)
+    TEST_COMPARE(std::fabs(force[i]), <=, 1.0e-12*forceScale);
+}
+
+//! Checkerboard test:  the stabilization force resists the alternating mode that the point-wise deformation gradient cannot see.
+
+TEUCHOS_UNIT_TEST(BondAssociatedCorrespondence, testCheckerboard) {
+
+  BondAssociatedLattice lattice;
+
+  const double amplitude = 1.0e-2;
+  vector<double> displacement(3*lattice.numPoints, 0.0), coordinates(lattice.modelCoordinates);
+  for(int i=0 ; i<lattice.numPoints ; ++i){
+    const int parity = static_cast<int>(lattice.modelCoordinates[3*i] + lattice.modelCoordinates[3*i+1] + lattice.modelCoordinates[3*i+2]) % 2;
+    displacement[3*i] = (parity == 0) ? amplitude : -amplitude;
+    coordinates[3*i] += displacement[3*i];
+  }
+
+  vector<double> force = lattice.stabilizationForce(coordinates);
+
+  // the stabilization forces are internal, so they sum to zero
+  double maxForce(0.0), work(0.0), netForce[3] = {0.0, 0.0, 0.0};
+  for(unsigned int i=0 ; i<force.size() ; ++i){
+    maxForce = std::max(maxForce, std::fabs(force[i]));
+    work += force[i]*displacement[i];
+    netForce[i%3] += force[i];
+  }
+  TEST_COMPARE(maxForce, >, 0.0);
+  for(int dof=0 ; dof<3 ; ++dof)
+    TEST_COMPARE(std::fabs(netForce[dof]), <=, 1.0e-12*maxForce);
+
+  // the forces oppose the checkerboard displacement
+  TEST_COMPARE(work, <, 0.0);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
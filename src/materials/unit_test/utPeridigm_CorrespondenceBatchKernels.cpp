@@ -0,0 +1,151 @@
+/*! \file utPeridigm_CorrespondenceBatchKernels.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "correspondence.h"
+#include <vector>
+#include <cmath>
+
+using namespace std;
+using namespace Teuchos;
+
+//! Number of tensors in each test batch, deliberately not a multiple of the kernel batch size so the tail batch is exercised.
+static const int numPoints = 71;
+
+//! Index of the singular tensor planted in the batch, placed in the tail batch.
+static const int singularPoint = 67;
+
+//! Deterministic, well-conditioned 3x3 tensors (a perturbed identity) with one singular tensor at singularPoint.
+vector<double> createTensors(double seed)
+{
+  vector<double> tensors(9*numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    for(int j=0 ; j<9 ; ++j)
+      tensors[9*i+j] = 0.3*sin(seed + 1.7*i + 0.9*j);
+    tensors[9*i]   += 1.0;
+    tensors[9*i+4] += 1.0;
+    tensors[9*i+8] += 1.0;
+  }
+  // a zero row gives an exactly zero determinant
+  for(int j=0 ; j<3 ; ++j)
+    tensors[9*singularPoint+6+j] = 0.0;
+  return tensors;
+}
+
+TEUCHOS_UNIT_TEST(CorrespondenceBatchKernels, testInvert3by3MatrixBatch) {
+
+  const double relTolerance = 1.0e-14;
+
+  vector<double> matrix = createTensors(0.25);
+  vector<double> determinant(numPoints), inverse(9*numPoints, 1.0);
+  int numSingular = CORRESPONDENCE::Invert3by3MatrixBatch(&matrix[0], &determinant[0], &inverse[0], numPoints);
+
+  int expectedNumSingular(0);
+  for(int i=0 ; i<numPoints ; ++i){
+    double expectedDeterminant;
+    double expectedInverse[9];
+    expectedNumSingular += CORRESPONDENCE::Invert3by3Matrix(&matrix[9*i], expectedDeterminant, expectedInverse);
+    TEST_FLOATING_EQUALITY(determinant[i], expectedDeterminant, relTolerance);
+    for(int j=0 ; j<9 ; ++j){
+      if(expectedInverse[j] == 0.0){
+        TEST_EQUALITY(inverse[9*i+j], 0.0);
+      }
+      else{
+        TEST_FLOATING_EQUALITY(inverse[9*i+j], expectedInverse[j], relTolerance);
+      }
+    }
+  }
+
+  // the singular tensor is reported and receives a zero inverse
+  TEST_EQUALITY(expectedNumSingular, 1);
+  TEST_EQUALITY(numSingular, expectedNumSingular);
+  TEST_EQUALITY(determinant[singularPoint], 0.0);
+  for(int j=0 ; j<9 ; ++j)
+    TEST_EQUALITY(inverse[9*singularPoint+j], 0.0);
+}
+
+TEUCHOS_UNIT_TEST(CorrespondenceBatchKernels, testMatrixMultiplyBatch) {
+
+  const double relTolerance = 1.0e-14;
+
+  vector<double> a = createTensors(0.5);
+  vector<double> b = createTensors(1.5);
+  vector<double> alpha(numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    alpha[i] = 1.0 + 0.5*cos(0.3*i);
+
+  for(int transA=0 ; transA<2 ; ++transA){
+    for(int transB=0 ; transB<2 ; ++transB){
+
+      // per-point scaling
+      vector<double> result(9*numPoints, 0.0);
+      CORRESPONDENCE::MatrixMultiplyBatch(transA == 1, transB == 1, &alpha[0], &a[0], &b[0], &result[0], numPoints);
+      for(int i=0 ; i<numPoints ; ++i){
+        double expected[9];
+        CORRESPONDENCE::MatrixMultiply(transA == 1, transB == 1, alpha[i], &a[9*i], &b[9*i], expected);
+        for(int j=0 ; j<9 ; ++j)
+          TEST_FLOATING_EQUALITY(result[9*i+j], expected[j], relTolerance);
+      }
+
+      // a null alpha is a unit scaling
+      CORRESPONDENCE::MatrixMultiplyBatch(transA == 1, transB == 1, static_cast<const double*>(nullptr), &a[0], &b[0], &result[0], numPoints);
+      for(int i=0 ; i<numPoints ; ++i){
+        double expected[9];
+        CORRESPONDENCE::MatrixMultiply(transA == 1, transB == 1, 1.0, &a[9*i], &b[9*i], expected);
+        for(int j=0 ; j<9 ; ++j)
+          TEST_FLOATING_EQUALITY(result[9*i+j], expected[j], relTolerance);
+      }
+    }
+  }
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
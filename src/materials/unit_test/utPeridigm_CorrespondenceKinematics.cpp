@@ -0,0 +1,237 @@
+/*! \file utPeridigm_CorrespondenceKinematics.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "correspondence.h"
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+using namespace Teuchos;
+
+//! Kinematic fields of a correspondence evaluation.
+struct Kinematics {
+  vector<double> shapeTensorInverse;
+  vector<double> deformationGradient;
+  vector<double> leftStretchTensorNP1;
+  vector<double> rotationTensorNP1;
+  vector<double> unrotatedRateOfDeformation;
+  vector<double> bondDamage;
+  int returnCode;
+};
+
+/*! \brief Regular 4x4x4 lattice with unit spacing, a nonuniform deformation and velocity field, and damaged bonds.
+ *
+ *  Every seventh bond is broken and every fifth bond is half damaged, so the shape tensor, deformation gradient, and
+ *  velocity gradient all depend on the bond damage.
+ */
+class DamagedLattice {
+
+public:
+
+  DamagedLattice() : numPoints(64), horizon(2.01), dt(1.0e-3) {
+    const int n = 4;
+    modelCoordinates.resize(3*numPoints);
+    coordinates.resize(3*numPoints);
+    velocities.resize(3*numPoints);
+    for(int i=0 ; i<numPoints ; ++i){
+      double X = i%n, Y = (i/n)%n, Z = i/(n*n);
+      modelCoordinates[3*i]   = X;
+      modelCoordinates[3*i+1] = Y;
+      modelCoordinates[3*i+2] = Z;
+      coordinates[3*i]   = X + 0.02*X + 0.01*Y + 0.005*X*Z;
+      coordinates[3*i+1] = Y - 0.01*Y + 0.015*Z + 0.004*X*X;
+      coordinates[3*i+2] = Z + 0.03*Z - 0.01*X + 0.003*Y*Z;
+      velocities[3*i]   = 0.5*Y - 0.2*Z + 0.1*X*Y;
+      velocities[3*i+1] = -0.5*X + 0.3*Z + 0.05*Z*Z;
+      velocities[3*i+2] = 0.2*X - 0.3*Y + 0.4*Z;
+    }
+    volume.assign(numPoints, 1.0);
+    horizons.assign(numPoints, horizon);
+    numBonds = 0;
+    for(int i=0 ; i<numPoints ; ++i){
+      vector<int> neighbors;
+      for(int j=0 ; j<numPoints ; ++j){
+        if(j == i)
+          continue;
+        double distanceSquared(0.0);
+        for(int dof=0 ; dof<3 ; ++dof)
+          distanceSquared += (modelCoordinates[3*j+dof] - modelCoordinates[3*i+dof])*(modelCoordinates[3*j+dof] - modelCoordinates[3*i+dof]);
+        if(distanceSquared <= horizon*horizon)
+          neighbors.push_back(j);
+      }
+      neighborhoodList.push_back(static_cast<int>(neighbors.size()));
+      neighborhoodList.insert(neighborhoodList.end(), neighbors.begin(), neighbors.end());
+      numBonds += static_cast<int>(neighbors.size());
+    }
+    bondDamage.assign(numBonds, 0.0);
+    for(int b=0 ; b<numBonds ; ++b){
+      if(b%7 == 3)
+        bondDamage[b] = 1.0;
+      else if(b%5 == 1)
+        bondDamage[b] = 0.5;
+    }
+    leftStretchTensorN.assign(9*numPoints, 0.0);
+    rotationTensorN.assign(9*numPoints, 0.0);
+    for(int i=0 ; i<numPoints ; ++i){
+      for(int d=0 ; d<3 ; ++d){
+        leftStretchTensorN[9*i+4*d] = 1.0;
+        rotationTensorN[9*i+4*d] = 1.0;
+      }
+    }
+  }
+
+  //! Kinematics from the single-sweep kernel used with "Fused Kernel".
+  Kinematics fused() const {
+    Kinematics k = allocate();
+    k.returnCode = CORRESPONDENCE::computeCorrespondenceKinematics(&volume[0], &horizons[0], &modelCoordinates[0], &coordinates[0], &velocities[0],
+                                                                    &k.shapeTensorInverse[0], &k.deformationGradient[0],
+                                                                    &leftStretchTensorN[0], &rotationTensorN[0],
+                                                                    &k.leftStretchTensorNP1[0], &k.rotationTensorNP1[0], &k.unrotatedRateOfDeformation[0],
+                                                                    &k.bondDamage[0], static_cast<double*>(nullptr), &neighborhoodList[0], numPoints, dt);
+    return k;
+  }
+
+  //! Kinematics from the shape tensor pass followed by the Flanagan & Taylor pass.
+  Kinematics twoPass() const {
+    Kinematics k = allocate();
+    vector<double> specularBondPosition(numBonds, 0.0);
+    int shapeTensorReturnCode =
+      CORRESPONDENCE::computeShapeTensorInverseAndApproximateDeformationGradient(&volume[0], &horizons[0], &modelCoordinates[0], &coordinates[0],
+                                                                                 &k.shapeTensorInverse[0], &k.deformationGradient[0],
+                                                                                 &specularBondPosition[0], &k.bondDamage[0], static_cast<double*>(nullptr),
+                                                                                 &neighborhoodList[0], numPoints);
+    int rotationTensorReturnCode =
+      CORRESPONDENCE::computeUnrotatedRateOfDeformationAndRotationTensor(&volume[0], &horizons[0], &modelCoordinates[0], &velocities[0],
+                                                                         &k.deformationGradient[0], &k.shapeTensorInverse[0],
+                                                                         &leftStretchTensorN[0], &rotationTensorN[0],
+                                                                         &k.leftStretchTensorNP1[0], &k.rotationTensorNP1[0], &k.unrotatedRateOfDeformation[0],
+                                                                         &specularBondPosition[0], &k.bondDamage[0], static_cast<double*>(nullptr),
+                                                                         &neighborhoodList[0], numPoints, dt);
+    k.returnCode = shapeTensorReturnCode + rotationTensorReturnCode;
+    return k;
+  }
+
+  int numPoints;
+  int numBonds;
+  double horizon;
+  double dt;
+  vector<double> modelCoordinates;
+  vector<double> coordinates;
+  vector<double> velocities;
+  vector<double> volume;
+  vector<double> horizons;
+  vector<int> neighborhoodList;
+  vector<double> bondDamage;
+  vector<double> leftStretchTensorN;
+  vector<double> rotationTensorN;
+
+private:
+
+  Kinematics allocate() const {
+    Kinematics k;
+    k.shapeTensorInverse.assign(9*numPoints, 0.0);
+    k.deformationGradient.assign(9*numPoints, 0.0);
+    k.leftStretchTensorNP1.assign(9*numPoints, 0.0);
+    k.rotationTensorNP1.assign(9*numPoints, 0.0);
+    k.unrotatedRateOfDeformation.assign(9*numPoints, 0.0);
+    k.bondDamage = bondDamage;
+    k.returnCode = -1;
+    return k;
+  }
+};
+
+//! Largest absolute difference between two fields, relative to the largest entry of the second.
+double relativeDifference(const vector<double>& a, const vector<double>& b)
+{
+  double maxDifference(0.0), maxValue(0.0);
+  for(unsigned int i=0 ; i<a.size() ; ++i){
+    maxDifference = std::max(maxDifference, std::fabs(a[i] - b[i]));
+    maxValue = std::max(maxValue, std::fabs(b[i]));
+  }
+  return maxValue > 0.0 ? maxDifference/maxValue : maxDifference;
+}
+
+//! The fused kernel reproduces the shape tensor, deformation gradient, and velocity gradient kinematics of the two-pass path.
+
+TEUCHOS_UNIT_TEST(CorrespondenceKinematics, FusedMatchesTwoPass) {
+
+  const double tolerance = 1.0e-13;
+
+  DamagedLattice lattice;
+  Kinematics fused = lattice.fused();
+  Kinematics twoPass = lattice.twoPass();
+
+  TEST_EQUALITY(fused.returnCode, 0);
+  TEST_EQUALITY(twoPass.returnCode, 0);
+
+  TEST_COMPARE(relativeDifference(fused.shapeTensorInverse, twoPass.shapeTensorInverse), <=, tolerance);
+  TEST_COMPARE(relativeDifference(fused.deformationGradient, twoPass.deformationGradient), <=, tolerance);
+
+  // the velocity gradient enters through the rotation, the left stretch, and the unrotated rate of deformation
+  TEST_COMPARE(relativeDifference(fused.unrotatedRateOfDeformation, twoPass.unrotatedRateOfDeformation), <=, tolerance);
+  TEST_COMPARE(relativeDifference(fused.rotationTensorNP1, twoPass.rotationTensorNP1), <=, tolerance);
+  TEST_COMPARE(relativeDifference(fused.leftStretchTensorNP1, twoPass.leftStretchTensorNP1), <=, tolerance);
+
+  // bond damage is left untouched when no point is detached
+  TEST_COMPARE_ARRAYS(fused.bondDamage, lattice.bondDamage);
+  TEST_COMPARE_ARRAYS(twoPass.bondDamage, lattice.bondDamage);
+
+  // the damage must matter, the undamaged lattice gives a different deformation gradient
+  DamagedLattice undamagedLattice;
+  std::fill(undamagedLattice.bondDamage.begin(), undamagedLattice.bondDamage.end(), 0.0);
+  Kinematics undamaged = undamagedLattice.fused();
+  TEST_COMPARE(relativeDifference(undamaged.deformationGradient, fused.deformationGradient), >, 1.0e-6);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,164 @@
+/*! \file utPeridigm_ElasticBondBasedMaterial.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_ElasticBondBasedMaterial.hpp"
+#include "Peridigm_Field.hpp"
+#include <Epetra_SerialComm.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Tests that evaluating interior and boundary points in two passes matches a single call to computeForce().
+
+TEUCHOS_UNIT_TEST(ElasticBondBasedMaterial, testSplitEvaluation) {
+
+  // instantiate the material model
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Horizon", 10.0);
+  ElasticBondBasedMaterial mat(params);
+
+  TEST_ASSERT(mat.supportsSplitEvaluation());
+
+  // arguments for calls to material model
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(8, 0, comm);
+  Epetra_Map unknownMap(24, 0, comm);
+  Epetra_Map bondMap(56, 0, comm); // total number of bonds = 8(7) = 56
+  double dt = 1.0;
+  int numOwnedPoints = 8;
+  vector<int> ownedIDs(numOwnedPoints);
+  for(int i=0 ; i<numOwnedPoints; ++i)
+    ownedIDs[i] = i;
+
+  // all cells are neighbors of each other
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints; ++i){
+    neighborhoodList.push_back(7);
+    for(int j=0 ; j<8 ; ++j){
+      if(i != j)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  // flag half of the points as boundary points, interleaved so that interior and boundary points are neighbors
+  vector<int> isBoundaryPoint(numOwnedPoints);
+  for(int i=0 ; i<numOwnedPoints; ++i)
+    isBoundaryPoint[i] = i%2;
+
+  // create the data manager
+  // in serial, the overlap and non-overlap maps are the same
+  PeridigmNS::DataManager dataManager;
+  dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                      Teuchos::rcp(&nodeMap, false),
+                      Teuchos::rcp(&unknownMap, false),
+                      Teuchos::rcp(&unknownMap, false),
+                      Teuchos::rcp(&bondMap, false),
+                      Teuchos::rcp(&bondMap, false));
+  dataManager.allocateData(mat.FieldIds());
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+  int forceDensityFieldId = fieldManager.getFieldId("Force_Density");
+
+  Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+  Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+  Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+  Epetra_Vector& bondDamage = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+
+  // unit cube, with a non-uniform deformation and some damaged bonds
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    x[3*i]   = (i/4)%2;
+    x[3*i+1] = (i/2)%2;
+    x[3*i+2] = i%2;
+    y[3*i]   = 1.01*x[3*i] + 0.02*x[3*i+1];
+    y[3*i+1] = x[3*i+1] - 0.01*x[3*i+2];
+    y[3*i+2] = 0.98*x[3*i+2] + 0.005*i;
+    cellVolume[i] = 1.0 + 0.1*i;
+  }
+  for(int i=0 ; i<bondDamage.MyLength() ; ++i)
+    bondDamage[i] = (i%5 == 0) ? 1.0 : 0.0;
+
+  mat.initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+
+  Epetra_Vector& force = *dataManager.getData(forceDensityFieldId, PeridigmField::STEP_NP1);
+
+  // single pass over all points
+  mat.computeForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+  Epetra_Vector referenceForce(force);
+
+  // interior points, then boundary points
+  force.PutScalar(1.0);
+  mat.computeInteriorForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], &isBoundaryPoint[0], dataManager);
+  mat.computeBoundaryForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], &isBoundaryPoint[0], dataManager);
+
+  double maxForce(0.0);
+  for(int i=0 ; i<force.MyLength() ; ++i)
+    maxForce = std::max(maxForce, std::fabs(referenceForce[i]));
+  TEST_COMPARE(maxForce, >, 0.0);
+
+  for(int i=0 ; i<force.MyLength() ; ++i)
+    TEST_COMPARE(std::fabs(force[i] - referenceForce[i]), <=, 1.0e-14*maxForce);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
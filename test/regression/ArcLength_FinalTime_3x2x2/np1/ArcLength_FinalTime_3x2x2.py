@@ -0,0 +1,62 @@
+#! /usr/bin/env python
+
+import sys
+import os
+from subprocess import Popen
+
+test_dir = "ArcLength_FinalTime_3x2x2/np1"
+base_name = "ArcLength_FinalTime_3x2x2"
+
+if __name__ == "__main__":
+
+    result = 0
+
+    # log file will be dumped if verbose option is given
+    verbose = False
+    if "-verbose" in sys.argv:
+        verbose = True
+
+    # change to the specified test directory
+    os.chdir(test_dir)
+
+    # open log file
+    log_file_name = base_name + ".log"
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+    logfile = open(log_file_name, 'w')
+
+    # remove old output files, if any
+    files_to_remove = base_name + ".e"
+    for file in os.listdir(os.getcwd()):
+      if file in files_to_remove:
+        os.remove(file)
+
+    # run Peridigm
+    command = ["../../../../src/Peridigm", "../"+base_name+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    logfile.close()
+
+    # the last arc-length step must be taken under load control to the final time,
+    # and the analysis must neither abort nor stop short of the final time
+    logfile = open(log_file_name)
+    log = logfile.read()
+    logfile.close()
+
+    logfile = open(log_file_name, 'a')
+    if log.count("final step, load control to the final time") == 0:
+        logfile.write("\nTest FAILED:  the last step was not limited to the final time.\n")
+        result = 1
+    if log.count("Aborting analysis") != 0 or log.count("before reaching the final time") != 0:
+        logfile.write("\nTest FAILED:  the analysis did not reach the final time.\n")
+        result = 1
+    logfile.close()
+
+    # dump the output if the user requested verbose
+    if verbose == True:
+        os.system("cat " + log_file_name)
+
+    sys.exit(result)
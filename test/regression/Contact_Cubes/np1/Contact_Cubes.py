@@ -33,9 +33,11 @@ if __name__ == "__main__":
       if file in files_to_remove:
         os.remove(file)
 
-    # run Peridigm
+    # run Peridigm on a single thread
+    serial_env = dict(os.environ)
+    serial_env["OMP_NUM_THREADS"] = "1"
     command = ["../../../../src/Peridigm", "../"+base_name+".xml"]
-    p = Popen(command, stdout=logfile, stderr=logfile)
+    p = Popen(command, stdout=logfile, stderr=logfile, env=serial_env)
     return_code = p.wait()
     if return_code != 0:
         result = return_code
@@ -52,6 +54,46 @@ if __name__ == "__main__":
     if return_code != 0:
         result = return_code
 
+    # run Peridigm with the contact kernel on four threads (a single thread if built without OpenMP)
+    threaded_env = dict(os.environ)
+    threaded_env["OMP_NUM_THREADS"] = "4"
+    command = ["../../../../src/Peridigm", "../"+base_name+"_Threads.xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile, env=threaded_env)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # the threaded contact forces must reproduce the single-threaded run
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_Threads.e", \
+               base_name+".e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # run the same problem with the contact search restricted to surface points
+    command = ["../../../../src/Peridigm", "../"+base_name+"_Surface_Only_Search.xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile, env=serial_env)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # interior points are shielded from contact, the result must match the full search
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_Surface_Only_Search.e", \
+               "../"+base_name+"_gold.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
     logfile.close()
 
     # dump the output if the user requested verbose
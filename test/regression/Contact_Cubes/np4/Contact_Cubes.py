@@ -57,6 +57,54 @@ if __name__ == "__main__":
     if return_code != 0:
         result = return_code
 
+    # run the same problem with the contact forces evaluated by the owning processors
+    command = ["mpiexec", "-np", "4", "../../../../src/Peridigm", "../"+base_name+"_Owner_Computes.xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # compare output files against the same gold file
+    command = ["../../../../scripts/epu", "-p", "4", base_name+"_Owner_Computes"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_Owner_Computes.e", \
+               "../"+base_name+"_gold.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # run the same problem with the contact search restricted to surface points
+    command = ["mpiexec", "-np", "4", "../../../../src/Peridigm", "../"+base_name+"_Surface_Only_Search.xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # interior points are shielded from contact, the result must match the full search
+    command = ["../../../../scripts/epu", "-p", "4", base_name+"_Surface_Only_Search"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_Surface_Only_Search.e", \
+               "../"+base_name+"_gold.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
     logfile.close()
 
     # dump the output if the user requested verbose
@@ -57,6 +57,30 @@ if __name__ == "__main__":
     if return_code != 0:
         result = return_code
 
+    # run the same problem with per-pair search settings and excluded self contact blocks
+    command = ["mpiexec", "-np", "4", "../../../../src/Peridigm", "../"+base_name+"_Pair_Search.xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # compare output files against the same gold file
+    command = ["../../../../scripts/epu", "-p", "4", base_name+"_Pair_Search"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_Pair_Search.e", \
+               "../"+base_name+"_gold.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
     logfile.close()
 
     # dump the output if the user requested verbose
@@ -52,6 +52,25 @@ if __name__ == "__main__":
     if return_code != 0:
         result = return_code
 
+    # run the same problem with the contact search restricted to surface and fracture-exposed points
+    command = ["../../../../src/Peridigm", "../"+base_name+"_Surface_Only_Search.xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # points exposed by broken bonds must enter the search, the result must match the full search
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_Surface_Only_Search.e", \
+               "../"+base_name+"_gold.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
     logfile.close()
 
     # dump the output if the user requested verbose
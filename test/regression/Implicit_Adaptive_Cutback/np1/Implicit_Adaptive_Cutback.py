@@ -0,0 +1,78 @@
+#! /usr/bin/env python
+
+import sys
+import os
+import re
+from subprocess import Popen
+
+test_dir = "Implicit_Adaptive_Cutback/np1"
+base_name = "Implicit_Adaptive_Cutback"
+final_time = 0.002
+
+if __name__ == "__main__":
+
+    result = 0
+
+    # log file will be dumped if verbose option is given
+    verbose = False
+    if "-verbose" in sys.argv:
+        verbose = True
+
+    # change to the specified test directory
+    os.chdir(test_dir)
+
+    # open log file
+    log_file_name = base_name + ".log"
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+    logfile = open(log_file_name, 'w')
+
+    # remove old output files, if any
+    files_to_remove = base_name + ".e"
+    for file in os.listdir(os.getcwd()):
+      if file in files_to_remove:
+        os.remove(file)
+
+    # run Peridigm
+    command = ["../../../../src/Peridigm", "../"+base_name+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    logfile.close()
+
+    # the time step must have been cut back at least once, every step must have converged,
+    # and the last step must end at the final time
+    logfile = open(log_file_name)
+    lines = logfile.readlines()
+    logfile.close()
+    num_cutbacks = 0
+    nonconverged = False
+    last_step_final_time = -1.0
+    for line in lines:
+        if "time step failed to converge" in line:
+            num_cutbacks += 1
+        if "proceeding with nonconverged solution" in line:
+            nonconverged = True
+        match = re.search("final time = ([-+0-9.eE]+)", line)
+        if match:
+            last_step_final_time = float(match.group(1))
+
+    logfile = open(log_file_name, 'a')
+    if num_cutbacks == 0:
+        logfile.write("\nTest FAILED:  the time step was not cut back.\n")
+        result = 1
+    if nonconverged:
+        logfile.write("\nTest FAILED:  a time step did not converge.\n")
+        result = 1
+    if abs(last_step_final_time - final_time) > 1.0e-12:
+        logfile.write("\nTest FAILED:  the last step ends at " + str(last_step_final_time) + ", expected " + str(final_time) + ".\n")
+        result = 1
+    logfile.close()
+
+    # dump the output if the user requested verbose
+    if verbose == True:
+        os.system("cat " + log_file_name)
+
+    sys.exit(result)
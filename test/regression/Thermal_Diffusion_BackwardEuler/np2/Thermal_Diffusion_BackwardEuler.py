@@ -0,0 +1,148 @@
+#! /usr/bin/env python
+
+import sys
+import os
+import re
+import glob
+from subprocess import Popen
+
+test_dir = "Thermal_Diffusion_BackwardEuler/np2"
+base_name = "Thermal_Diffusion_BackwardEuler"
+
+if __name__ == "__main__":
+
+    result = 0
+
+    # log file will be dumped if verbose option is given
+    verbose = False
+    if "-verbose" in sys.argv:
+        verbose = True
+
+    # change to the specified test directory
+    os.chdir(test_dir)
+
+    # open log file
+    log_file_name = base_name + ".log"
+    if os.path.exists(log_file_name):
+        os.remove(log_file_name)
+    logfile = open(log_file_name, 'w')
+
+    # remove old output files, if any
+    files_to_remove = glob.glob('*.e*')
+    for file in os.listdir(os.getcwd()):
+      if file in files_to_remove:
+        os.remove(file)
+
+    # run Peridigm with the backward Euler thermal update
+    command = ["mpiexec", "-np", "2", "../../../../src/Peridigm", "../"+base_name+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # merge the parallel output files
+    command = ["../../../../scripts/epu", "-p", "2", base_name]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # run Peridigm with the explicit thermal update
+    command = ["mpiexec", "-np", "2", "../../../../src/Peridigm", "../"+base_name+"_Explicit"+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # merge the parallel output files
+    command = ["../../../../scripts/epu", "-p", "2", base_name+"_Explicit"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # the backward Euler and explicit temperature histories must agree
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+".e", \
+               base_name+"_Explicit.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # run Peridigm with the Crank-Nicolson thermal update and a larger thermal time step
+    command = ["mpiexec", "-np", "2", "../../../../src/Peridigm", "../"+base_name+"_CrankNicolson"+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # merge the parallel output files
+    command = ["../../../../scripts/epu", "-p", "2", base_name+"_CrankNicolson"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # the Crank-Nicolson and explicit temperature histories must agree
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_CrankNicolson.e", \
+               base_name+"_Explicit.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # run Peridigm with the backward Euler thermal update and a thermal time step far beyond the explicit stability limit
+    command = ["mpiexec", "-np", "2", "../../../../src/Peridigm", "../"+base_name+"_LargeStep"+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # merge the parallel output files
+    command = ["../../../../scripts/epu", "-p", "2", base_name+"_LargeStep"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # run Peridigm with the explicit thermal update and a small time step for the converged reference
+    command = ["mpiexec", "-np", "2", "../../../../src/Peridigm", "../"+base_name+"_Reference"+".xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # merge the parallel output files
+    command = ["../../../../scripts/epu", "-p", "2", base_name+"_Reference"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # the large step backward Euler solution must agree with the converged reference
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+"_LargeStep.comp", \
+               base_name+"_LargeStep.e", \
+               base_name+"_Reference.e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    logfile.close()
+
+    # dump the output if the user requested verbose
+    if verbose == True:
+        os.system("cat " + log_file_name)
+
+    sys.exit(result)
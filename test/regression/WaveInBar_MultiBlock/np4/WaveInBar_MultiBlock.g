@@ -0,0 +1 @@
+../WaveInBar_MultiBlock.g
\ No newline at end of file
@@ -27,7 +27,7 @@ if __name__ == "__main__":
     logfile = open(log_file_name, 'w')
 
     # remove old output files, if any
-    files_to_remove = base_name + ".e"
+    files_to_remove = [base_name + ".e", base_name + "_Decompose_Serial_Mesh.e"]
     for file in os.listdir(os.getcwd()):
       if file in files_to_remove:
         os.remove(file)
@@ -56,6 +56,30 @@ if __name__ == "__main__":
     if return_code != 0:
         result = return_code
 
+    # run the same problem from the serial mesh, decomposed in code
+    command = ["mpiexec", "-np", "4", "../../../../src/Peridigm", "../"+base_name+"_Decompose_Serial_Mesh.xml"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
+    # the blocks and node sets must match the run on the pre-decomposed mesh
+    command = ["../../../../scripts/epu", "-p", "4", base_name+"_Decompose_Serial_Mesh"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+    command = ["../../../../scripts/exodiff", \
+               "-stat", \
+               "-f", \
+               "../"+base_name+".comp", \
+               base_name+"_Decompose_Serial_Mesh.e", \
+               base_name+".e"]
+    p = Popen(command, stdout=logfile, stderr=logfile)
+    return_code = p.wait()
+    if return_code != 0:
+        result = return_code
+
     logfile.close()
 
     # dump the output if the user requested verbose